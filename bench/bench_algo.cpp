@@ -0,0 +1,151 @@
+/**
+ * \file bench_algo.cpp
+ *
+ * \date 17/10/2026
+ * \author Silmaen
+ */
+#include "DoubleFunctions.h"
+#include "FloatFunctions.h"
+#include "baseFunctions.h"
+#include "benchmark.h"
+#include "bithack_Functions.h"
+#include "rng.h"
+#include "union_Functions.h"
+
+using namespace fln;
+using object::BitDouble;
+using object::BitFloat;
+
+namespace {
+
+/// number of pre-generated inputs, must be a power of 2
+constexpr size_t inputSize= 1024;
+
+/**
+ * @brief Generate random inputs, out of the timed loops.
+ * @tparam T The float type.
+ * @param a Lower bound.
+ * @param b Upper bound.
+ * @return The inputs.
+ */
+template<class T>
+std::vector<T> inputs(f64 a, f64 b) {
+    rand::RandomGenerator rng(0x5EED);
+    std::vector<T> result(inputSize);
+    for(auto& r: result) r= static_cast<T>(a + static_cast<f64>(rng.rand() >> 11U) * 0x1.0p-53 * (b - a));
+    return result;
+}
+
+}// namespace
+
+FLN_BENCHMARK(abs) {
+    const auto in  = inputs<f32>(-1e15, 1e15);
+    const auto ind = inputs<f64>(-1e15, 1e15);
+    runner.measure("std::abs (dbl)", ind, [](f64 x) { return std::abs(x); });
+    runner.measure("fln::object::abs (dbl)", ind, [](f64 x) { return object::abs(BitDouble(x)).getFloat(); });
+    runner.measure("fln::bithack::abs (dbl)", ind, [](f64 x) { return bithack::abs(x); });
+    runner.measure("fln::_union::abs (dbl)", ind, [](f64 x) { return _union::abs(x); });
+    runner.measure("fln::ternary::abs (dbl)", ind, [](f64 x) { return ternary::abs(x); });
+    runner.measure("std::abs", in, [](f32 x) { return std::abs(x); });
+    runner.measure("fln::object::abs", in, [](f32 x) { return object::abs(BitFloat(x)).getFloat(); });
+    runner.measure("fln::bithack::abs", in, [](f32 x) { return bithack::abs(x); });
+    runner.measure("fln::_union::abs", in, [](f32 x) { return _union::abs(x); });
+    runner.measure("fln::ternary::abs", in, [](f32 x) { return ternary::abs(x); });
+}
+
+FLN_BENCHMARK(log2) {
+    const auto in  = inputs<f32>(1e-3, 1e15);
+    const auto ind = inputs<f64>(1e-3, 1e15);
+    runner.measure("std::log2 (dbl)", ind, [](f64 x) { return std::log2(x); });
+    runner.measure("fln::object::log2 (dbl)", ind, [](f64 x) { return object::log2(BitDouble(x)); });
+    runner.measure("fln::object::log2a (dbl)", ind, [](f64 x) { return object::log2a(BitDouble(x)); });
+    runner.measure("fln::bithack::log2 (dbl)", ind, [](f64 x) { return bithack::log2(x); });
+    runner.measure("fln::bithack::log2<High> (dbl)", ind, [](f64 x) { return bithack::log2<Precision::High>(x); });
+    runner.measure("fln::_union::log2 (dbl)", ind, [](f64 x) { return _union::log2(x); });
+    runner.measure("std::log2", in, [](f32 x) { return std::log2(x); });
+    runner.measure("fln::object::log2", in, [](f32 x) { return object::log2(BitFloat(x)); });
+    runner.measure("fln::object::log2a", in, [](f32 x) { return object::log2a(BitFloat(x)); });
+    runner.measure("fln::bithack::log2", in, [](f32 x) { return bithack::log2(x); });
+    runner.measure("fln::bithack::log2<Fast>", in, [](f32 x) { return bithack::log2<Precision::Fast>(x); });
+    runner.measure("fln::bithack::log2<Medium>", in, [](f32 x) { return bithack::log2<Precision::Medium>(x); });
+    runner.measure("fln::bithack::log2<High>", in, [](f32 x) { return bithack::log2<Precision::High>(x); });
+    runner.measure("fln::_union::log2", in, [](f32 x) { return _union::log2(x); });
+}
+
+FLN_BENCHMARK(exp2) {
+    const auto in  = inputs<f32>(-100, 100);
+    const auto ind = inputs<f64>(-1000, 1000);
+    runner.measure("std::exp2 (dbl)", ind, [](f64 x) { return std::exp2(x); });
+    runner.measure("fln::object::exp2 (dbl)", ind, [](f64 x) { return object::exp2(BitDouble(x)); });
+    runner.measure("fln::bithack::exp2 (dbl)", ind, [](f64 x) { return bithack::exp2(x); });
+    runner.measure("fln::bithack::exp2<High> (dbl)", ind, [](f64 x) { return bithack::exp2<Precision::High>(x); });
+    runner.measure("fln::_union::exp2 (dbl)", ind, [](f64 x) { return _union::exp2(x); });
+    runner.measure("std::exp2", in, [](f32 x) { return std::exp2(x); });
+    runner.measure("fln::object::exp2", in, [](f32 x) { return object::exp2(BitFloat(x)); });
+    runner.measure("fln::bithack::exp2", in, [](f32 x) { return bithack::exp2(x); });
+    runner.measure("fln::bithack::exp2<Fast>", in, [](f32 x) { return bithack::exp2<Precision::Fast>(x); });
+    runner.measure("fln::bithack::exp2<Medium>", in, [](f32 x) { return bithack::exp2<Precision::Medium>(x); });
+    runner.measure("fln::bithack::exp2<High>", in, [](f32 x) { return bithack::exp2<Precision::High>(x); });
+    runner.measure("fln::_union::exp2", in, [](f32 x) { return _union::exp2(x); });
+}
+
+FLN_BENCHMARK(pow) {
+    const auto in  = inputs<f32>(1e-3, 1e6);
+    const auto ind = inputs<f64>(1e-3, 1e6);
+    runner.measure("std::pow (dbl)", ind, [](f64 x) { return std::pow(x, 1.25); });
+    runner.measure("fln::object::pow (dbl)", ind, [](f64 x) { return object::pow(BitDouble(x), BitDouble(1.25)); });
+    runner.measure("fln::bithack::pow (dbl)", ind, [](f64 x) { return bithack::pow(x, 1.25); });
+    runner.measure("fln::_union::pow (dbl)", ind, [](f64 x) { return _union::pow(x, 1.25); });
+    runner.measure("std::pow", in, [](f32 x) { return std::pow(x, 1.25f); });
+    runner.measure("fln::object::pow", in, [](f32 x) { return object::pow(BitFloat(x), BitFloat(1.25f)); });
+    runner.measure("fln::bithack::pow", in, [](f32 x) { return bithack::pow(x, 1.25f); });
+    runner.measure("fln::_union::pow", in, [](f32 x) { return _union::pow(x, 1.25f); });
+}
+
+FLN_BENCHMARK(sqrt) {
+    const auto in  = inputs<f32>(1e-3, 1e15);
+    const auto ind = inputs<f64>(1e-3, 1e15);
+    runner.measure("std::sqrt (dbl)", ind, [](f64 x) { return std::sqrt(x); });
+    runner.measure("fln::bithack::sqrt (dbl)", ind, [](f64 x) { return bithack::sqrt(x); });
+    runner.measure("fln::bithack::sqrt_pow (dbl)", ind, [](f64 x) { return bithack::sqrt_pow(x); });
+    runner.measure("fln::bithack::sqrt_b (dbl)", ind, [](f64 x) { return bithack::sqrt_b(x); });
+    runner.measure("fln::bithack::sqrt<1> (dbl)", ind, [](f64 x) { return bithack::sqrt<1>(x); });
+    runner.measure("fln::bithack::sqrt<2> (dbl)", ind, [](f64 x) { return bithack::sqrt<2>(x); });
+    runner.measure("fln::bithack::sqrt<3> (dbl)", ind, [](f64 x) { return bithack::sqrt<3>(x); });
+    runner.measure("fln::bithack::sqrt<4> (dbl)", ind, [](f64 x) { return bithack::sqrt<4>(x); });
+    runner.measure("fln::_union::sqrt (dbl)", ind, [](f64 x) { return _union::sqrt(x); });
+    runner.measure("fln::_union::sqrt_pow (dbl)", ind, [](f64 x) { return _union::sqrt_pow(x); });
+    runner.measure("fln::_union::sqrt_b (dbl)", ind, [](f64 x) { return _union::sqrt_b(x); });
+    runner.measure("std::sqrt", in, [](f32 x) { return std::sqrt(x); });
+    runner.measure("fln::bithack::sqrt", in, [](f32 x) { return bithack::sqrt(x); });
+    runner.measure("fln::bithack::sqrt_pow", in, [](f32 x) { return bithack::sqrt_pow(x); });
+    runner.measure("fln::bithack::sqrt_b", in, [](f32 x) { return bithack::sqrt_b(x); });
+    runner.measure("fln::bithack::sqrt<1>", in, [](f32 x) { return bithack::sqrt<1>(x); });
+    runner.measure("fln::bithack::sqrt<2>", in, [](f32 x) { return bithack::sqrt<2>(x); });
+    runner.measure("fln::bithack::sqrt<3>", in, [](f32 x) { return bithack::sqrt<3>(x); });
+    runner.measure("fln::_union::sqrt", in, [](f32 x) { return _union::sqrt(x); });
+    runner.measure("fln::_union::sqrt_pow", in, [](f32 x) { return _union::sqrt_pow(x); });
+    runner.measure("fln::_union::sqrt_b", in, [](f32 x) { return _union::sqrt_b(x); });
+}
+
+FLN_BENCHMARK(inverse_sqrt) {
+    const auto in  = inputs<f32>(1e-3, 1e15);
+    const auto ind = inputs<f64>(1e-3, 1e15);
+    runner.measure("1.0/std::sqrt (dbl)", ind, [](f64 x) { return 1.0 / std::sqrt(x); });
+    runner.measure("1.0/fln::bithack::sqrt (dbl)", ind, [](f64 x) { return 1.0 / bithack::sqrt(x); });
+    runner.measure("1.0/fln::_union::sqrt (dbl)", ind, [](f64 x) { return 1.0 / _union::sqrt(x); });
+    runner.measure("fln::bithack::rsqrt<0> (dbl)", ind, [](f64 x) { return bithack::rsqrt<0>(x); });
+    runner.measure("fln::bithack::rsqrt<1> (dbl)", ind, [](f64 x) { return bithack::rsqrt<1>(x); });
+    runner.measure("fln::bithack::rsqrt<2> (dbl)", ind, [](f64 x) { return bithack::rsqrt<2>(x); });
+    runner.measure("fln::bithack::rsqrt<3> (dbl)", ind, [](f64 x) { return bithack::rsqrt<3>(x); });
+    runner.measure("fln::bithack::rsqrt<4> (dbl)", ind, [](f64 x) { return bithack::rsqrt<4>(x); });
+    runner.measure("1.0f/std::sqrt", in, [](f32 x) { return 1.0f / std::sqrt(x); });
+    runner.measure("1.0f/fln::bithack::sqrt", in, [](f32 x) { return 1.0f / bithack::sqrt(x); });
+    runner.measure("1.0f/fln::_union::sqrt", in, [](f32 x) { return 1.0f / _union::sqrt(x); });
+    runner.measure("fln::bithack::rsqrt_quake", in, [](f32 x) { return bithack::rsqrt_quake(x); });
+    runner.measure("fln::bithack::rsqrt<0>", in, [](f32 x) { return bithack::rsqrt<0>(x); });
+    runner.measure("fln::bithack::rsqrt<1>", in, [](f32 x) { return bithack::rsqrt<1>(x); });
+    runner.measure("fln::bithack::rsqrt<2>", in, [](f32 x) { return bithack::rsqrt<2>(x); });
+    runner.measure("fln::bithack::rsqrt<3>", in, [](f32 x) { return bithack::rsqrt<3>(x); });
+    runner.measure("fln::_union::rsqrt_quake", in, [](f32 x) { return _union::rsqrt_quake(x); });
+}
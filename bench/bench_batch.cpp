@@ -0,0 +1,62 @@
+/**
+ * \file bench_batch.cpp
+ *
+ * \date 17/10/2026
+ * \author Silmaen
+ */
+#include "benchmark.h"
+#include "bithack_BatchFunctions.h"
+#include "bithack_Functions.h"
+#include "bithack_SimdFunctions.h"
+
+using namespace fln;
+
+namespace {
+
+/// number of elements of the benchmarked arrays
+constexpr size_t batchSize= 4096;
+
+}// namespace
+
+FLN_BENCHMARK(batch) {
+    std::vector<f32> in(batchSize), out(batchSize);
+    std::vector<f64> ind(batchSize), outd(batchSize);
+    for(size_t i= 0; i < batchSize; ++i) {
+        in[i] = 1.0f + 0.25f * static_cast<f32>(i);
+        ind[i]= 1.0 + 0.25 * static_cast<f64>(i);
+    }
+    runner.batch<f64>("std::log2 (dbl)", batchSize, [&] { for(size_t i= 0; i < batchSize; ++i) outd[i]= std::log2(ind[i]); });
+    runner.batch<f64>("fln::bithack::log2 (dbl)", batchSize, [&] { for(size_t i= 0; i < batchSize; ++i) outd[i]= bithack::log2(ind[i]); });
+    runner.batch<f64>("fln::bithack::batch::log2 (dbl)", batchSize, [&] { bithack::batch::log2(ind, outd); });
+    runner.batch<f32>("std::log2", batchSize, [&] { for(size_t i= 0; i < batchSize; ++i) out[i]= std::log2(in[i]); });
+    runner.batch<f32>("fln::bithack::log2", batchSize, [&] { for(size_t i= 0; i < batchSize; ++i) out[i]= bithack::log2(in[i]); });
+    runner.batch<f32>("fln::bithack::batch::log2", batchSize, [&] { bithack::batch::log2(in, out); });
+    runner.batch<f32>("fln::bithack::log2<Medium>", batchSize, [&] { for(size_t i= 0; i < batchSize; ++i) out[i]= bithack::log2<Precision::Medium>(in[i]); });
+    runner.batch<f32>("std::exp2", batchSize, [&] { for(size_t i= 0; i < batchSize; ++i) out[i]= std::exp2(in[i] * 0.01f); });
+    runner.batch<f32>("fln::bithack::batch::exp2", batchSize, [&] { bithack::batch::exp2(in, out); });
+    runner.batch<f32>("std::pow", batchSize, [&] { for(size_t i= 0; i < batchSize; ++i) out[i]= std::pow(in[i], 1.25f); });
+    runner.batch<f32>("fln::bithack::batch::pow", batchSize, [&] { bithack::batch::pow(in, out, 1.25f); });
+    runner.batch<f32>("std::sqrt", batchSize, [&] { for(size_t i= 0; i < batchSize; ++i) out[i]= std::sqrt(in[i]); });
+    runner.batch<f32>("fln::bithack::batch::sqrt", batchSize, [&] { bithack::batch::sqrt(in, out); });
+    runner.batch<f32>("fln::bithack::batch::sqrt_pow", batchSize, [&] { bithack::batch::sqrt_pow(in, out); });
+    runner.batch<f32>("fln::bithack::batch::sqrt_b", batchSize, [&] { bithack::batch::sqrt_b(in, out); });
+    runner.batch<f32>("1.0f/std::sqrt", batchSize, [&] { for(size_t i= 0; i < batchSize; ++i) out[i]= 1.0f / std::sqrt(in[i]); });
+    runner.batch<f32>("fln::bithack::batch::rsqrt_quake", batchSize, [&] { bithack::batch::rsqrt_quake(in, out); });
+    runner.batch<f32>("fln::bithack::batch::abs", batchSize, [&] { bithack::batch::abs(in, out); });
+    runner.batch<f32>("fln::bithack::batch::negate", batchSize, [&] { bithack::batch::negate(in, out); });
+}
+
+FLN_BENCHMARK(simd) {
+    std::vector<f32> in(batchSize), out(batchSize);
+    for(size_t i= 0; i < batchSize; ++i) in[i]= 1.0f + 0.25f * static_cast<f32>(i);
+    for(auto isa: {bithack::simd::Isa::Scalar, bithack::simd::Isa::SSE41, bithack::simd::Isa::AVX2, bithack::simd::Isa::AVX512}) {
+        if(!bithack::simd::setActiveIsa(isa)) continue;
+        const std::string name(bithack::simd::isaName(isa));
+        runner.batch<f32>("fln::bithack::simd::log2 " + name, batchSize, [&] { bithack::simd::log2(in.data(), out.data(), batchSize); });
+        runner.batch<f32>("fln::bithack::simd::exp2 " + name, batchSize, [&] { bithack::simd::exp2(in.data(), out.data(), batchSize); });
+        runner.batch<f32>("fln::bithack::simd::pow " + name, batchSize, [&] { bithack::simd::pow(in.data(), out.data(), batchSize, 1.25f); });
+        runner.batch<f32>("fln::bithack::simd::sqrt " + name, batchSize, [&] { bithack::simd::sqrt(in.data(), out.data(), batchSize); });
+        runner.batch<f32>("fln::bithack::simd::rsqrt " + name, batchSize, [&] { bithack::simd::rsqrt(in.data(), out.data(), batchSize); });
+    }
+    bithack::simd::setActiveIsa(bithack::simd::bestIsa());
+}
@@ -0,0 +1,105 @@
+/**
+ * \file bench_convert.cpp
+ *
+ * \date 17/10/2026
+ * \author Silmaen
+ */
+#include "BFloat16Type.h"
+#include "FP8Type.h"
+#include "FixedType.h"
+#include "HalfType.h"
+#include "MiniFloat.h"
+#include "benchmark.h"
+#include "bithack_SimdFunctions.h"
+
+using namespace fln;
+
+namespace {
+
+/// number of elements of the benchmarked arrays
+constexpr size_t convertSize= 4096;
+
+}// namespace
+
+FLN_BENCHMARK(convert) {
+    std::vector<f32> in(convertSize), out(convertSize);
+    std::vector<u16> half(convertSize);
+    for(size_t i= 0; i < convertSize; ++i) in[i]= -100.0f + 0.05f * static_cast<f32>(i);
+    runner.batch<f32>("f32->f16 packFloat", convertSize, [&] { for(size_t i= 0; i < convertSize; ++i) half[i]= object::packFloat<object::HalfTraits>(in[i]); });
+    runner.batch<f32>("f16->f32 unpackFloat", convertSize, [&] { for(size_t i= 0; i < convertSize; ++i) out[i]= object::unpackFloat<object::HalfTraits>(half[i]); });
+    for(auto isa: {bithack::simd::Isa::Scalar, bithack::simd::bestIsa()}) {
+        if(!bithack::simd::setActiveIsa(isa)) continue;
+        const std::string name= object::halfUsesF16C() ? " F16C" : " scalar";
+        runner.batch<f32>("fln::object::toHalf" + name, convertSize, [&] { object::toHalf(in, half); });
+        runner.batch<f32>("fln::object::fromHalf" + name, convertSize, [&] { object::fromHalf(half, out); });
+    }
+    bithack::simd::setActiveIsa(bithack::simd::bestIsa());
+}
+
+FLN_BENCHMARK(bfloat16) {
+    std::vector<f32> in(convertSize), out(convertSize);
+    std::vector<u16> a(convertSize), b(convertSize);
+    for(size_t i= 0; i < convertSize; ++i) in[i]= -100.0f + 0.05f * static_cast<f32>(i);
+    object::toBFloat16(in, b);
+    f32 result= 0;
+    runner.batch<f32>("f32 dot", convertSize, [&] {
+        f32 acc= 0;
+        for(size_t i= 0; i < convertSize; ++i) acc+= in[i] * in[convertSize - 1 - i];
+        bench::doNotOptimize(acc);
+    });
+    for(auto isa: {bithack::simd::Isa::Scalar, bithack::simd::bestIsa()}) {
+        if(!bithack::simd::setActiveIsa(isa)) continue;
+        const std::string name(bithack::simd::isaName(isa));
+        runner.batch<f32>("fln::object::toBFloat16 " + name, convertSize, [&] { object::toBFloat16(in, a); });
+        runner.batch<f32>("fln::object::fromBFloat16 " + name, convertSize, [&] { object::fromBFloat16(a, out); });
+        runner.batch<f32>("fln::object::dotBFloat16 " + name, convertSize, [&] { result= object::dotBFloat16(a, b); bench::doNotOptimize(result); });
+        runner.batch<f32>("fln::object::sumBFloat16 " + name, convertSize, [&] { result= object::sumBFloat16(a); bench::doNotOptimize(result); });
+    }
+    bithack::simd::setActiveIsa(bithack::simd::bestIsa());
+}
+
+FLN_BENCHMARK(fp8) {
+    std::vector<f32> in(convertSize), out(convertSize);
+    std::vector<u8> bits(convertSize);
+    for(size_t i= 0; i < convertSize; ++i) in[i]= -100.0f + 0.05f * static_cast<f32>(i);
+    runner.batch<f32>("E4M3 packFloat", convertSize, [&] { for(size_t i= 0; i < convertSize; ++i) bits[i]= object::packFloat<object::E4M3>(in[i]); });
+    runner.batch<f32>("fln::object::encodeFP8<E4M3>", convertSize, [&] { object::encodeFP8<object::E4M3>(in, bits); });
+    runner.batch<f32>("fln::object::decodeFP8<E4M3>", convertSize, [&] { object::decodeFP8<object::E4M3>(bits, out); });
+    runner.batch<f32>("fln::object::encodeFP8<E5M2>", convertSize, [&] { object::encodeFP8<object::E5M2>(in, bits); });
+    runner.batch<f32>("fln::object::decodeFP8<E5M2>", convertSize, [&] { object::decodeFP8<object::E5M2>(bits, out); });
+}
+
+FLN_BENCHMARK(minifloat) {
+    using Mini= object::MiniFloat<5, 6>;
+    std::vector<f32> in(convertSize), out(convertSize);
+    std::vector<u8> buffer(object::packedBytes<Mini>(convertSize));
+    for(size_t i= 0; i < convertSize; ++i) in[i]= -100.0f + 0.05f * static_cast<f32>(i);
+    runner.batch<f32>("fln::object::packBits<MiniFloat<5,6>>", convertSize, [&] { object::packBits<Mini>(in, buffer); });
+    runner.batch<f32>("fln::object::unpackBits<MiniFloat<5,6>>", convertSize, [&] { object::unpackBits<Mini>(buffer, out); });
+}
+
+FLN_BENCHMARK(fixed) {
+    std::vector<f32> a(convertSize), b(convertSize), out(convertSize);
+    std::vector<object::Q15> a15(convertSize), b15(convertSize), o15(convertSize);
+    std::vector<object::Q31> a31(convertSize), b31(convertSize), o31(convertSize);
+    for(size_t i= 0; i < convertSize; ++i) {
+        a[i]= -0.9f + 1.8f * static_cast<f32>(i) / static_cast<f32>(convertSize);
+        b[i]= a[convertSize - 1 - i] * 0.5f;
+    }
+    runner.batch<f32>("fln::object::toFixed Q15", convertSize, [&] { object::toFixed(a.data(), a15.data(), convertSize); });
+    runner.batch<f32>("fln::object::toFloat Q15", convertSize, [&] { object::toFloat(a15.data(), out.data(), convertSize); });
+    object::toFixed(b.data(), b15.data(), convertSize);
+    object::toFixed(a.data(), a31.data(), convertSize);
+    object::toFixed(b.data(), b31.data(), convertSize);
+    runner.batch<f32>("f32 add", convertSize, [&] { for(size_t i= 0; i < convertSize; ++i) out[i]= a[i] + b[i]; });
+    runner.batch<f32>("f32 mul", convertSize, [&] { for(size_t i= 0; i < convertSize; ++i) out[i]= a[i] * b[i]; });
+    runner.batch<f32>("f32 mac", convertSize, [&] { for(size_t i= 0; i < convertSize; ++i) out[i]+= a[i] * b[i]; });
+    runner.batch<f32>("fln::object::saturatingAdd Q15", convertSize, [&] { object::saturatingAdd(a15.data(), b15.data(), o15.data(), convertSize); });
+    runner.batch<f32>("fln::object::saturatingMul Q15", convertSize, [&] { object::saturatingMul(a15.data(), b15.data(), o15.data(), convertSize); });
+    runner.batch<f32>("fln::object::saturatingMac Q15", convertSize, [&] { object::saturatingMac(a15.data(), b15.data(), o15.data(), convertSize); });
+    runner.batch<f32>("fln::object::dot Q15", convertSize, [&] { bench::doNotOptimize(object::dot(a15.data(), b15.data(), convertSize)); });
+    runner.batch<f32>("fln::object::saturatingAdd Q31", convertSize, [&] { object::saturatingAdd(a31.data(), b31.data(), o31.data(), convertSize); });
+    runner.batch<f32>("fln::object::saturatingMul Q31", convertSize, [&] { object::saturatingMul(a31.data(), b31.data(), o31.data(), convertSize); });
+    runner.batch<f32>("fln::object::saturatingMac Q31", convertSize, [&] { object::saturatingMac(a31.data(), b31.data(), o31.data(), convertSize); });
+    runner.batch<f32>("fln::object::dot Q31", convertSize, [&] { bench::doNotOptimize(object::dot(a31.data(), b31.data(), convertSize)); });
+}
@@ -0,0 +1,84 @@
+/**
+ * \file bench_random.cpp
+ *
+ * \date 17/10/2026
+ * \author Silmaen
+ */
+#include "benchmark.h"
+#include "bithack_SimdFunctions.h"
+#include "rng.h"
+#include "rngZiggurat.h"
+#include <random>
+
+using namespace fln;
+
+namespace {
+
+/// number of random numbers drawn by one call
+constexpr size_t randomSize= 4096;
+
+/**
+ * @brief Benchmark the bounded integers of an engine against the modulo reduction.
+ * @tparam Engine The generator.
+ * @param runner The benchmark runner.
+ * @param name The name of the engine.
+ */
+template<typename Engine>
+void boundedIntegers(bench::Runner& runner, const std::string& name) {
+    Engine rng(0x5EED);
+    // bounds changing at each draw, as in a sampling loop
+    std::vector<u64> bounds(randomSize);
+    for(size_t i= 0; i < randomSize; ++i) bounds[i]= 1000 + (rng.rand() >> 50U);
+    runner.batch<u64>(name + " rand", randomSize, [&] { for(size_t i= 0; i < randomSize; ++i) bench::doNotOptimize(rng.rand()); });
+    runner.batch<u64>(name + " modulo u64", randomSize, [&] { for(size_t i= 0; i < randomSize; ++i) bench::doNotOptimize(rng.rand() % bounds[i]); });
+    runner.batch<u64>(name + " getRandomU64", randomSize, [&] { for(size_t i= 0; i < randomSize; ++i) bench::doNotOptimize(rng.getRandomU64(bounds[i])); });
+    runner.batch<u32>(name + " modulo u32", randomSize, [&] { for(size_t i= 0; i < randomSize; ++i) bench::doNotOptimize(static_cast<u32>(rng.rand() % static_cast<u32>(bounds[i]))); });
+    runner.batch<u32>(name + " getRandomU32", randomSize, [&] { for(size_t i= 0; i < randomSize; ++i) bench::doNotOptimize(rng.getRandomU32(static_cast<u32>(bounds[i]))); });
+    runner.batch<u16>(name + " modulo u16", randomSize, [&] { for(size_t i= 0; i < randomSize; ++i) bench::doNotOptimize(static_cast<u16>(rng.rand() % static_cast<u16>(bounds[i]))); });
+    runner.batch<u16>(name + " getRandomU16", randomSize, [&] { for(size_t i= 0; i < randomSize; ++i) bench::doNotOptimize(rng.getRandomU16(static_cast<u16>(bounds[i]))); });
+    runner.batch<f32>(name + " int to f32 scaling", randomSize, [&] { for(size_t i= 0; i < randomSize; ++i) bench::doNotOptimize(static_cast<f32>(rng.rand() >> 40U) / 0x1p24f); });
+    runner.batch<f32>(name + " getRandomF32", randomSize, [&] { for(size_t i= 0; i < randomSize; ++i) bench::doNotOptimize(rng.getRandomF32()); });
+    runner.batch<f64>(name + " getRandomF64", randomSize, [&] { for(size_t i= 0; i < randomSize; ++i) bench::doNotOptimize(rng.getRandomF64()); });
+}
+
+}// namespace
+
+FLN_BENCHMARK(random) {
+    std::vector<u64> out64(randomSize);
+    std::vector<f32> out32(randomSize);
+    std::vector<f64> outd(randomSize);
+    rand::Xoshiro256ss scalar(0x5EED);
+    runner.batch<u64>("xoshiro256** rand loop", randomSize, [&] { for(auto& o: out64) o= scalar.rand(); });
+    runner.batch<f32>("xoshiro256** getRandomF32 loop", randomSize, [&] { for(auto& o: out32) o= scalar.getRandomF32(); });
+    for(auto isa: {bithack::simd::Isa::Scalar, bithack::simd::bestIsa()}) {
+        if(!bithack::simd::setActiveIsa(isa)) continue;
+        const std::string name(bithack::simd::isaName(isa));
+        rand::BulkRandomGenerator bulk(0x5EED);
+        runner.batch<u64>("fln::rand::BulkRandomGenerator::fill u64 " + name, randomSize, [&] { bulk.fill(out64); });
+        runner.batch<f32>("fln::rand::BulkRandomGenerator::fill f32 " + name, randomSize, [&] { bulk.fill(out32); });
+        runner.batch<f64>("fln::rand::BulkRandomGenerator::fill f64 " + name, randomSize, [&] { bulk.fill(outd); });
+    }
+    for(auto isa: {bithack::simd::Isa::Scalar, bithack::simd::bestIsa()}) {
+        if(!bithack::simd::setActiveIsa(isa)) continue;
+        const std::string name(bithack::simd::isaName(isa));
+        runner.batch<u64>("fln::rand::Philox4x32::fill u64 " + name, randomSize, [&] { rand::Philox4x32::fill(0x5EED, 0, out64); });
+        runner.batch<f64>("fln::rand::Philox4x32::fill f64 " + name, randomSize, [&] { rand::Philox4x32::fill(0x5EED, 0, outd); });
+    }
+    bithack::simd::setActiveIsa(bithack::simd::bestIsa());
+    boundedIntegers<rand::RandomGenerator>(runner, "xorshift64");
+    boundedIntegers<rand::Xoshiro256ss>(runner, "xoshiro256**");
+    boundedIntegers<rand::Xoroshiro128p>(runner, "xoroshiro128+");
+    boundedIntegers<rand::Philox4x32>(runner, "philox4x32");
+    // normal and exponential: Ziggurat against the standard library (Box-Muller free)
+    rand::Xoshiro256ss zig(0x5EED);
+    std::mt19937_64 mt(0x5EED);
+    std::normal_distribution<f64> stdNormal;
+    std::exponential_distribution<f64> stdExponential;
+    runner.batch<f64>("std::normal_distribution mt19937_64", randomSize, [&] { for(auto& o: outd) o= stdNormal(mt); });
+    runner.batch<f64>("fln::rand::normal", randomSize, [&] { rand::normal(zig, std::span<f64>(outd)); });
+    runner.batch<f64>("fln::rand::normal<FastTails>", randomSize, [&] { rand::normal<rand::FastTails<>>(zig, std::span<f64>(outd)); });
+    runner.batch<f32>("fln::rand::normal f32", randomSize, [&] { rand::normal(zig, std::span<f32>(out32)); });
+    runner.batch<f64>("std::exponential_distribution mt19937_64", randomSize, [&] { for(auto& o: outd) o= stdExponential(mt); });
+    runner.batch<f64>("fln::rand::exponential", randomSize, [&] { rand::exponential(zig, std::span<f64>(outd)); });
+    runner.batch<f64>("fln::rand::exponential<FastTails>", randomSize, [&] { rand::exponential<rand::FastTails<>>(zig, std::span<f64>(outd)); });
+}
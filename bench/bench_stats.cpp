@@ -0,0 +1,90 @@
+/**
+ * \file bench_stats.cpp
+ *
+ * \date 17/10/2026
+ * \author Silmaen
+ */
+#include "benchmark.h"
+#include "bithack_SimdFunctions.h"
+#include "rng.h"
+#include "stdComputeStats.h"
+#include "stdQuantileSketch.h"
+
+using namespace fln;
+
+namespace {
+
+/// number of values of a data set: larger than the caches
+constexpr size_t statsSize= size_t{1} << 24U;
+/// number of values of the summations: in the L1 cache
+constexpr size_t sumSize= 4096;
+
+/**
+ * @brief The former getStats: sum loop, then min_element and max_element.
+ * @param data The values.
+ * @return The statistics.
+ */
+stats::stats<f32> threePasses(const std::vector<f32>& data) {
+    stats::stats<f32> res{};
+    for(const f32 x: data) {
+        res.sum+= x;
+        res.squareSum+= x * x;
+    }
+    res.mean        = res.sum / static_cast<f32>(data.size());
+    res.stdDeviation= std::sqrt(res.squareSum / static_cast<f32>(data.size()) - res.mean * res.mean);
+    res.min         = *std::min_element(data.begin(), data.end());
+    res.max         = *std::max_element(data.begin(), data.end());
+    return res;
+}
+
+/**
+ * @brief Time the summation algorithms on the first values.
+ * @param runner The benchmark runner.
+ * @param data The values.
+ * @param name The suffix of the names.
+ */
+void sums(bench::Runner& runner, const std::vector<f32>& data, const std::string& name) {
+    const std::span<const f32> head(data.data(), sumSize);
+    runner.batch<f32>("fln::stats::sum Naive " + name, sumSize, [&] { bench::doNotOptimize(stats::sum<stats::Summation::Naive>(head)); });
+    runner.batch<f32>("fln::stats::sum Kahan " + name, sumSize, [&] { bench::doNotOptimize(stats::sum<stats::Summation::Kahan>(head)); });
+    runner.batch<f32>("fln::stats::sum Neumaier " + name, sumSize, [&] { bench::doNotOptimize(stats::sum<stats::Summation::Neumaier>(head)); });
+    runner.batch<f32>("fln::stats::sum Pairwise " + name, sumSize, [&] { bench::doNotOptimize(stats::sum<stats::Summation::Pairwise>(head)); });
+    runner.batch<f32>("fln::stats::sum Wide " + name, sumSize, [&] { bench::doNotOptimize(stats::sum<stats::Summation::Wide>(head)); });
+}
+
+}// namespace
+
+FLN_BENCHMARK(stats) {
+    std::vector<f32> data(statsSize);
+    rand::BulkRandomGenerator(0x5EED).fill(std::span<f32>(data), -10.0f, 10.0f);
+    runner.batch<f32>("three passes", statsSize, [&] { bench::doNotOptimize(threePasses(data).mean); });
+    for(auto isa: {bithack::simd::Isa::Scalar, bithack::simd::bestIsa()}) {
+        if(!bithack::simd::setActiveIsa(isa)) continue;
+        const std::string name(bithack::simd::isaName(isa));
+        runner.batch<f32>("fln::stats::getStats " + name, statsSize, [&] { bench::doNotOptimize(stats::getStats(data).mean); });
+        sums(runner, data, name);
+    }
+    bithack::simd::setActiveIsa(bithack::simd::bestIsa());
+    const u32 hardware= std::max(1U, std::thread::hardware_concurrency());
+    for(u32 threads= 2; threads <= hardware; threads*= 2) {
+        runner.batch<f32>("fln::stats::getParallelStats " + std::to_string(threads) + " threads", statsSize, [&] { bench::doNotOptimize(stats::getParallelStats(data, threads).mean); });
+    }
+}
+
+FLN_BENCHMARK(quantiles) {
+    std::vector<f32> data(statsSize);
+    rand::BulkRandomGenerator(0x5EED).fill(std::span<f32>(data), -10.0f, 10.0f);
+    runner.batch<f32>("fln::stats::QuantileSketch::pushBatch", statsSize, [&] {
+        stats::QuantileSketch sketch;
+        sketch.pushBatch(data);
+        bench::doNotOptimize(sketch.quantile(0.99));
+    });
+    // the per thread sketches of one second, merged into the global one
+    stats::QuantileSketch part;
+    part.pushBatch(data);
+    bench::doNotOptimize(part.quantile(0.5));
+    stats::QuantileSketch global;
+    runner.batch<f32>("fln::stats::QuantileSketch::merge", 1, [&] { global.merge(part); });
+    runner.batch<f32>("fln::stats::QuantileSketch::quantile", 1, [&] { bench::doNotOptimize(global.quantile(0.999)); });
+    runner.batch<f32>("fln::stats::QuantileSketch::serialize", 1, [&] { bench::doNotOptimize(global.serialize().size()); });
+}
@@ -0,0 +1,32 @@
+/**
+ * \file bench_timing.cpp
+ *
+ * \date 17/10/2026
+ * \author Silmaen
+ */
+#include "Timing.h"
+#include "benchmark.h"
+
+using namespace fln;
+
+FLN_BENCHMARK(timing) {
+    const std::vector<u64> in(8, 0);
+    runner.throughput("std::chrono::high_resolution_clock::now", in, [](u64) { return std::chrono::high_resolution_clock::now().time_since_epoch().count(); });
+    runner.throughput("std::chrono::steady_clock::now", in, [](u64) { return std::chrono::steady_clock::now().time_since_epoch().count(); });
+    runner.throughput("fln::time::cycleNow", in, [](u64) { return time::cycleNow(); });
+    runner.throughput("fln::time::cycleStart", in, [](u64) { return time::cycleStart(); });
+    runner.throughput("fln::time::cycleStop", in, [](u64) { return time::cycleStop(); });
+    time::Timer timer;
+    timer.startTimer(1e9);
+    runner.throughput("fln::time::Timer::timeCheck", in, [&](u64 x) {
+        timer.timeCheck();
+        return x;
+    });
+    time::CycleTimer cycleTimer;
+    cycleTimer.startTimer(1e9);
+    runner.throughput("fln::time::CycleTimer::timeCheck", in, [&](u64 x) {
+        cycleTimer.timeCheck();
+        return x;
+    });
+    runner.throughput("fln::time::CycleTimer::timedOut", in, [&](u64) { return cycleTimer.timedOut(); });
+}
@@ -0,0 +1,200 @@
+/**
+ * \file benchmark.cpp
+ *
+ * \date 17/10/2026
+ * \author Silmaen
+ */
+#include "benchmark.h"
+
+namespace fln::bench {
+
+/// scaling factor between the MAD and the standard deviation of a normal distribution
+constexpr f64 madToSigma= 1.4826;
+
+const char* modeName(Mode mode) noexcept {
+    switch(mode) {
+    case Mode::Latency:
+        return "latency";
+    case Mode::Throughput:
+        return "throughput";
+    case Mode::Batch:
+        return "batch";
+    }
+    return "unknown";
+}
+
+Mode modeFromName(const std::string& name) {
+    for(auto mode: {Mode::Latency, Mode::Throughput, Mode::Batch})
+        if(name == modeName(mode)) return mode;
+    throw std::invalid_argument("unknown benchmark mode: " + name);
+}
+
+f64 percentile(const std::vector<f64>& sorted, f64 p) {
+    if(sorted.empty()) return 0;
+    const f64 pos  = p * static_cast<f64>(sorted.size() - 1);
+    const auto low = static_cast<size_t>(pos);
+    const size_t up= std::min(low + 1, sorted.size() - 1);
+    return sorted[low] + (pos - static_cast<f64>(low)) * (sorted[up] - sorted[low]);
+}
+
+Summary summarize(std::vector<f64> samples, f64 outlierThreshold) {
+    Summary result;
+    if(samples.empty()) return result;
+    std::sort(samples.begin(), samples.end());
+    const f64 median= percentile(samples, 0.5);
+    std::vector<f64> deviations;
+    deviations.reserve(samples.size());
+    for(auto s: samples) deviations.push_back(std::abs(s - median));
+    std::sort(deviations.begin(), deviations.end());
+    const f64 mad= madToSigma * percentile(deviations, 0.5);
+    // outlier rejection, nothing is rejected if the samples are all equal
+    if(mad > 0) {
+        const auto last= std::remove_if(samples.begin(), samples.end(), [&](f64 s) { return std::abs(s - median) > outlierThreshold * mad; });
+        result.rejected= static_cast<u32>(samples.end() - last);
+        samples.erase(last, samples.end());
+    }
+    result.samples= static_cast<u32>(samples.size());
+    result.median = percentile(samples, 0.5);
+    deviations.clear();
+    for(auto s: samples) deviations.push_back(std::abs(s - result.median));
+    std::sort(deviations.begin(), deviations.end());
+    result.mad= madToSigma * percentile(deviations, 0.5);
+    f64 sum   = 0;
+    for(auto s: samples) sum+= s;
+    result.mean= sum / static_cast<f64>(samples.size());
+    f64 square = 0;
+    for(auto s: samples) square+= (s - result.mean) * (s - result.mean);
+    result.stdDeviation= samples.size() > 1 ? std::sqrt(square / static_cast<f64>(samples.size() - 1)) : 0;
+    result.min         = samples.front();
+    result.max         = samples.back();
+    result.p05         = percentile(samples, 0.05);
+    result.p95         = percentile(samples, 0.95);
+    result.p99         = percentile(samples, 0.99);
+    return result;
+}
+
+Runner::Runner(Options options):
+    m_options{std::move(options)} {
+    if(m_options.perfCounters) m_counters= std::make_unique<PerfCounters>();
+}
+
+f64 Runner::timeIt(const std::function<void(u64)>& body, u64 iterations, f64& cycles) {
+    time::Timer timer;
+    timer.startTimer();
+    const u64 start= time::cycleStart();
+    body(iterations);
+    const u64 end= time::cycleStop();
+    timer.stopTimer();
+    // only the x86 time stamp counter counts (reference) cycles
+#ifdef FLN_TIME_TSC
+    cycles= static_cast<f64>(end - start);
+#else
+    cycles= 0;
+    (void)start;
+    (void)end;
+#endif
+    return static_cast<f64>(timer.currentTimeTakenInNanoSeconds().count());
+}
+
+void Runner::run(const std::string& name, Mode mode, const std::function<void(u64)>& body, u64 itemsPerIteration, const std::string& type) {
+    Result result;
+    result.name= m_group.empty() ? name : m_group + "/" + name;
+    if(!m_options.filter.empty() && result.name.find(m_options.filter) == std::string::npos) return;
+    result.mode             = mode;
+    result.type             = type;
+    result.itemsPerIteration= std::max<u64>(itemsPerIteration, 1);
+    // calibration: grow the number of iterations until one sample is long enough
+    const f64 minSample= m_options.minSampleTime * 1e6;
+    u64 iterations     = 1;
+    f64 cycles         = 0;
+    f64 duration       = timeIt(body, iterations, cycles);
+    while(duration < minSample) {
+        const f64 factor= duration > 0 ? std::clamp(1.2 * minSample / duration, 2.0, 100.0) : 100.0;
+        iterations      = static_cast<u64>(static_cast<f64>(iterations) * factor);
+        duration        = timeIt(body, iterations, cycles);
+    }
+    result.iterations= iterations;
+    // warmup
+    time::Timer warmup;
+    warmup.startTimer();
+    while(static_cast<f64>(warmup.currentTimeTakenInNanoSeconds().count()) < m_options.warmupTime * 1e6)
+        (void)timeIt(body, iterations, cycles);
+    // measurement
+    std::vector<f64> samples;
+    std::vector<f64> cycleSamples;
+    samples.reserve(m_options.samples);
+    cycleSamples.reserve(m_options.samples);
+    const f64 ops= static_cast<f64>(iterations * result.itemsPerIteration);
+    const bool counting= m_counters && m_counters->available();
+    // the reads of multiplexed events may be dropped: average over the valid samples only
+    std::array<u32, eventCount> validSamples{};
+    for(u32 i= 0; i < std::max<u32>(m_options.samples, 1); ++i) {
+        if(counting) m_counters->start();
+        samples.push_back(timeIt(body, iterations, cycles) / ops);
+        if(counting) {
+            const auto values= m_counters->stop();
+            for(size_t e= 0; e < eventCount; ++e) {
+                if(!values.valid[e]) continue;
+                result.counters.values[e]+= values.values[e];
+                ++validSamples[e];
+            }
+        }
+        cycleSamples.push_back(cycles / ops);
+    }
+    for(size_t e= 0; e < eventCount; ++e) {
+        result.counters.valid[e]= validSamples[e] > 0;
+        if(result.counters.valid[e]) result.counters.values[e]/= ops * static_cast<f64>(validSamples[e]);
+    }
+    std::sort(cycleSamples.begin(), cycleSamples.end());
+    result.cycles= percentile(cycleSamples, 0.5);
+    result.time  = summarize(std::move(samples), m_options.outlierThreshold);
+    if(m_options.verbose) printResult(std::cout, result);
+    m_results.push_back(std::move(result));
+}
+
+void printHeader(std::ostream& os) {
+    os << std::left << std::setw(56) << "benchmark" << std::setw(11) << "mode" << std::right
+       << std::setw(11) << "median" << std::setw(9) << "mad" << std::setw(9) << "cycles" << std::setw(11) << "p05"
+       << std::setw(11) << "p95" << std::setw(11) << "min" << std::setw(5) << "rej"
+       << "  (ns/op, " << configName << ")" << std::endl;
+}
+
+void printResult(std::ostream& os, const Result& result) {
+    const auto flags= os.flags();
+    os << std::left << std::setw(56) << result.name << std::setw(11) << modeName(result.mode) << std::right
+       << std::fixed << std::setprecision(3)
+       << std::setw(11) << result.time.median << std::setw(9) << result.time.mad << std::setw(9) << std::setprecision(2) << result.cycles
+       << std::setprecision(3)
+       << std::setw(11) << result.time.p05 << std::setw(11) << result.time.p95
+       << std::setw(11) << result.time.min << std::setw(5) << result.time.rejected;
+    if(result.counters.any()) {
+        os << std::setprecision(2);
+        if(result.counters.has(Event::Cycles) && result.counters.has(Event::Instructions)) os << "  ipc=" << result.counters.ipc();
+        for(auto event: {Event::Cycles, Event::Instructions, Event::BranchMisses, Event::CacheMisses})
+            if(result.counters.has(event)) os << " " << eventName(event) << "=" << result.counters[event];
+    }
+    os << std::endl;
+    os.flags(flags);
+}
+
+Registration::Registration(const char* group, BenchmarkFunction function) {
+    registry().emplace_back(group, function);
+}
+
+std::vector<std::pair<std::string, BenchmarkFunction>>& registry() {
+    static std::vector<std::pair<std::string, BenchmarkFunction>> benchmarks;
+    return benchmarks;
+}
+
+void runAll(Runner& runner) {
+    if(runner.counters() != nullptr && !runner.counters()->available())
+        std::cerr << "hardware counters not available (" << runner.counters()->error() << "), continuing without them" << std::endl;
+    if(runner.options().verbose) printHeader(std::cout);
+    for(const auto& [group, function]: registry()) {
+        runner.setGroup(group);
+        function(runner);
+    }
+    runner.setGroup({});
+}
+
+}// namespace fln::bench
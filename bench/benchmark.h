@@ -0,0 +1,411 @@
+/**
+ * \file benchmark.h
+ *
+ * \date 17/10/2026
+ * \author Silmaen
+ */
+#pragma once
+#include "Timing.h"
+#include "baseType.h"
+#include "perfCounters.h"
+#include <bit>
+#include <functional>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @namespace fln::bench
+ * @brief statistical micro benchmark harness
+ *
+ * Every benchmark is run in warmup, then repeated in several samples. The number of
+ * iterations of one sample is calibrated to last at least a minimum duration. The
+ * per-operation times of the samples are summarized with robust statistics (median,
+ * median absolute deviation, percentiles) after rejection of outliers.
+ */
+namespace fln::bench {
+
+// ---=== optimization barriers ===---
+#if defined(_MSC_VER) && !defined(__clang__)
+/**
+ * @brief Force the compiler to compute a value without using it.
+ * @tparam T The type of value.
+ * @param value The value.
+ */
+template<class T>
+inline void doNotOptimize(const T& value) {
+    const volatile char* sink= reinterpret_cast<const volatile char*>(&value);
+    (void)*sink;
+    _ReadWriteBarrier();
+}
+/**
+ * @brief Force the compiler to compute a value and to forget what it knows about it.
+ * @tparam T The type of value.
+ * @param value The value.
+ */
+template<class T>
+inline void doNotOptimize(T& value) {
+    volatile char* sink= reinterpret_cast<volatile char*>(&value);
+    *sink            = *sink;
+    _ReadWriteBarrier();
+}
+/**
+ * @brief Force the compiler to write all pending memory operations.
+ */
+inline void clobberMemory() { _ReadWriteBarrier(); }
+#else
+/**
+ * @brief Force the compiler to compute a value without using it.
+ * @tparam T The type of value.
+ * @param value The value.
+ */
+template<class T>
+inline void doNotOptimize(const T& value) {
+    asm volatile(""
+                 :
+                 : "r,m"(value)
+                 : "memory");
+}
+/**
+ * @brief Force the compiler to compute a value and to forget what it knows about it.
+ * @tparam T The type of value.
+ * @param value The value.
+ */
+template<class T>
+inline void doNotOptimize(T& value) {
+    asm volatile(""
+                 : "+r,m"(value)
+                 :
+                 : "memory");
+}
+/**
+ * @brief Force the compiler to write all pending memory operations.
+ */
+inline void clobberMemory() {
+    asm volatile(""
+                 :
+                 :
+                 : "memory");
+}
+#endif
+
+/**
+ * @brief The way operations are chained in a benchmark
+ */
+enum struct Mode {
+    Latency,   ///< each operation depends on the previous result (dependent chain)
+    Throughput,///< operations are independent and can overlap in the pipeline
+    Batch      ///< the benchmark body process a whole array at each iteration
+};
+
+/**
+ * @brief Get the name of a mode.
+ * @param mode The mode.
+ * @return The mode's name.
+ */
+[[nodiscard]] const char* modeName(Mode mode) noexcept;
+/**
+ * @brief Get a mode from its name.
+ * @param name The name of the mode.
+ * @return The mode.
+ * @throw std::invalid_argument if the name is not a mode name.
+ */
+[[nodiscard]] Mode modeFromName(const std::string& name);
+
+/**
+ * @brief Options of the benchmark runner
+ */
+struct Options {
+    u32 samples         = 30;  ///< number of samples to measure
+    f64 minSampleTime   = 2.0; ///< minimal duration of one sample in milliseconds
+    f64 warmupTime      = 20.0;///< warmup duration in milliseconds
+    f64 outlierThreshold= 3.5; ///< samples further than this number of (normalized) MAD from the median are rejected
+    std::string filter  = {};  ///< run only the benchmarks whose full name contains this string
+    bool verbose        = true;///< print the results while running
+    bool perfCounters   = false;///< collect the hardware performance counters if available
+};
+
+/**
+ * @brief Statistical summary of the per-operation time of a benchmark (in nanoseconds)
+ */
+struct Summary {
+    f64 median      = 0;///< median
+    f64 mad         = 0;///< median absolute deviation (normalized to be comparable with a standard deviation)
+    f64 mean        = 0;///< mean
+    f64 stdDeviation= 0;///< standard deviation
+    f64 min         = 0;///< minimum
+    f64 max         = 0;///< maximum
+    f64 p05         = 0;///< 5th percentile
+    f64 p95         = 0;///< 95th percentile
+    f64 p99         = 0;///< 99th percentile
+    u32 samples     = 0;///< number of kept samples
+    u32 rejected    = 0;///< number of rejected samples
+};
+
+/**
+ * @brief Compute the summary of a set of samples after rejecting outliers.
+ * @param samples The per-operation times.
+ * @param outlierThreshold The rejection threshold in normalized MAD.
+ * @return The summary.
+ */
+[[nodiscard]] Summary summarize(std::vector<f64> samples, f64 outlierThreshold);
+
+/**
+ * @brief Get a percentile of sorted data, with linear interpolation.
+ * @param sorted The sorted data.
+ * @param p The percentile in [0,1].
+ * @return The percentile value.
+ */
+[[nodiscard]] f64 percentile(const std::vector<f64>& sorted, f64 p);
+
+/**
+ * @brief Result of one benchmark
+ */
+struct Result {
+    std::string name     = {};          ///< full name of the benchmark
+    Mode mode            = Mode::Latency;///< the mode of the benchmark
+    std::string type     = {};          ///< the data type processed by the benchmark
+    u64 iterations       = 0;           ///< number of iterations per sample
+    u64 itemsPerIteration= 1;           ///< number of operations per iteration
+    Summary time         = {};          ///< statistics of the time per operation in nanoseconds
+    f64 cycles           = 0;           ///< median of the reference cycles per operation (0 if no cycle counter)
+    CounterValues counters= {};         ///< hardware counters per operation (if collected)
+};
+
+/**
+ * @brief Get the name of a data type, as written in the reports.
+ * @tparam T The type.
+ * @return The type's name.
+ */
+template<class T>
+[[nodiscard]] constexpr const char* typeName() noexcept {
+    if constexpr(std::is_same_v<T, f32>) return "f32";
+    else if constexpr(std::is_same_v<T, f64>) return "f64";
+    else if constexpr(std::is_same_v<T, u16>) return "u16";
+    else if constexpr(std::is_same_v<T, u32>) return "u32";
+    else if constexpr(std::is_same_v<T, u64>) return "u64";
+    else if constexpr(std::is_same_v<T, s32>) return "s32";
+    else if constexpr(std::is_same_v<T, s64>) return "s64";
+    else return "";
+}
+
+namespace detail {
+/**
+ * @brief Make an input depending on the previous result without changing its value.
+ *
+ * The bits of the previous result are masked by a zero that the compiler cannot see.
+ *
+ * @tparam T The input type.
+ * @tparam R The result type.
+ * @param input The input.
+ * @param previous The previous result.
+ * @param zero A mask with all bits to zero.
+ * @return The input.
+ */
+template<class T, class R>
+[[nodiscard]] inline T chain(const T& input, const R& previous, const u64& zero) noexcept {
+    if constexpr(sizeof(T) == sizeof(u32) && sizeof(R) == sizeof(u32)) {
+        return std::bit_cast<T>(std::bit_cast<u32>(input) | (std::bit_cast<u32>(previous) & static_cast<u32>(zero)));
+    } else if constexpr(sizeof(T) == sizeof(u64) && sizeof(R) == sizeof(u64)) {
+        return std::bit_cast<T>(std::bit_cast<u64>(input) | (std::bit_cast<u64>(previous) & zero));
+    } else if constexpr(sizeof(T) == sizeof(u64) && sizeof(R) == sizeof(u32)) {
+        return std::bit_cast<T>(std::bit_cast<u64>(input) | (u64(std::bit_cast<u32>(previous)) & zero));
+    } else if constexpr(sizeof(T) == sizeof(u32) && sizeof(R) == sizeof(u64)) {
+        return std::bit_cast<T>(std::bit_cast<u32>(input) | (u32(std::bit_cast<u64>(previous)) & static_cast<u32>(zero)));
+    } else {
+        (void)previous;
+        (void)zero;
+        return input;
+    }
+}
+}// namespace detail
+
+/**
+ * @brief The benchmark runner, measure and record the results
+ */
+class Runner {
+public:
+    /**
+     * @brief Constructor.
+     * @param options The options of the runner.
+     */
+    explicit Runner(Options options= {});
+    /**
+     * @brief Access to the hardware counters.
+     * @return The counters, null if they are not requested in the options.
+     */
+    [[nodiscard]] const PerfCounters* counters() const noexcept { return m_counters.get(); }
+
+    /**
+     * @brief Run a benchmark body.
+     *
+     * The body receives a number of iterations and must execute that number of times
+     * the benchmarked code.
+     *
+     * @param name The name of the benchmark (prefixed by the current group).
+     * @param mode The mode of the benchmark.
+     * @param body The body.
+     * @param itemsPerIteration Number of operations done by one iteration.
+     * @param type The data type processed by the benchmark.
+     */
+    void run(const std::string& name, Mode mode, const std::function<void(u64)>& body, u64 itemsPerIteration= 1, const std::string& type= {});
+
+    /**
+     * @brief Measure the latency of a function: each call depends on the previous result.
+     * @tparam T The input type.
+     * @tparam F The function type.
+     * @param name The name of the benchmark.
+     * @param inputs The inputs, the size must be a power of 2.
+     * @param f The function to call.
+     */
+    template<class T, class F>
+    void latency(const std::string& name, const std::vector<T>& inputs, F f) {
+        const size_t mask= inputs.size() - 1;
+        const T* data    = inputs.data();
+        u64 zero         = 0;
+        const auto body  = [&](u64 iterations) {
+            doNotOptimize(zero);
+            auto previous= f(data[0]);
+            for(u64 i= 0; i < iterations; ++i) previous= f(detail::chain(data[i & mask], previous, zero));
+            doNotOptimize(previous);
+        };
+        run(name, Mode::Latency, body, 1, typeName<T>());
+    }
+
+    /**
+     * @brief Measure the throughput of a function: calls are independent.
+     * @tparam T The input type.
+     * @tparam F The function type.
+     * @param name The name of the benchmark.
+     * @param inputs The inputs, the size must be a power of 2.
+     * @param f The function to call.
+     */
+    template<class T, class F>
+    void throughput(const std::string& name, const std::vector<T>& inputs, F f) {
+        const size_t mask= inputs.size() - 1;
+        const T* data    = inputs.data();
+        const auto body  = [&](u64 iterations) {
+            for(u64 i= 0; i < iterations; ++i) doNotOptimize(f(data[i & mask]));
+        };
+        run(name, Mode::Throughput, body, 1, typeName<T>());
+    }
+
+    /**
+     * @brief Measure both latency and throughput of a function.
+     * @tparam T The input type.
+     * @tparam F The function type.
+     * @param name The name of the benchmark.
+     * @param inputs The inputs, the size must be a power of 2.
+     * @param f The function to call.
+     */
+    template<class T, class F>
+    void measure(const std::string& name, const std::vector<T>& inputs, F f) {
+        latency(name, inputs, f);
+        throughput(name, inputs, f);
+    }
+
+    /**
+     * @brief Measure an array function, the time is given per element.
+     * @tparam T The element type.
+     * @tparam F The function type.
+     * @param name The name of the benchmark.
+     * @param size The number of elements processed by one call.
+     * @param f The function to call.
+     */
+    template<class T= void, class F>
+    void batch(const std::string& name, u64 size, F f) {
+        const auto body= [&](u64 iterations) {
+            for(u64 i= 0; i < iterations; ++i) {
+                f();
+                clobberMemory();
+            }
+        };
+        run(name, Mode::Batch, body, size, typeName<T>());
+    }
+
+    /**
+     * @brief Define the group of the following benchmarks.
+     * @param group The group name.
+     */
+    void setGroup(const std::string& group) { m_group= group; }
+    /**
+     * @brief Access to the options.
+     * @return The options.
+     */
+    [[nodiscard]] const Options& options() const noexcept { return m_options; }
+    /**
+     * @brief Access to the results.
+     * @return The results.
+     */
+    [[nodiscard]] const std::vector<Result>& results() const noexcept { return m_results; }
+
+private:
+    /**
+     * @brief Time a number of iterations of a body.
+     * @param body The body.
+     * @param iterations The number of iterations.
+     * @param cycles Receive the number of elapsed reference cycles.
+     * @return The duration in nanoseconds.
+     */
+    [[nodiscard]] static f64 timeIt(const std::function<void(u64)>& body, u64 iterations, f64& cycles);
+    std::unique_ptr<PerfCounters> m_counters;///< hardware counters, null if not requested
+    Options m_options;            ///< the options
+    std::string m_group;          ///< the current group
+    std::vector<Result> m_results;///< the results
+};
+
+/**
+ * @brief Print a result line.
+ * @param os The output stream.
+ * @param result The result to print.
+ */
+void printResult(std::ostream& os, const Result& result);
+/**
+ * @brief Print the header of the result table.
+ * @param os The output stream.
+ */
+void printHeader(std::ostream& os);
+
+/**
+ * @brief Signature of a benchmark function
+ */
+using BenchmarkFunction= void (*)(Runner&);
+
+/**
+ * @brief Registration of a benchmark function, used by FLN_BENCHMARK
+ */
+struct Registration {
+    /**
+     * @brief Register a benchmark function.
+     * @param group The group of the benchmark.
+     * @param function The function.
+     */
+    Registration(const char* group, BenchmarkFunction function);
+};
+
+/**
+ * @brief Get all the registered benchmarks.
+ * @return The list of group names and functions.
+ */
+[[nodiscard]] std::vector<std::pair<std::string, BenchmarkFunction>>& registry();
+
+/**
+ * @brief Run all registered benchmarks.
+ * @param runner The runner to use.
+ */
+void runAll(Runner& runner);
+
+}// namespace fln::bench
+
+/**
+ * @brief Define a benchmark function, registered at startup.
+ *
+ * The body has access to a fln::bench::Runner named runner.
+ */
+#define FLN_BENCHMARK(GROUP)                                                                        \
+    static void fln_bench_##GROUP(fln::bench::Runner& runner);                                      \
+    static const fln::bench::Registration fln_bench_registration_##GROUP(#GROUP, fln_bench_##GROUP);\
+    static void fln_bench_##GROUP(fln::bench::Runner& runner)
@@ -0,0 +1,90 @@
+/**
+ * \file compare.cpp
+ *
+ * \date 17/10/2026
+ * \author Silmaen
+ */
+#include "report.h"
+
+namespace {
+
+void usage(const char* program) {
+    std::cout << "usage: " << program << " <baseline> <current> [options]" << std::endl
+              << "  compare two result files written by fln_bench (JSON or CSV)" << std::endl
+              << "  --threshold <percent>  minimal relative change to report (default 5)" << std::endl
+              << "  --noise <k>            changes smaller than k combined MAD are noise (default 3)" << std::endl
+              << "  --all                  print also the unchanged benchmarks" << std::endl
+              << "  exit code is 1 if a regression is found, 2 on error" << std::endl;
+}
+
+fln::bench::Report load(const std::string& path) {
+    std::ifstream file(path);
+    if(!file) throw std::runtime_error("unable to open " + path);
+    return fln::bench::readReport(file);
+}
+
+void printContext(const char* title, const fln::bench::Context& context) {
+    std::cout << title << context.date << " " << context.config << " | " << context.cpu << " | " << context.compiler << std::endl;
+}
+
+}// namespace
+
+int main(int argc, char* argv[]) {
+    std::vector<std::string> files;
+    fln::f64 threshold  = 5.0;
+    fln::f64 noiseFactor= 3.0;
+    bool all            = false;
+    int i= 1;
+    try {
+        for(; i < argc; ++i) {
+            const std::string arg(argv[i]);
+            const bool hasValue= i + 1 < argc;
+            if(arg == "--threshold" && hasValue) {
+                threshold= std::stod(argv[++i]);
+            } else if(arg == "--noise" && hasValue) {
+                noiseFactor= std::stod(argv[++i]);
+            } else if(arg == "--all") {
+                all= true;
+            } else if(arg.rfind("--", 0) == 0) {
+                usage(argv[0]);
+                return arg == "--help" ? 0 : 2;
+            } else {
+                files.push_back(arg);
+            }
+        }
+    } catch(const std::logic_error&) {
+        // std::invalid_argument or std::out_of_range of the number conversions
+        std::cerr << "invalid value for " << argv[i - 1] << ": " << argv[i] << std::endl;
+        usage(argv[0]);
+        return 2;
+    }
+    if(files.size() != 2) {
+        usage(argv[0]);
+        return 2;
+    }
+    try {
+        const auto baseline= load(files[0]);
+        const auto current = load(files[1]);
+        printContext("baseline: ", baseline.context);
+        printContext("current:  ", current.context);
+        if(baseline.context.cpu != current.context.cpu || baseline.context.config != current.context.config)
+            std::cout << "warning: the results come from different machines or configurations" << std::endl;
+        fln::u32 regressions= 0;
+        const auto comparisons= fln::bench::compare(baseline.results, current.results, threshold / 100.0, noiseFactor);
+        std::cout << std::left << std::setw(56) << "benchmark" << std::setw(11) << "mode" << std::right
+                  << std::setw(11) << "baseline" << std::setw(11) << "current" << std::setw(10) << "change" << "  verdict" << std::endl;
+        for(const auto& comparison: comparisons) {
+            if(comparison.verdict == fln::bench::Verdict::Regression) ++regressions;
+            if(!all && comparison.verdict == fln::bench::Verdict::Same) continue;
+            std::cout << std::left << std::setw(56) << comparison.name << std::setw(11) << fln::bench::modeName(comparison.mode) << std::right
+                      << std::fixed << std::setprecision(3) << std::setw(11) << comparison.baseline << std::setw(11) << comparison.current
+                      << std::setprecision(1) << std::showpos << std::setw(9) << 100.0 * comparison.change << "%" << std::noshowpos
+                      << "  " << fln::bench::verdictName(comparison.verdict) << std::endl;
+        }
+        std::cout << regressions << " regression(s) over " << comparisons.size() << " benchmarks" << std::endl;
+        return regressions > 0 ? 1 : 0;
+    } catch(const std::exception& e) {
+        std::cerr << "error: " << e.what() << std::endl;
+        return 2;
+    }
+}
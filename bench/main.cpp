@@ -0,0 +1,85 @@
+/**
+ * \file main.cpp
+ *
+ * \date 17/10/2026
+ * \author Silmaen
+ */
+#include "report.h"
+
+namespace {
+
+void usage(const char* program) {
+    std::cout << "usage: " << program << " [options]" << std::endl
+              << "  --filter <text>    run only the benchmarks whose name contains <text>" << std::endl
+              << "  --samples <n>      number of samples per benchmark (default 30)" << std::endl
+              << "  --min-time <ms>    minimal duration of a sample in milliseconds (default 2)" << std::endl
+              << "  --warmup <ms>      warmup duration in milliseconds (default 20)" << std::endl
+              << "  --outlier <k>      reject samples further than k MAD from the median (default 3.5)" << std::endl
+              << "  --perf             collect hardware counters (cycles, instructions, misses) if available" << std::endl
+              << "  --json <file>      write the results in JSON" << std::endl
+              << "  --csv <file>       write the results in CSV" << std::endl
+              << "  --list             list the benchmark groups" << std::endl;
+}
+
+}// namespace
+
+int main(int argc, char* argv[]) {
+    fln::bench::Options options;
+    std::string jsonFile;
+    std::string csvFile;
+    int i= 1;
+    try {
+        for(; i < argc; ++i) {
+            const std::string arg(argv[i]);
+            const bool hasValue= i + 1 < argc;
+            if(arg == "--filter" && hasValue) {
+                options.filter= argv[++i];
+            } else if(arg == "--samples" && hasValue) {
+                options.samples= static_cast<fln::u32>(std::stoul(argv[++i]));
+            } else if(arg == "--min-time" && hasValue) {
+                options.minSampleTime= std::stod(argv[++i]);
+            } else if(arg == "--warmup" && hasValue) {
+                options.warmupTime= std::stod(argv[++i]);
+            } else if(arg == "--outlier" && hasValue) {
+                options.outlierThreshold= std::stod(argv[++i]);
+            } else if(arg == "--perf") {
+                options.perfCounters= true;
+            } else if(arg == "--json" && hasValue) {
+                jsonFile= argv[++i];
+            } else if(arg == "--csv" && hasValue) {
+                csvFile= argv[++i];
+            } else if(arg == "--list") {
+                for(const auto& benchmark: fln::bench::registry()) std::cout << benchmark.first << std::endl;
+                return 0;
+            } else {
+                usage(argv[0]);
+                return arg == "--help" ? 0 : 1;
+            }
+        }
+    } catch(const std::logic_error&) {
+        // std::invalid_argument or std::out_of_range of the number conversions
+        std::cerr << "invalid value for " << argv[i - 1] << ": " << argv[i] << std::endl;
+        usage(argv[0]);
+        return 1;
+    }
+    fln::bench::Runner runner(options);
+    fln::bench::runAll(runner);
+    const fln::bench::Report report{fln::bench::hostContext(), runner.results()};
+    if(!jsonFile.empty()) {
+        std::ofstream file(jsonFile);
+        fln::bench::writeJson(file, report);
+        if(!file) {
+            std::cerr << "unable to write " << jsonFile << std::endl;
+            return 1;
+        }
+    }
+    if(!csvFile.empty()) {
+        std::ofstream file(csvFile);
+        fln::bench::writeCsv(file, report);
+        if(!file) {
+            std::cerr << "unable to write " << csvFile << std::endl;
+            return 1;
+        }
+    }
+    return 0;
+}
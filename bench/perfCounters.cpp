@@ -0,0 +1,119 @@
+/**
+ * \file perfCounters.cpp
+ *
+ * \date 17/10/2026
+ * \author Silmaen
+ */
+#include "perfCounters.h"
+
+#if defined(__linux__)
+#define FLN_BENCH_PERF
+#include <asm/unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+#endif
+
+namespace fln::bench {
+
+const char* eventName(Event event) noexcept {
+    switch(event) {
+    case Event::Cycles:
+        return "cycles";
+    case Event::Instructions:
+        return "instructions";
+    case Event::BranchMisses:
+        return "branch_misses";
+    case Event::CacheMisses:
+        return "cache_misses";
+    case Event::Count:
+        break;
+    }
+    return "unknown";
+}
+
+#ifdef FLN_BENCH_PERF
+
+namespace {
+
+/**
+ * @brief Open one hardware event for the calling thread.
+ * @param config The perf hardware event id.
+ * @return The file descriptor, -1 on failure (errno is set).
+ */
+int openEvent(u64 config) noexcept {
+    perf_event_attr attr{};
+    attr.type          = PERF_TYPE_HARDWARE;
+    attr.size          = sizeof(perf_event_attr);
+    attr.config        = config;
+    attr.disabled      = 1;
+    attr.exclude_kernel= 1;
+    attr.exclude_hv    = 1;
+    attr.read_format   = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+}// namespace
+
+PerfCounters::PerfCounters() {
+    constexpr std::array<u64, eventCount> configs{PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_BRANCH_MISSES, PERF_COUNT_HW_CACHE_MISSES};
+    for(size_t i= 0; i < eventCount; ++i) {
+        m_fd[i]= openEvent(configs[i]);
+        if(m_fd[i] < 0 && m_error.empty())
+            m_error= std::string("perf_event_open(") + eventName(static_cast<Event>(i)) + "): " + std::strerror(errno);
+    }
+    if(available()) m_error.clear();
+}
+
+PerfCounters::~PerfCounters() {
+    for(auto fd: m_fd)
+        if(fd >= 0) close(fd);
+}
+
+bool PerfCounters::available() const noexcept {
+    for(auto fd: m_fd)
+        if(fd >= 0) return true;
+    return false;
+}
+
+void PerfCounters::start() noexcept {
+    for(auto fd: m_fd) {
+        if(fd < 0) continue;
+        ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+}
+
+CounterValues PerfCounters::stop() noexcept {
+    for(auto fd: m_fd)
+        if(fd >= 0) ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+    CounterValues result;
+    for(size_t i= 0; i < eventCount; ++i) {
+        if(m_fd[i] < 0) continue;
+        // value, time enabled, time running
+        std::array<u64, 3> data{};
+        if(read(m_fd[i], data.data(), sizeof(data)) != static_cast<ssize_t>(sizeof(data)) || data[2] == 0) continue;
+        result.values[i]= static_cast<f64>(data[0]) * static_cast<f64>(data[1]) / static_cast<f64>(data[2]);
+        result.valid[i] = true;
+    }
+    return result;
+}
+
+#else
+
+PerfCounters::PerfCounters():
+    m_error{"hardware counters are only supported on Linux"} { m_fd.fill(-1); }
+
+PerfCounters::~PerfCounters()= default;
+
+bool PerfCounters::available() const noexcept { return false; }
+
+void PerfCounters::start() noexcept {}
+
+CounterValues PerfCounters::stop() noexcept { return {}; }
+
+#endif
+
+}// namespace fln::bench
@@ -0,0 +1,120 @@
+/**
+ * \file perfCounters.h
+ *
+ * \date 17/10/2026
+ * \author Silmaen
+ */
+#pragma once
+#include "baseType.h"
+#include <array>
+#include <string>
+
+namespace fln::bench {
+
+/**
+ * @brief Hardware events that can be counted
+ */
+enum struct Event {
+    Cycles,      ///< core cycles
+    Instructions,///< retired instructions
+    BranchMisses,///< mispredicted branches
+    CacheMisses, ///< last level cache misses
+    Count        ///< number of events
+};
+
+/// number of hardware events
+constexpr size_t eventCount= static_cast<size_t>(Event::Count);
+
+/**
+ * @brief Get the name of an event.
+ * @param event The event.
+ * @return The event's name.
+ */
+[[nodiscard]] const char* eventName(Event event) noexcept;
+
+/**
+ * @brief Values of the hardware counters
+ */
+struct CounterValues {
+    std::array<f64, eventCount> values{};///< the value of each event
+    std::array<bool, eventCount> valid{};///< true if the event has been counted
+    /**
+     * @brief Access to the value of an event.
+     * @param event The event.
+     * @return The value, 0 if not counted.
+     */
+    [[nodiscard]] f64 operator[](Event event) const noexcept { return values[static_cast<size_t>(event)]; }
+    /**
+     * @brief Check if an event has been counted.
+     * @param event The event.
+     * @return True if the value is meaningful.
+     */
+    [[nodiscard]] bool has(Event event) const noexcept { return valid[static_cast<size_t>(event)]; }
+    /**
+     * @brief Check if at least one event has been counted.
+     * @return True if any value is meaningful.
+     */
+    [[nodiscard]] bool any() const noexcept {
+        for(auto v: valid)
+            if(v) return true;
+        return false;
+    }
+    /**
+     * @brief Get the number of instructions per cycle.
+     * @return The IPC, 0 if cycles or instructions are not counted.
+     */
+    [[nodiscard]] f64 ipc() const noexcept {
+        if(!has(Event::Cycles) || !has(Event::Instructions) || (*this)[Event::Cycles] <= 0) return 0;
+        return (*this)[Event::Instructions] / (*this)[Event::Cycles];
+    }
+};
+
+/**
+ * @brief Hardware performance counters of the calling thread (perf_event_open on Linux)
+ *
+ * Only user space is counted, which is allowed with the default perf_event_paranoid
+ * level. Every event is opened separately: when an event (or the whole perf subsystem,
+ * as in many containers and virtual machines) is not available, it is simply reported
+ * as not counted. On other systems no event is ever available.
+ */
+class PerfCounters {
+public:
+    /**
+     * @brief Open the counters, they are stopped.
+     */
+    PerfCounters();
+    /**
+     * @brief Close the counters.
+     */
+    ~PerfCounters();
+    PerfCounters(const PerfCounters&)           = delete;
+    PerfCounters& operator=(const PerfCounters&)= delete;
+    /**
+     * @brief Check if at least one event can be counted.
+     * @return True if counters are available.
+     */
+    [[nodiscard]] bool available() const noexcept;
+    /**
+     * @brief Get the reason why the counters are not available.
+     * @return The error message, empty if available.
+     */
+    [[nodiscard]] const std::string& error() const noexcept { return m_error; }
+    /**
+     * @brief Reset and start the counters.
+     */
+    void start() noexcept;
+    /**
+     * @brief Stop the counters and read them.
+     *
+     * Values are scaled if the kernel had to multiplex the counters.
+     *
+     * @return The counted values.
+     */
+    CounterValues stop() noexcept;
+
+private:
+    std::array<int, eventCount> m_fd{};///< file descriptors of the events (-1 if not available)
+    std::string m_error;               ///< error message of the first failed event
+};
+
+}// namespace fln::bench
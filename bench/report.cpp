@@ -0,0 +1,484 @@
+/**
+ * \file report.cpp
+ *
+ * \date 17/10/2026
+ * \author Silmaen
+ */
+#include "report.h"
+#include <ctime>
+#include <map>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define FLN_BENCH_CPUID
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace fln::bench {
+
+namespace {
+
+/// fields of one result, as text
+using Fields= std::map<std::string, std::string>;
+
+/// the columns of the result records
+const std::vector<std::string> resultColumns{"name", "mode", "type", "iterations", "items", "ns_per_op", "cycles_per_op", "mad", "mean", "stddev", "min", "max", "p05", "p95", "p99", "samples", "rejected", "ipc", "hw_cycles", "instructions", "branch_misses", "cache_misses"};
+/// the columns of the context
+const std::vector<std::string> contextColumns{"config", "cpu", "compiler", "date"};
+
+/**
+ * @brief Remove leading and trailing spaces.
+ * @param str The string.
+ * @return The trimmed string.
+ */
+std::string trim(const std::string& str) {
+    const auto first= str.find_first_not_of(" \t\r\n");
+    if(first == std::string::npos) return {};
+    return str.substr(first, str.find_last_not_of(" \t\r\n") - first + 1);
+}
+
+/**
+ * @brief Format a number so that it can be read back.
+ * @param value The number.
+ * @return The text.
+ */
+std::string number(f64 value) {
+    std::ostringstream oss;
+    oss << std::setprecision(10) << value;
+    return oss.str();
+}
+
+/**
+ * @brief Get the text fields of a result.
+ * @param result The result.
+ * @return The fields.
+ */
+Fields toFields(const Result& result) {
+    Fields fields{{"name", result.name}, {"mode", modeName(result.mode)}, {"type", result.type}, {"iterations", std::to_string(result.iterations)}, {"items", std::to_string(result.itemsPerIteration)}, {"ns_per_op", number(result.time.median)}, {"cycles_per_op", number(result.cycles)}, {"mad", number(result.time.mad)}, {"mean", number(result.time.mean)}, {"stddev", number(result.time.stdDeviation)}, {"min", number(result.time.min)}, {"max", number(result.time.max)}, {"p05", number(result.time.p05)}, {"p95", number(result.time.p95)}, {"p99", number(result.time.p99)}, {"samples", std::to_string(result.time.samples)}, {"rejected", std::to_string(result.time.rejected)}};
+    // not counted events are written as empty strings (null in JSON)
+    const auto counter= [&](Event event) { return result.counters.has(event) ? number(result.counters[event]) : std::string{}; };
+    fields["ipc"]          = result.counters.has(Event::Cycles) && result.counters.has(Event::Instructions) ? number(result.counters.ipc()) : std::string{};
+    fields["hw_cycles"]    = counter(Event::Cycles);
+    fields["instructions"] = counter(Event::Instructions);
+    fields["branch_misses"]= counter(Event::BranchMisses);
+    fields["cache_misses"] = counter(Event::CacheMisses);
+    return fields;
+}
+
+/**
+ * @brief Build a result from its text fields, missing numbers are set to 0.
+ * @param fields The fields.
+ * @return The result.
+ */
+Result fromFields(const Fields& fields) {
+    const auto text= [&](const std::string& key) -> std::string {
+        const auto it= fields.find(key);
+        return it == fields.end() ? std::string{} : it->second;
+    };
+    const auto real= [&](const std::string& key) -> f64 {
+        const auto value= text(key);
+        return value.empty() ? 0.0 : std::stod(value);
+    };
+    Result result;
+    result.name             = text("name");
+    result.mode             = modeFromName(text("mode"));
+    result.type             = text("type");
+    result.iterations       = static_cast<u64>(real("iterations"));
+    result.itemsPerIteration= static_cast<u64>(real("items"));
+    result.cycles           = real("cycles_per_op");
+    result.time.median      = real("ns_per_op");
+    result.time.mad         = real("mad");
+    result.time.mean        = real("mean");
+    result.time.stdDeviation= real("stddev");
+    result.time.min         = real("min");
+    result.time.max         = real("max");
+    result.time.p05         = real("p05");
+    result.time.p95         = real("p95");
+    result.time.p99         = real("p99");
+    result.time.samples     = static_cast<u32>(real("samples"));
+    result.time.rejected    = static_cast<u32>(real("rejected"));
+    const auto counter      = [&](Event event, const std::string& key) {
+        const auto index            = static_cast<size_t>(event);
+        result.counters.valid[index]= !text(key).empty();
+        result.counters.values[index]= real(key);
+    };
+    counter(Event::Cycles, "hw_cycles");
+    counter(Event::Instructions, "instructions");
+    counter(Event::BranchMisses, "branch_misses");
+    counter(Event::CacheMisses, "cache_misses");
+    return result;
+}
+
+/**
+ * @brief Get the text fields of a context.
+ * @param context The context.
+ * @return The fields.
+ */
+Fields toFields(const Context& context) {
+    return {{"config", context.config}, {"cpu", context.cpu}, {"compiler", context.compiler}, {"date", context.date}};
+}
+
+/**
+ * @brief Build a context from its text fields.
+ * @param fields The fields.
+ * @return The context.
+ */
+Context contextFromFields(const Fields& fields) {
+    Context context;
+    for(const auto& [key, value]: fields) {
+        if(key == "config") context.config= value;
+        else if(key == "cpu") context.cpu= value;
+        else if(key == "compiler") context.compiler= value;
+        else if(key == "date") context.date= value;
+    }
+    return context;
+}
+
+/**
+ * @brief Write a JSON string with escapes.
+ * @param os The output stream.
+ * @param str The string.
+ */
+void jsonString(std::ostream& os, const std::string& str) {
+    os << '"';
+    for(char c: str) {
+        switch(c) {
+        case '"': os << "\\\""; break;
+        case '\\': os << "\\\\"; break;
+        case '\n': os << "\\n"; break;
+        case '\t': os << "\\t"; break;
+        default:
+            if(static_cast<unsigned char>(c) < 0x20) os << ' ';
+            else os << c;
+        }
+    }
+    os << '"';
+}
+
+/**
+ * @brief Write a JSON object.
+ * @param os The output stream.
+ * @param fields The fields of the object.
+ * @param columns The order of the fields.
+ * @param textColumns The number of leading columns that are strings, the others are numbers.
+ */
+void jsonObject(std::ostream& os, const Fields& fields, const std::vector<std::string>& columns, size_t textColumns) {
+    os << "{";
+    for(size_t i= 0; i < columns.size(); ++i) {
+        if(i > 0) os << ", ";
+        jsonString(os, columns[i]);
+        os << ": ";
+        if(i < textColumns) jsonString(os, fields.at(columns[i]));
+        else if(fields.at(columns[i]).empty()) os << "null";
+        else os << fields.at(columns[i]);
+    }
+    os << "}";
+}
+
+/**
+ * @brief Write a CSV field, quoted if needed.
+ * @param os The output stream.
+ * @param str The field.
+ */
+void csvField(std::ostream& os, const std::string& str) {
+    if(str.find_first_of(",\"\n") == std::string::npos) {
+        os << str;
+        return;
+    }
+    os << '"';
+    for(char c: str) {
+        if(c == '"') os << '"';
+        os << c;
+    }
+    os << '"';
+}
+
+/**
+ * @brief Split a CSV line in fields.
+ * @param line The line.
+ * @return The fields.
+ */
+std::vector<std::string> csvSplit(const std::string& line) {
+    std::vector<std::string> fields(1);
+    bool quoted= false;
+    for(size_t i= 0; i < line.size(); ++i) {
+        const char c= line[i];
+        if(quoted) {
+            if(c == '"' && i + 1 < line.size() && line[i + 1] == '"') {
+                fields.back()+= '"';
+                ++i;
+            } else if(c == '"') {
+                quoted= false;
+            } else {
+                fields.back()+= c;
+            }
+        } else if(c == '"') {
+            quoted= true;
+        } else if(c == ',') {
+            fields.emplace_back();
+        } else if(c != '\r') {
+            fields.back()+= c;
+        }
+    }
+    return fields;
+}
+
+/**
+ * @brief Minimal reader for the JSON written by writeJson
+ *
+ * Only objects, arrays, strings and numbers are supported; numbers are kept as text.
+ */
+class JsonReader {
+public:
+    explicit JsonReader(std::istream& is):
+        m_is{is} {}
+    /**
+     * @brief Read the whole report.
+     * @return The report.
+     */
+    Report report() {
+        Report result;
+        expect('{');
+        if(next() == '}') return result;
+        do {
+            const std::string key= string();
+            expect(':');
+            if(key == "context") {
+                result.context= contextFromFields(flatObject());
+            } else if(key == "results") {
+                expect('[');
+                if(next() != ']') {
+                    do { result.results.push_back(fromFields(flatObject())); } while(separator(']'));
+                } else {
+                    expect(']');
+                }
+            } else {
+                (void)scalar();
+            }
+        } while(separator('}'));
+        return result;
+    }
+
+private:
+    /// get the next non space character without consuming it
+    char next() {
+        m_is >> std::ws;
+        const auto c= m_is.peek();
+        if(c == std::char_traits<char>::eof()) throw std::runtime_error("unexpected end of JSON");
+        return static_cast<char>(c);
+    }
+    /// consume the expected character
+    void expect(char c) {
+        if(next() != c) throw std::runtime_error(std::string("JSON: expected '") + c + "'");
+        m_is.get();
+    }
+    /// consume a ',' and return true, or the closing character and return false
+    bool separator(char close) {
+        const char c= next();
+        m_is.get();
+        if(c == ',') return true;
+        if(c == close) return false;
+        throw std::runtime_error(std::string("JSON: expected ',' or '") + close + "'");
+    }
+    /// read a string
+    std::string string() {
+        expect('"');
+        std::string result;
+        for(int c= m_is.get(); c != '"'; c= m_is.get()) {
+            if(c == std::char_traits<char>::eof()) throw std::runtime_error("JSON: unterminated string");
+            if(c == '\\') {
+                c= m_is.get();
+                if(c == 'n') c= '\n';
+                else if(c == 't') c= '\t';
+                else if(c == 'u') {
+                    for(int i= 0; i < 4; ++i) m_is.get();
+                    c= '?';
+                }
+            }
+            result+= static_cast<char>(c);
+        }
+        return result;
+    }
+    /// read a string or a number as text
+    std::string scalar() {
+        if(next() == '"') return string();
+        std::string result;
+        while(m_is.peek() != std::char_traits<char>::eof() && std::string(",}] \t\r\n").find(static_cast<char>(m_is.peek())) == std::string::npos)
+            result+= static_cast<char>(m_is.get());
+        if(result.empty()) throw std::runtime_error("JSON: expected a value");
+        return result == "null" ? std::string{} : result;
+    }
+    /// read an object whose values are scalars
+    Fields flatObject() {
+        Fields result;
+        expect('{');
+        if(next() == '}') {
+            m_is.get();
+            return result;
+        }
+        do {
+            const std::string key= string();
+            expect(':');
+            result[key]= scalar();
+        } while(separator('}'));
+        return result;
+    }
+    std::istream& m_is;///< the input
+};
+
+}// namespace
+
+Context hostContext() {
+    Context context;
+    context.config= configName;
+#ifdef FLN_BENCH_CPUID
+    std::array<u32, 12> brand{};
+    u32 eax= 0, ebx= 0, ecx= 0, edx= 0;
+#if defined(_MSC_VER)
+    int regs[4];
+    __cpuid(regs, 0x80000000);
+    eax= static_cast<u32>(regs[0]);
+#else
+    __get_cpuid(0x80000000, &eax, &ebx, &ecx, &edx);
+#endif
+    if(eax >= 0x80000004) {
+        for(u32 i= 0; i < 3; ++i) {
+#if defined(_MSC_VER)
+            __cpuid(regs, static_cast<int>(0x80000002 + i));
+            for(u32 j= 0; j < 4; ++j) brand[4 * i + j]= static_cast<u32>(regs[j]);
+#else
+            __get_cpuid(0x80000002 + i, &brand[4 * i], &brand[4 * i + 1], &brand[4 * i + 2], &brand[4 * i + 3]);
+#endif
+        }
+        std::string name(reinterpret_cast<const char*>(brand.data()), sizeof(brand));
+        context.cpu= trim(name.c_str());
+    }
+#endif
+    if(context.cpu.empty()) {
+        std::ifstream cpuinfo("/proc/cpuinfo");
+        std::string line;
+        while(context.cpu.empty() && std::getline(cpuinfo, line)) {
+            const auto colon= line.find(':');
+            if(colon == std::string::npos) continue;
+            const auto key= trim(line.substr(0, colon));
+            if(key == "model name" || key == "Hardware" || key == "cpu model") context.cpu= trim(line.substr(colon + 1));
+        }
+    }
+    if(context.cpu.empty()) context.cpu= "unknown";
+#if defined(__clang__)
+    context.compiler= "clang " __clang_version__;
+#elif defined(__GNUC__)
+    context.compiler= "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+    context.compiler= "msvc " + std::to_string(_MSC_FULL_VER);
+#else
+    context.compiler= "unknown";
+#endif
+    context.compiler= trim(context.compiler);
+    std::array<char, 32> date{};
+    const std::time_t now= std::time(nullptr);
+    if(std::strftime(date.data(), date.size(), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now)) > 0) context.date= date.data();
+    return context;
+}
+
+void writeJson(std::ostream& os, const Report& report) {
+    os << "{\n  \"context\": ";
+    jsonObject(os, toFields(report.context), contextColumns, contextColumns.size());
+    os << ",\n  \"results\": [";
+    for(size_t i= 0; i < report.results.size(); ++i) {
+        os << (i > 0 ? ",\n    " : "\n    ");
+        jsonObject(os, toFields(report.results[i]), resultColumns, 3);
+    }
+    os << "\n  ]\n}\n";
+}
+
+void writeCsv(std::ostream& os, const Report& report) {
+    bool first= true;
+    for(const auto& column: resultColumns) {
+        os << (first ? "" : ",") << column;
+        first= false;
+    }
+    for(const auto& column: contextColumns) os << "," << column;
+    os << "\n";
+    const auto context= toFields(report.context);
+    for(const auto& result: report.results) {
+        const auto fields= toFields(result);
+        first            = true;
+        for(const auto& column: resultColumns) {
+            if(!first) os << ",";
+            csvField(os, fields.at(column));
+            first= false;
+        }
+        for(const auto& column: contextColumns) {
+            os << ",";
+            csvField(os, context.at(column));
+        }
+        os << "\n";
+    }
+}
+
+Report readReport(std::istream& is) {
+    is >> std::ws;
+    if(is.peek() == '{') return JsonReader(is).report();
+    Report report;
+    std::string line;
+    if(!std::getline(is, line)) return report;
+    const auto header= csvSplit(line);
+    while(std::getline(is, line)) {
+        if(trim(line).empty()) continue;
+        const auto values= csvSplit(line);
+        if(values.size() != header.size()) throw std::runtime_error("CSV: wrong number of fields in line: " + line);
+        Fields fields;
+        for(size_t i= 0; i < header.size(); ++i) fields[header[i]]= values[i];
+        report.context= contextFromFields(fields);
+        report.results.push_back(fromFields(fields));
+    }
+    return report;
+}
+
+const char* verdictName(Verdict verdict) noexcept {
+    switch(verdict) {
+    case Verdict::Same:
+        return "same";
+    case Verdict::Improvement:
+        return "improvement";
+    case Verdict::Regression:
+        return "REGRESSION";
+    case Verdict::Missing:
+        return "missing";
+    case Verdict::New:
+        return "new";
+    }
+    return "unknown";
+}
+
+std::vector<Comparison> compare(const std::vector<Result>& baseline, const std::vector<Result>& current, f64 threshold, f64 noiseFactor) {
+    const auto find= [](const std::vector<Result>& results, const Result& key) {
+        return std::find_if(results.begin(), results.end(), [&](const Result& r) { return r.name == key.name && r.mode == key.mode; });
+    };
+    std::vector<Comparison> comparisons;
+    for(const auto& base: baseline) {
+        Comparison comparison{base.name, base.mode, base.time.median, 0, 0, Verdict::Missing};
+        const auto it= find(current, base);
+        if(it != current.end()) {
+            comparison.current= it->time.median;
+            comparison.change = base.time.median > 0 ? (it->time.median - base.time.median) / base.time.median : 0;
+            const f64 noise   = noiseFactor * std::sqrt(base.time.mad * base.time.mad + it->time.mad * it->time.mad);
+            if(std::abs(comparison.change) <= threshold || std::abs(it->time.median - base.time.median) <= noise)
+                comparison.verdict= Verdict::Same;
+            else
+                comparison.verdict= comparison.change > 0 ? Verdict::Regression : Verdict::Improvement;
+        }
+        comparisons.push_back(comparison);
+    }
+    for(const auto& cur: current) {
+        if(find(baseline, cur) == baseline.end())
+            comparisons.push_back({cur.name, cur.mode, 0, cur.time.median, 0, Verdict::New});
+    }
+    return comparisons;
+}
+
+}// namespace fln::bench
@@ -0,0 +1,101 @@
+/**
+ * \file report.h
+ *
+ * \date 17/10/2026
+ * \author Silmaen
+ */
+#pragma once
+#include "benchmark.h"
+
+namespace fln::bench {
+
+/**
+ * @brief Description of the machine and the build that produced results
+ */
+struct Context {
+    std::string config  = {};///< build configuration (see configName)
+    std::string cpu     = {};///< CPU model
+    std::string compiler= {};///< compiler name and version
+    std::string date    = {};///< UTC date of the run (ISO 8601)
+};
+
+/**
+ * @brief A set of results with their context
+ */
+struct Report {
+    Context context;            ///< where the results come from
+    std::vector<Result> results;///< the results
+};
+
+/**
+ * @brief Get the context of the current host and build.
+ * @return The context.
+ */
+[[nodiscard]] Context hostContext();
+
+/**
+ * @brief Write a report in JSON.
+ * @param os The output stream.
+ * @param report The report.
+ */
+void writeJson(std::ostream& os, const Report& report);
+/**
+ * @brief Write a report in CSV, one line per result, the context is repeated on each line.
+ * @param os The output stream.
+ * @param report The report.
+ */
+void writeCsv(std::ostream& os, const Report& report);
+/**
+ * @brief Read a report written by writeJson or writeCsv (the format is detected).
+ * @param is The input stream.
+ * @return The report.
+ * @throw std::runtime_error if the input cannot be parsed.
+ */
+[[nodiscard]] Report readReport(std::istream& is);
+
+/**
+ * @brief Verdict of the comparison of a benchmark between two reports
+ */
+enum struct Verdict {
+    Same,       ///< the difference is in the noise
+    Improvement,///< the current result is faster
+    Regression, ///< the current result is slower
+    Missing,    ///< the benchmark is only in the baseline
+    New         ///< the benchmark is only in the current report
+};
+
+/**
+ * @brief Get the name of a verdict.
+ * @param verdict The verdict.
+ * @return The verdict's name.
+ */
+[[nodiscard]] const char* verdictName(Verdict verdict) noexcept;
+
+/**
+ * @brief Comparison of one benchmark between two reports
+ */
+struct Comparison {
+    std::string name = {};          ///< full name of the benchmark
+    Mode mode        = Mode::Latency;///< the mode of the benchmark
+    f64 baseline     = 0;           ///< baseline median time per operation
+    f64 current      = 0;           ///< current median time per operation
+    f64 change       = 0;           ///< relative change of the median (positive is slower)
+    Verdict verdict  = Verdict::Same;///< the verdict
+};
+
+/**
+ * @brief Compare two sets of results.
+ *
+ * A change is significant if the relative difference of the medians is greater than the
+ * threshold and if the absolute difference is greater than noiseFactor times the combined
+ * MAD of both results.
+ *
+ * @param baseline The reference results.
+ * @param current The new results.
+ * @param threshold The relative threshold (0.05 for 5%).
+ * @param noiseFactor The number of MAD under which a difference is noise.
+ * @return The comparisons, in the order of the baseline then the new benchmarks.
+ */
+[[nodiscard]] std::vector<Comparison> compare(const std::vector<Result>& baseline, const std::vector<Result>& current, f64 threshold= 0.05, f64 noiseFactor= 3.0);
+
+}// namespace fln::bench
@@ -0,0 +1,109 @@
+/**
+ * \file BFloat16Type.h
+ *
+ * \date 17/10/2026
+ * \author Silmaen
+ */
+
+#pragma once
+#include "PackedType.h"
+#include "bithack_Functions.h"
+#include <algorithm>
+#include <span>
+
+namespace fln::object {
+
+/**
+ * @brief Layout of the brain float (bfloat16): the 16 highest bits of a 32 bits float.
+ */
+struct BFloat16Traits: BitLayout<u16, u8, s8, 7, 8> {};
+
+/**
+ * @brief class to better handle bfloat16 and their bits
+ */
+using BitBFloat16= BitPacked<BFloat16Traits>;
+
+/**
+ * @brief Convert a float into bfloat16 bits, rounded to nearest, ties to even.
+ *
+ * As bfloat16 has the exponent of f32, the rounding is a single integer addition on the
+ * bits, NaN are kept quiet. The result is the same as fln::object::packFloat.
+ *
+ * @param f The float to convert.
+ * @return The bfloat16 bits.
+ */
+[[nodiscard]] constexpr u16 toBFloat16(const f32& f) noexcept {
+    const u32 x= bithack::asInt(f);
+    if((x & bithack::nnegZero32) > RealTraits<f32>::expoMask) return u16((x >> 16U) | 0x0040U);
+    return u16((x + 0x7FFFU + ((x >> 16U) & 1U)) >> 16U);
+}
+/**
+ * @brief Convert bfloat16 bits into a float (exact).
+ * @param b The bfloat16 bits.
+ * @return The float.
+ */
+[[nodiscard]] constexpr f32 fromBFloat16(const u16& b) noexcept { return bithack::asFloat(u32(b) << 16U); }
+
+/**
+ * @brief Convert an array of floats into bfloat16, rounded to nearest, ties to even.
+ *
+ * Uses AVX2 when the active fln::bithack::simd instruction set allows it.
+ *
+ * @param in The input array.
+ * @param out The output array of bfloat16 bits.
+ * @param n The number of elements.
+ */
+void toBFloat16(const f32* in, u16* out, size_t n) noexcept;
+/**
+ * @brief Convert an array of bfloat16 into floats.
+ * @param in The input array of bfloat16 bits.
+ * @param out The output array.
+ * @param n The number of elements.
+ */
+void fromBFloat16(const u16* in, f32* out, size_t n) noexcept;
+/**
+ * @brief Dot product of two bfloat16 arrays, accumulated in f32.
+ *
+ * The accumulation is done in 16 interleaved partial sums summed at the end, the result
+ * does not depend on the instruction set.
+ *
+ * @param a The first array of bfloat16 bits.
+ * @param b The second array of bfloat16 bits.
+ * @param n The number of elements.
+ * @return The dot product.
+ */
+[[nodiscard]] f32 dotBFloat16(const u16* a, const u16* b, size_t n) noexcept;
+/**
+ * @brief Sum of a bfloat16 array, accumulated in f32 (same order as fln::object::dotBFloat16).
+ * @param in The array of bfloat16 bits.
+ * @param n The number of elements.
+ * @return The sum.
+ */
+[[nodiscard]] f32 sumBFloat16(const u16* in, size_t n) noexcept;
+/**
+ * @brief Convert floats into bfloat16, the size is the smallest of the spans.
+ * @param in The input floats.
+ * @param out The output bfloat16 bits.
+ */
+inline void toBFloat16(std::span<const f32> in, std::span<u16> out) noexcept { toBFloat16(in.data(), out.data(), std::min(in.size(), out.size())); }
+/**
+ * @brief Convert bfloat16 into floats, the size is the smallest of the spans.
+ * @param in The input bfloat16 bits.
+ * @param out The output floats.
+ */
+inline void fromBFloat16(std::span<const u16> in, std::span<f32> out) noexcept { fromBFloat16(in.data(), out.data(), std::min(in.size(), out.size())); }
+/**
+ * @brief Dot product of two bfloat16 arrays, the size is the smallest of the spans.
+ * @param a The first bfloat16 bits.
+ * @param b The second bfloat16 bits.
+ * @return The dot product.
+ */
+[[nodiscard]] inline f32 dotBFloat16(std::span<const u16> a, std::span<const u16> b) noexcept { return dotBFloat16(a.data(), b.data(), std::min(a.size(), b.size())); }
+/**
+ * @brief Sum of a bfloat16 array.
+ * @param in The bfloat16 bits.
+ * @return The sum.
+ */
+[[nodiscard]] inline f32 sumBFloat16(std::span<const u16> in) noexcept { return sumBFloat16(in.data(), in.size()); }
+
+}// namespace fln::object
@@ -0,0 +1,141 @@
+/**
+ * \file FP8Type.h
+ *
+ * \date 17/10/2026
+ * \author Silmaen
+ */
+
+#pragma once
+#include "PackedType.h"
+#include <algorithm>
+#include <array>
+#include <span>
+
+namespace fln::object {
+
+/**
+ * @brief Layout of the 8 bits float E4M3 (OCP FP8): no infinity, a single NaN per sign,
+ * the largest value is 448.
+ */
+struct E4M3: BitLayout<u8, u8, s8, 3, 4> {
+    static constexpr bool ieeeSpecials= false;///< only S.1111.111 is NaN
+    static constexpr bool saturate    = true; ///< overflows give the largest finite value
+};
+/**
+ * @brief Layout of the 8 bits float E5M2 (OCP FP8): IEEE like, the largest value is 57344.
+ */
+struct E5M2: BitLayout<u8, u8, s8, 2, 5> {
+    static constexpr bool saturate= true;///< overflows (and infinity) give the largest finite value
+};
+
+/**
+ * @brief class to better handle 8 bits float and their bits
+ * @tparam Format The FP8 layout (E4M3 or E5M2).
+ */
+template<typename Format>
+using BitFP8= BitPacked<Format>;
+
+namespace detail {
+/**
+ * @brief Build the decode table of an 8 bits format.
+ * @tparam Format The FP8 layout.
+ * @return The float value of every bit pattern.
+ */
+template<typename Format>
+[[nodiscard]] constexpr std::array<f32, 256> makeFP8Table() noexcept {
+    std::array<f32, 256> table{};
+    for(u32 i= 0; i < 256; ++i) table[i]= unpackFloat<Format>(u8(i));
+    return table;
+}
+}// namespace detail
+
+/**
+ * @brief Decode table of an 8 bits format, computed at compile time.
+ * @tparam Format The FP8 layout.
+ */
+template<typename Format>
+inline constexpr std::array<f32, 256> fp8Table= detail::makeFP8Table<Format>();
+
+/**
+ * @brief Decode an 8 bits float (table lookup).
+ * @tparam Format The FP8 layout.
+ * @param b The FP8 bits.
+ * @return The float.
+ */
+template<typename Format>
+[[nodiscard]] constexpr f32 decodeFP8(const u8& b) noexcept { return fp8Table<Format>[b]; }
+
+/**
+ * @brief Encode a float into 8 bits, rounded to nearest, ties to even, with saturation.
+ *
+ * Branch free version of fln::object::packFloat (same results) that the compiler can
+ * vectorize: the normal values are rounded on the bits and the denormal values with a
+ * float addition of a magic number (which assumes the default rounding mode).
+ *
+ * @tparam Format The FP8 layout.
+ * @param f The float to encode.
+ * @return The FP8 bits.
+ */
+template<typename Format>
+[[nodiscard]] constexpr u8 encodeFP8(const f32& f) noexcept {
+    static_assert(Format::saturate, "the fast encoder only handles saturating formats");
+    using fl                 = RealTraits<f32>;
+    constexpr u32 shift      = fl::mantBitNum - Format::mantBitNum;
+    constexpr u32 rebias     = fl::expoBias - Format::expoBias;
+    constexpr u32 minNormal  = (rebias + 1U) << fl::mantBitNum;                                                 // smallest normal of the format, as f32 bits
+    constexpr f32 denormScale= std::bit_cast<f32>((fl::expoBias + Format::expoBias + Format::mantBitNum - 1U) << fl::mantBitNum);// 1 / smallest denormal
+    constexpr f32 magic      = 12582912.0f;                                                                     // 1.5 * 2^23
+    const u32 x     = std::bit_cast<u32>(f);
+    const u32 a     = x & fl::notSign;
+    const u32 sign  = (x & fl::signMask) >> 24U;
+    const u32 normal= roundShiftEven(a - (rebias << fl::mantBitNum), shift);
+    const u32 denorm= std::bit_cast<u32>(std::bit_cast<f32>(a) * denormScale + magic) - std::bit_cast<u32>(magic);
+    // selections with masks, so the compiler does not move the float computation in a branch
+    const u32 isDenorm= 0U - u32(a < minNormal);
+    const u32 isNaN   = 0U - u32(a > fl::expoMask);
+    const u32 r       = std::min<u32>((denorm & isDenorm) | (normal & ~isDenorm), maxFiniteBits<Format>());
+    u32 nan           = nanBits<Format>();
+    if constexpr(Format::ieeeSpecials) nan|= (a & fl::mantMask) >> shift;
+    return u8(sign | (nan & isNaN) | (r & ~isNaN));
+}
+
+/**
+ * @brief Encode an array of floats into 8 bits floats (see fln::object::encodeFP8).
+ * @tparam Format The FP8 layout.
+ * @param in The input array.
+ * @param out The output array of FP8 bits.
+ * @param n The number of elements.
+ */
+template<typename Format>
+inline void encodeFP8(const f32* in, u8* out, size_t n) noexcept {
+    for(size_t i= 0; i < n; ++i) out[i]= encodeFP8<Format>(in[i]);
+}
+/**
+ * @brief Decode an array of 8 bits floats with the lookup table.
+ * @tparam Format The FP8 layout.
+ * @param in The input array of FP8 bits.
+ * @param out The output array.
+ * @param n The number of elements.
+ */
+template<typename Format>
+inline void decodeFP8(const u8* in, f32* out, size_t n) noexcept {
+    for(size_t i= 0; i < n; ++i) out[i]= fp8Table<Format>[in[i]];
+}
+/**
+ * @brief Encode floats into 8 bits floats, the size is the smallest of the spans.
+ * @tparam Format The FP8 layout.
+ * @param in The input floats.
+ * @param out The output FP8 bits.
+ */
+template<typename Format>
+inline void encodeFP8(std::span<const f32> in, std::span<u8> out) noexcept { encodeFP8<Format>(in.data(), out.data(), std::min(in.size(), out.size())); }
+/**
+ * @brief Decode 8 bits floats, the size is the smallest of the spans.
+ * @tparam Format The FP8 layout.
+ * @param in The input FP8 bits.
+ * @param out The output floats.
+ */
+template<typename Format>
+inline void decodeFP8(std::span<const u8> in, std::span<f32> out) noexcept { decodeFP8<Format>(in.data(), out.data(), std::min(in.size(), out.size())); }
+
+}// namespace fln::object
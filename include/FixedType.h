@@ -0,0 +1,471 @@
+/**
+ * \file FixedType.h
+ *
+ * \date 17/10/2026
+ * \author Silmaen
+ */
+
+#pragma once
+#include "bithack_Functions.h"
+#include <algorithm>
+#include <compare>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+namespace fln::object {
+
+namespace detail {
+/**
+ * @brief Smallest signed integer able to hold a number of bits.
+ * @tparam Bits The number of bits.
+ */
+template<u32 Bits>
+using fixedStorage= std::conditional_t<(Bits <= 8), s8, std::conditional_t<(Bits <= 16), s16, std::conditional_t<(Bits <= 32), s32, s64>>>;
+/**
+ * @brief Signed integer twice larger than a storage, to hold products.
+ * @tparam S The storage.
+ */
+template<typename S>
+struct FixedWide;
+/// product of 8 bits values
+template<>
+struct FixedWide<s8> {
+    using type= s16;///< the wide type
+};
+/// product of 16 bits values
+template<>
+struct FixedWide<s16> {
+    using type= s32;///< the wide type
+};
+/// product of 32 bits values
+template<>
+struct FixedWide<s32> {
+    using type= s64;///< the wide type
+};
+#if defined(__SIZEOF_INT128__)
+/// product of 64 bits values
+template<>
+struct FixedWide<s64> {
+    __extension__ using type= __int128;///< the wide type
+};
+#endif
+/**
+ * @brief AVX2 saturating addition of 16 bits raw values.
+ * @param a The first array.
+ * @param b The second array.
+ * @param out The output array.
+ * @param n The number of elements.
+ * @return The number of elements processed (0 if AVX2 is not active), the caller finishes the tail.
+ */
+size_t saturatingAdd16(const s16* a, const s16* b, s16* out, size_t n) noexcept;
+/**
+ * @brief AVX2 saturating rounded multiplication of 16 bits raw values.
+ * @param a The first array.
+ * @param b The second array.
+ * @param out The output array.
+ * @param n The number of elements.
+ * @param fracBits The number of fractional bits.
+ * @return The number of elements processed (0 if AVX2 is not active), the caller finishes the tail.
+ */
+size_t saturatingMul16(const s16* a, const s16* b, s16* out, size_t n, u32 fracBits) noexcept;
+/**
+ * @brief AVX2 saturating multiply-accumulate of 16 bits raw values.
+ * @param a The first array.
+ * @param b The second array.
+ * @param acc The accumulators.
+ * @param n The number of elements.
+ * @param fracBits The number of fractional bits.
+ * @return The number of elements processed (0 if AVX2 is not active), the caller finishes the tail.
+ */
+size_t saturatingMac16(const s16* a, const s16* b, s16* acc, size_t n, u32 fracBits) noexcept;
+}// namespace detail
+
+/**
+ * @brief Signed fixed point number with IntBits integer bits and FracBits fractional bits.
+ *
+ * The value is raw / 2^FracBits, all the bits of the storage are used (1 sign bit). The
+ * usual operators wrap around like integers, the fln::object::saturatingAdd family clamps
+ * to the range instead. Products and quotients are computed in an integer twice larger,
+ * the products are rounded to nearest (ties up), the quotients are truncated.
+ *
+ * The array functions are written to be auto-vectorized; with a 16 bits storage they use
+ * AVX2 kernels when it is the active instruction set (see fln::bithack::simd::setActiveIsa).
+ *
+ * Q15 is Fixed<0, 15> (s16), Q31 is Fixed<0, 31> (s32).
+ *
+ * @tparam IntBits Number of integer bits (without the sign).
+ * @tparam FracBits Number of fractional bits.
+ * @tparam Storage The signed integer storage (s8, s16, s32 or s64).
+ */
+template<u32 IntBits, u32 FracBits, typename Storage= detail::fixedStorage<1U + IntBits + FracBits>>
+struct Fixed {
+    static_assert(std::is_signed_v<Storage> && 1U + IntBits + FracBits == 8U * sizeof(Storage), "sign, integer and fractional bits must fill the storage");
+    static_assert(FracBits < 64U, "too many fractional bits for a float scale");
+    using storage                   = Storage;                                ///< the raw integer type
+    using wide                      = typename detail::FixedWide<Storage>::type;///< integer type of the products
+    static constexpr u32 intBits    = IntBits;                                ///< number of integer bits
+    static constexpr u32 fracBits   = FracBits;                               ///< number of fractional bits
+    static constexpr storage rawMax = std::numeric_limits<storage>::max();    ///< largest raw value
+    static constexpr storage rawMin = std::numeric_limits<storage>::min();    ///< smallest raw value
+    static constexpr f32 scaleUp    = bithack::asFloat(u32(127U + FracBits) << 23U);///< 2^FracBits, built on the exponent bits
+    static constexpr f32 scaleDown  = bithack::asFloat(u32(127U - FracBits) << 23U);///< 2^-FracBits, built on the exponent bits
+
+    // ------------------------------------------------------------------------
+    // constructor and assignations
+    // ------------------------------------------------------------------------
+    /**
+     * @brief Default constructor (zero).
+     */
+    constexpr Fixed() noexcept= default;
+    /**
+     * @brief Constructor based on a float, rounded to nearest and saturated (NaN gives 0).
+     * @param f The input float.
+     */
+    explicit constexpr Fixed(const f32& f) noexcept:
+        data{fromFloat(f)} {}
+    /**
+     * @brief Build a number from its raw integer.
+     * @param r The raw value.
+     * @return The fixed point number.
+     */
+    [[nodiscard]] static constexpr Fixed fromRaw(const storage& r) noexcept {
+        Fixed x;
+        x.data= r;
+        return x;
+    }
+    /**
+     * @brief Largest value.
+     * @return The largest value.
+     */
+    [[nodiscard]] static constexpr Fixed max() noexcept { return fromRaw(rawMax); }
+    /**
+     * @brief Smallest (most negative) value.
+     * @return The smallest value.
+     */
+    [[nodiscard]] static constexpr Fixed min() noexcept { return fromRaw(rawMin); }
+    /**
+     * @brief Difference between two consecutive values.
+     * @return The resolution 2^-FracBits.
+     */
+    [[nodiscard]] static constexpr Fixed epsilon() noexcept { return fromRaw(1); }
+
+    // ------------------------------------------------------------------------
+    // Direct Access
+    // ------------------------------------------------------------------------
+    /**
+     * @brief Get the raw integer.
+     * @return The raw value.
+     */
+    [[nodiscard]] constexpr storage raw() const noexcept { return data; }
+    /**
+     * @brief Get the value as a float (rounded if more than 24 significant bits).
+     * @return The float.
+     */
+    [[nodiscard]] constexpr f32 getFloat() const noexcept { return static_cast<f32>(data) * scaleDown; }
+    /**
+     * @brief Get the value as a double.
+     * @return The double.
+     */
+    [[nodiscard]] constexpr f64 getDouble() const noexcept { return static_cast<f64>(data) * static_cast<f64>(scaleDown); }
+
+    // ------------------------------------------------------------------------
+    // comparison
+    // ------------------------------------------------------------------------
+    /**
+     * @brief Comparison operator equality.
+     * @param o The other number.
+     * @return true if equality
+     */
+    [[nodiscard]] constexpr bool operator==(const Fixed& o) const noexcept= default;
+    /**
+     * @brief Three way comparison.
+     * @param o The other number.
+     * @return The ordering.
+     */
+    [[nodiscard]] constexpr auto operator<=>(const Fixed& o) const noexcept= default;
+
+    // ------------------------------------------------------------------------
+    // arithmetic operators (wrap around)
+    // ------------------------------------------------------------------------
+    /**
+     * @brief Addition.
+     * @param b The other number.
+     * @return The sum.
+     */
+    [[nodiscard]] constexpr Fixed operator+(const Fixed& b) const noexcept { return fromRaw(storage(wide(data) + wide(b.data))); }
+    /**
+     * @brief Subtraction.
+     * @param b The other number.
+     * @return The difference.
+     */
+    [[nodiscard]] constexpr Fixed operator-(const Fixed& b) const noexcept { return fromRaw(storage(wide(data) - wide(b.data))); }
+    /**
+     * @brief Negation (the smallest value stays the smallest).
+     * @return The opposite.
+     */
+    [[nodiscard]] constexpr Fixed operator-() const noexcept { return fromRaw(storage(-wide(data))); }
+    /**
+     * @brief Multiplication, rounded to nearest.
+     * @param b The other number.
+     * @return The product.
+     */
+    [[nodiscard]] constexpr Fixed operator*(const Fixed& b) const noexcept { return fromRaw(storage(product(*this, b))); }
+    /**
+     * @brief Division, truncated (b must not be zero).
+     * @param b The other number.
+     * @return The quotient.
+     */
+    [[nodiscard]] constexpr Fixed operator/(const Fixed& b) const noexcept { return fromRaw(storage((wide(data) << FracBits) / wide(b.data))); }
+    /**
+     * @brief Addition.
+     * @param b The other number.
+     * @return this
+     */
+    constexpr Fixed& operator+=(const Fixed& b) noexcept { return *this= *this + b; }
+    /**
+     * @brief Subtraction.
+     * @param b The other number.
+     * @return this
+     */
+    constexpr Fixed& operator-=(const Fixed& b) noexcept { return *this= *this - b; }
+    /**
+     * @brief Multiplication.
+     * @param b The other number.
+     * @return this
+     */
+    constexpr Fixed& operator*=(const Fixed& b) noexcept { return *this= *this * b; }
+    /**
+     * @brief Division.
+     * @param b The other number.
+     * @return this
+     */
+    constexpr Fixed& operator/=(const Fixed& b) noexcept { return *this= *this / b; }
+
+    // ------------------------------------------------------------------------
+    // helpers
+    // ------------------------------------------------------------------------
+    /**
+     * @brief Product in the wide integer, rounded and scaled back (not narrowed).
+     * @param a The first number.
+     * @param b The second number.
+     * @return The raw product.
+     */
+    [[nodiscard]] static constexpr wide product(const Fixed& a, const Fixed& b) noexcept {
+        const wide p= wide(a.data) * wide(b.data);
+        if constexpr(FracBits == 0) return p;
+        else return (p + (wide(1) << (FracBits - 1U))) >> FracBits;
+    }
+    /**
+     * @brief Clamp a wide raw value into the range.
+     * @param w The wide raw value.
+     * @return The saturated number.
+     */
+    [[nodiscard]] static constexpr Fixed saturate(const wide& w) noexcept { return fromRaw(storage(std::clamp<wide>(w, rawMin, rawMax))); }
+
+private:
+    /// bits of the float 2^(IntBits + FracBits): first magnitude out of the range
+    static constexpr u32 overBits= u32(127U + IntBits + FracBits) << 23U;
+    /**
+     * @brief Convert a float into the raw integer.
+     *
+     * Written with integer masks only, so that the array conversion auto-vectorizes.
+     *
+     * @param f The float.
+     * @return The raw value, rounded to nearest (ties away from zero) and saturated, 0 for NaN.
+     */
+    [[nodiscard]] static constexpr storage fromFloat(const f32& f) noexcept {
+        using conv  = std::conditional_t<(sizeof(storage) <= 4), s32, s64>;
+        const u32 b = bithack::asInt(f * scaleUp);// exact: power of 2
+        const u32 m = b & 0x7FFFFFFFU;
+        const f32 c = bithack::asFloat(std::min(m, overBits - 1U) | (b & 0x80000000U));// magnitude below the limit
+        const conv t= static_cast<conv>(c);                                            // truncated
+        const u32 r = bithack::asInt(c - static_cast<f32>(t));                         // exact remainder
+        const conv v= std::min<conv>(t + (s32(r) >= 0x3F000000) - (r >= 0xBF000000U), rawMax);
+        const conv o= -conv(m >= overBits);// out of the range: saturate with the sign
+        const conv h= (v & ~o) | ((conv(rawMax) ^ conv(s32(b) >> 31)) & o);
+        return storage(h & ~-conv(m > 0x7F800000U));// NaN gives 0
+    }
+
+    storage data{0};///< the raw integer
+};
+
+/// 16 bits fixed point in [-1, 1)
+using Q15= Fixed<0, 15>;
+/// 32 bits fixed point in [-1, 1)
+using Q31= Fixed<0, 31>;
+
+/**
+ * @brief Saturating addition.
+ * @param a The first number.
+ * @param b The second number.
+ * @return The sum, clamped to the range.
+ */
+template<u32 I, u32 F, typename S>
+[[nodiscard]] constexpr Fixed<I, F, S> saturatingAdd(const Fixed<I, F, S>& a, const Fixed<I, F, S>& b) noexcept {
+    using W= typename Fixed<I, F, S>::wide;
+    return Fixed<I, F, S>::saturate(W(a.raw()) + W(b.raw()));
+}
+/**
+ * @brief Saturating subtraction.
+ * @param a The first number.
+ * @param b The second number.
+ * @return The difference, clamped to the range.
+ */
+template<u32 I, u32 F, typename S>
+[[nodiscard]] constexpr Fixed<I, F, S> saturatingSub(const Fixed<I, F, S>& a, const Fixed<I, F, S>& b) noexcept {
+    using W= typename Fixed<I, F, S>::wide;
+    return Fixed<I, F, S>::saturate(W(a.raw()) - W(b.raw()));
+}
+/**
+ * @brief Saturating multiplication, rounded to nearest.
+ * @param a The first number.
+ * @param b The second number.
+ * @return The product, clamped to the range.
+ */
+template<u32 I, u32 F, typename S>
+[[nodiscard]] constexpr Fixed<I, F, S> saturatingMul(const Fixed<I, F, S>& a, const Fixed<I, F, S>& b) noexcept {
+    return Fixed<I, F, S>::saturate(Fixed<I, F, S>::product(a, b));
+}
+/**
+ * @brief Saturating multiply-accumulate acc + a * b, with a single saturation.
+ * @param acc The accumulator.
+ * @param a The first factor.
+ * @param b The second factor.
+ * @return The result, clamped to the range.
+ */
+template<u32 I, u32 F, typename S>
+[[nodiscard]] constexpr Fixed<I, F, S> saturatingMac(const Fixed<I, F, S>& acc, const Fixed<I, F, S>& a, const Fixed<I, F, S>& b) noexcept {
+    using W= typename Fixed<I, F, S>::wide;
+    return Fixed<I, F, S>::saturate(W(acc.raw()) + Fixed<I, F, S>::product(a, b));
+}
+/**
+ * @brief Absolute value (saturated for the smallest value).
+ * @param a The number.
+ * @return The absolute value.
+ */
+template<u32 I, u32 F, typename S>
+[[nodiscard]] constexpr Fixed<I, F, S> abs(const Fixed<I, F, S>& a) noexcept {
+    using W= typename Fixed<I, F, S>::wide;
+    return Fixed<I, F, S>::saturate(a.raw() < 0 ? -W(a.raw()) : W(a.raw()));
+}
+
+// ---=== array versions ===---
+/**
+ * @brief Saturating addition of two arrays.
+ * @param a The first array.
+ * @param b The second array.
+ * @param out The output array.
+ * @param n The number of elements.
+ */
+template<u32 I, u32 F, typename S>
+inline void saturatingAdd(const Fixed<I, F, S>* a, const Fixed<I, F, S>* b, Fixed<I, F, S>* out, size_t n) noexcept {
+    size_t i= 0;
+    if constexpr(std::is_same_v<S, s16>) i= detail::saturatingAdd16(reinterpret_cast<const s16*>(a), reinterpret_cast<const s16*>(b), reinterpret_cast<s16*>(out), n);
+    for(; i < n; ++i) out[i]= saturatingAdd(a[i], b[i]);
+}
+/**
+ * @brief Saturating multiplication of two arrays.
+ * @param a The first array.
+ * @param b The second array.
+ * @param out The output array.
+ * @param n The number of elements.
+ */
+template<u32 I, u32 F, typename S>
+inline void saturatingMul(const Fixed<I, F, S>* a, const Fixed<I, F, S>* b, Fixed<I, F, S>* out, size_t n) noexcept {
+    size_t i= 0;
+    if constexpr(std::is_same_v<S, s16>) i= detail::saturatingMul16(reinterpret_cast<const s16*>(a), reinterpret_cast<const s16*>(b), reinterpret_cast<s16*>(out), n, F);
+    for(; i < n; ++i) out[i]= saturatingMul(a[i], b[i]);
+}
+/**
+ * @brief Saturating multiply-accumulate of arrays: acc[i] += a[i] * b[i].
+ * @param a The first array.
+ * @param b The second array.
+ * @param acc The accumulators.
+ * @param n The number of elements.
+ */
+template<u32 I, u32 F, typename S>
+inline void saturatingMac(const Fixed<I, F, S>* a, const Fixed<I, F, S>* b, Fixed<I, F, S>* acc, size_t n) noexcept {
+    size_t i= 0;
+    if constexpr(std::is_same_v<S, s16>) i= detail::saturatingMac16(reinterpret_cast<const s16*>(a), reinterpret_cast<const s16*>(b), reinterpret_cast<s16*>(acc), n, F);
+    for(; i < n; ++i) acc[i]= saturatingMac(acc[i], a[i], b[i]);
+}
+/**
+ * @brief Dot product of two arrays.
+ *
+ * The rounded products are summed in the wide integer, only the final result is saturated.
+ *
+ * @param a The first array.
+ * @param b The second array.
+ * @param n The number of elements.
+ * @return The dot product.
+ */
+template<u32 I, u32 F, typename S>
+[[nodiscard]] inline Fixed<I, F, S> dot(const Fixed<I, F, S>* a, const Fixed<I, F, S>* b, size_t n) noexcept {
+    using W= std::conditional_t<(sizeof(S) < 4), s64, typename Fixed<I, F, S>::wide>;
+    W acc  = 0;
+    for(size_t i= 0; i < n; ++i) acc+= Fixed<I, F, S>::product(a[i], b[i]);
+    return Fixed<I, F, S>::saturate(typename Fixed<I, F, S>::wide(std::clamp<W>(acc, std::numeric_limits<S>::min(), std::numeric_limits<S>::max())));
+}
+/**
+ * @brief Convert an array of floats (rounded to nearest and saturated).
+ * @param in The input floats.
+ * @param out The output numbers.
+ * @param n The number of elements.
+ */
+template<u32 I, u32 F, typename S>
+inline void toFixed(const f32* in, Fixed<I, F, S>* out, size_t n) noexcept {
+    for(size_t i= 0; i < n; ++i) out[i]= Fixed<I, F, S>(in[i]);
+}
+/**
+ * @brief Convert an array of fixed point numbers into floats.
+ * @param in The input numbers.
+ * @param out The output floats.
+ * @param n The number of elements.
+ */
+template<u32 I, u32 F, typename S>
+inline void toFloat(const Fixed<I, F, S>* in, f32* out, size_t n) noexcept {
+    for(size_t i= 0; i < n; ++i) out[i]= in[i].getFloat();
+}
+/**
+ * @brief Saturating addition of arrays, the size is the smallest of the spans.
+ * @param a The first array.
+ * @param b The second array.
+ * @param out The output array.
+ */
+template<u32 I, u32 F, typename S>
+inline void saturatingAdd(std::span<const Fixed<I, F, S>> a, std::span<const Fixed<I, F, S>> b, std::span<Fixed<I, F, S>> out) noexcept {
+    saturatingAdd(a.data(), b.data(), out.data(), std::min({a.size(), b.size(), out.size()}));
+}
+/**
+ * @brief Saturating multiplication of arrays, the size is the smallest of the spans.
+ * @param a The first array.
+ * @param b The second array.
+ * @param out The output array.
+ */
+template<u32 I, u32 F, typename S>
+inline void saturatingMul(std::span<const Fixed<I, F, S>> a, std::span<const Fixed<I, F, S>> b, std::span<Fixed<I, F, S>> out) noexcept {
+    saturatingMul(a.data(), b.data(), out.data(), std::min({a.size(), b.size(), out.size()}));
+}
+/**
+ * @brief Saturating multiply-accumulate of arrays, the size is the smallest of the spans.
+ * @param a The first array.
+ * @param b The second array.
+ * @param acc The accumulators.
+ */
+template<u32 I, u32 F, typename S>
+inline void saturatingMac(std::span<const Fixed<I, F, S>> a, std::span<const Fixed<I, F, S>> b, std::span<Fixed<I, F, S>> acc) noexcept {
+    saturatingMac(a.data(), b.data(), acc.data(), std::min({a.size(), b.size(), acc.size()}));
+}
+/**
+ * @brief Dot product of arrays, the size is the smallest of the spans.
+ * @param a The first array.
+ * @param b The second array.
+ * @return The dot product.
+ */
+template<u32 I, u32 F, typename S>
+[[nodiscard]] inline Fixed<I, F, S> dot(std::span<const Fixed<I, F, S>> a, std::span<const Fixed<I, F, S>> b) noexcept {
+    return dot(a.data(), b.data(), std::min(a.size(), b.size()));
+}
+
+}// namespace fln::object
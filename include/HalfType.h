@@ -0,0 +1,65 @@
+/**
+ * \file HalfType.h
+ *
+ * \date 17/10/2026
+ * \author Silmaen
+ */
+
+#pragma once
+#include "PackedType.h"
+#include <algorithm>
+#include <span>
+
+namespace fln::object {
+
+/**
+ * @brief Layout of the 16 bits float (IEEE 754 binary16).
+ */
+struct HalfTraits: BitLayout<u16, u8, s8, 10, 5> {};
+
+/**
+ * @brief class to better handle 16 bits float and their bits
+ */
+using BitHalf= BitPacked<HalfTraits>;
+
+/**
+ * @brief Convert an array of 32 bits floats into 16 bits floats.
+ *
+ * Rounding is to nearest, ties to even, with denormals. The conversion uses the F16C
+ * instructions when available and when the active fln::bithack::simd instruction set is
+ * at least AVX2, else the bit hack fln::object::packFloat.
+ *
+ * @param in The input array.
+ * @param out The output array of binary16 bits.
+ * @param n The number of elements.
+ */
+void toHalf(const f32* in, u16* out, size_t n) noexcept;
+/**
+ * @brief Convert an array of 16 bits floats into 32 bits floats (exact).
+ *
+ * Same instruction selection as fln::object::toHalf.
+ *
+ * @param in The input array of binary16 bits.
+ * @param out The output array.
+ * @param n The number of elements.
+ */
+void fromHalf(const u16* in, f32* out, size_t n) noexcept;
+/**
+ * @brief Convert 32 bits floats into 16 bits floats, the size is the smallest of the spans.
+ * @param in The input floats.
+ * @param out The output binary16 bits.
+ */
+inline void toHalf(std::span<const f32> in, std::span<u16> out) noexcept { toHalf(in.data(), out.data(), std::min(in.size(), out.size())); }
+/**
+ * @brief Convert 16 bits floats into 32 bits floats, the size is the smallest of the spans.
+ * @param in The input binary16 bits.
+ * @param out The output floats.
+ */
+inline void fromHalf(std::span<const u16> in, std::span<f32> out) noexcept { fromHalf(in.data(), out.data(), std::min(in.size(), out.size())); }
+/**
+ * @brief Check if the conversions use the F16C instructions.
+ * @return True if hardware conversion is used.
+ */
+[[nodiscard]] bool halfUsesF16C() noexcept;
+
+}// namespace fln::object
@@ -0,0 +1,139 @@
+/**
+ * \file MiniFloat.h
+ *
+ * \date 17/10/2026
+ * \author Silmaen
+ */
+
+#pragma once
+#include "PackedType.h"
+#include <algorithm>
+#include <span>
+#include <type_traits>
+
+namespace fln::object {
+
+namespace detail {
+/**
+ * @brief Smallest unsigned integer able to hold a number of bits.
+ * @tparam Bits The number of bits.
+ */
+template<u32 Bits>
+using miniStorage= std::conditional_t<(Bits <= 8), u8, std::conditional_t<(Bits <= 16), u16, std::conditional_t<(Bits <= 32), u32, u64>>>;
+}// namespace detail
+
+/**
+ * @brief Layout of a custom IEEE 754 like format, stored in the smallest unsigned integer.
+ * @tparam ExpoBits Number of bits in the exponent.
+ * @tparam MantBits Number of bits in the mantissa.
+ * @tparam Bias The exponent bias (IEEE 754 bias by default).
+ */
+template<u32 ExpoBits, u32 MantBits, u32 Bias= (1U << (ExpoBits - 1U)) - 1U>
+struct MiniFloatTraits: BitLayout<detail::miniStorage<1U + ExpoBits + MantBits>, u16, s16, MantBits, ExpoBits, Bias> {};
+
+/**
+ * @brief class to handle a custom float format and its bits
+ *
+ * The constants are computed at compile time from the field widths. The conversions from
+ * and to f32 (when the format fits in a f32) and f64 are exact or rounded to nearest, ties
+ * to even, without double rounding.
+ *
+ * @tparam ExpoBits Number of bits in the exponent.
+ * @tparam MantBits Number of bits in the mantissa.
+ * @tparam Bias The exponent bias (IEEE 754 bias by default).
+ */
+template<u32 ExpoBits, u32 MantBits, u32 Bias= (1U << (ExpoBits - 1U)) - 1U>
+using MiniFloat= BitPacked<MiniFloatTraits<ExpoBits, MantBits, Bias>>;
+
+/**
+ * @brief Get the number of bytes needed to store bit-packed values.
+ * @tparam Mini The packed float type.
+ * @param n The number of values.
+ * @return The number of bytes.
+ */
+template<typename Mini>
+[[nodiscard]] constexpr size_t packedBytes(size_t n) noexcept { return (n * Mini::traits::bitNum + 7U) / 8U; }
+
+/**
+ * @brief Encode floats into a tightly bit-packed buffer.
+ *
+ * The values are stored one after the other on their exact number of bits, least
+ * significant bits first.
+ *
+ * @tparam Mini The packed float type.
+ * @tparam FloatT The native float type.
+ * @param in The input floats.
+ * @param n The number of values.
+ * @param out The output buffer (at least fln::object::packedBytes bytes).
+ */
+template<typename Mini, typename FloatT>
+inline void packBits(const FloatT* in, size_t n, u8* out) noexcept {
+    using traits       = typename Mini::traits;
+    constexpr u32 width= traits::bitNum;
+    static_assert(width <= 56, "the values must have at most 56 bits");
+    u64 acc = 0;
+    u32 fill= 0;
+    for(size_t i= 0; i < n; ++i) {
+        acc|= u64(packFloat<traits, FloatT>(in[i])) << fill;
+        fill+= width;
+        for(; fill >= 8; fill-= 8, acc>>= 8U) *out++= u8(acc);
+    }
+    if(fill > 0) *out= u8(acc);
+}
+/**
+ * @brief Decode floats from a tightly bit-packed buffer (see fln::object::packBits).
+ * @tparam Mini The packed float type.
+ * @tparam FloatT The native float type.
+ * @param in The input buffer.
+ * @param n The number of values.
+ * @param out The output floats.
+ */
+template<typename Mini, typename FloatT>
+inline void unpackBits(const u8* in, size_t n, FloatT* out) noexcept {
+    using traits       = typename Mini::traits;
+    constexpr u32 width= traits::bitNum;
+    constexpr u64 mask = (u64(1) << width) - 1U;
+    static_assert(width <= 56, "the values must have at most 56 bits");
+    u64 acc = 0;
+    u32 fill= 0;
+    for(size_t i= 0; i < n; ++i) {
+        for(; fill < width; fill+= 8) acc|= u64(*in++) << fill;
+        out[i]= unpackFloat<traits, FloatT>(typename traits::baseBits(acc & mask));
+        acc>>= width;
+        fill-= width;
+    }
+}
+/**
+ * @brief Encode floats into a bit-packed buffer, as many values as fit in the buffer.
+ * @tparam Mini The packed float type.
+ * @param in The input floats.
+ * @param out The output buffer.
+ */
+template<typename Mini>
+inline void packBits(std::span<const f32> in, std::span<u8> out) noexcept { packBits<Mini>(in.data(), std::min(in.size(), out.size() * 8U / Mini::traits::bitNum), out.data()); }
+/**
+ * @brief Encode doubles into a bit-packed buffer, as many values as fit in the buffer.
+ * @tparam Mini The packed float type.
+ * @param in The input doubles.
+ * @param out The output buffer.
+ */
+template<typename Mini>
+inline void packBits(std::span<const f64> in, std::span<u8> out) noexcept { packBits<Mini>(in.data(), std::min(in.size(), out.size() * 8U / Mini::traits::bitNum), out.data()); }
+/**
+ * @brief Decode floats from a bit-packed buffer, as many values as available.
+ * @tparam Mini The packed float type.
+ * @param in The input buffer.
+ * @param out The output floats.
+ */
+template<typename Mini>
+inline void unpackBits(std::span<const u8> in, std::span<f32> out) noexcept { unpackBits<Mini>(in.data(), std::min(out.size(), in.size() * 8U / Mini::traits::bitNum), out.data()); }
+/**
+ * @brief Decode doubles from a bit-packed buffer, as many values as available.
+ * @tparam Mini The packed float type.
+ * @param in The input buffer.
+ * @param out The output doubles.
+ */
+template<typename Mini>
+inline void unpackBits(std::span<const u8> in, std::span<f64> out) noexcept { unpackBits<Mini>(in.data(), std::min(out.size(), in.size() * 8U / Mini::traits::bitNum), out.data()); }
+
+}// namespace fln::object
@@ -0,0 +1,384 @@
+/**
+ * \file PackedType.h
+ *
+ * \date 17/10/2026
+ * \author Silmaen
+ */
+
+#pragma once
+#include "RealType.h"
+#include <bit>
+
+namespace fln::object {
+
+/**
+ * @brief Round to nearest, ties to even, a value shifted to the right.
+ * @tparam T The unsigned integer type.
+ * @param m The value to shift.
+ * @param shift The number of bits to drop (less than the size of T).
+ * @return The rounded shifted value.
+ */
+template<typename T>
+[[nodiscard]] constexpr T roundShiftEven(const T& m, const u32& shift) noexcept {
+    if(shift == 0) return m;
+    const T half= T(1) << (shift - 1U);
+    const T rem = m & ((half << 1U) - 1U);
+    const T q   = m >> shift;
+    return q + T((rem + (q & 1U)) > half);// above the half, or on the half with an odd quotient
+}
+
+/**
+ * @brief Get the bits of the largest finite value of a format.
+ * @tparam Layout The bit layout of the format.
+ * @return The bits of the largest finite value.
+ */
+template<typename Layout>
+[[nodiscard]] constexpr typename Layout::baseBits maxFiniteBits() noexcept {
+    if constexpr(Layout::ieeeSpecials) return typename Layout::baseBits(Layout::expoMask - Layout::one);
+    else return typename Layout::baseBits(Layout::expoMask | (Layout::mantMask - Layout::one));
+}
+/**
+ * @brief Get the bits of the NaN of a format.
+ * @tparam Layout The bit layout of the format.
+ * @return The bits of the positive (quiet) NaN.
+ */
+template<typename Layout>
+[[nodiscard]] constexpr typename Layout::baseBits nanBits() noexcept {
+    if constexpr(Layout::ieeeSpecials) return typename Layout::baseBits(Layout::expoMask | (Layout::implicitBit >> 1U));
+    else return typename Layout::baseBits(Layout::expoMask | Layout::mantMask);
+}
+/**
+ * @brief Get the bits of the result of an overflow in a format.
+ * @tparam Layout The bit layout of the format.
+ * @return The largest finite value if saturating, else infinity (or NaN if no infinity).
+ */
+template<typename Layout>
+[[nodiscard]] constexpr typename Layout::baseBits overflowBits() noexcept {
+    if constexpr(Layout::saturate) return maxFiniteBits<Layout>();
+    else if constexpr(Layout::ieeeSpecials) return Layout::expoMask;
+    else return nanBits<Layout>();
+}
+
+/**
+ * @brief Check at compile time that a format can be exactly converted into a native float.
+ * @tparam Layout The bit layout of the format.
+ * @tparam FloatT The native float type.
+ * @return True if every finite value of the format is a finite value of FloatT.
+ */
+template<typename Layout, typename FloatT>
+[[nodiscard]] constexpr bool fitsIn() noexcept {
+    using f= RealTraits<FloatT>;
+    return Layout::mantBitNum <= f::mantBitNum && Layout::expoBias <= f::expoBias && Layout::fullExpo - Layout::expoBias <= f::fullExpo - f::expoBias;
+}
+
+/**
+ * @brief Encode a native float into a smaller IEEE 754 like format.
+ *
+ * The rounding is to nearest, ties to even. Values too large (and infinity) give
+ * fln::object::overflowBits, values too small give denormals or zero, NaN stay quiet NaN
+ * with the highest bits of the payload when the format has IEEE special values.
+ *
+ * @tparam Layout The bit layout of the target format.
+ * @tparam FloatT The native float type (f32 or f64).
+ * @param value The float to encode.
+ * @return The bits in the target format.
+ */
+template<typename Layout, typename FloatT= f32>
+[[nodiscard]] constexpr typename Layout::baseBits packFloat(const FloatT& value) noexcept {
+    static_assert(fitsIn<Layout, FloatT>(), "the format must fit in the float type");
+    using bits            = typename Layout::baseBits;
+    using f               = RealTraits<FloatT>;
+    using wide            = typename f::baseBits;
+    using swide           = typename f::signedBits;
+    constexpr u32 shift   = f::mantBitNum - Layout::mantBitNum;                                 // dropped mantissa bits
+    constexpr u32 sShift  = f::mantBitNum + f::expoBitNum - Layout::mantBitNum - Layout::expoBitNum;// sign bit move
+    constexpr swide rebias= swide(f::expoBias) - swide(Layout::expoBias);
+    const wide x          = std::bit_cast<wide>(value);
+    const bits sign       = bits((x & f::signMask) >> sShift);
+    const wide a          = x & f::notSign;
+    if(a == f::expoMask) return bits(sign | overflowBits<Layout>());
+    if(a > f::expoMask) {
+        if constexpr(Layout::ieeeSpecials) return bits(sign | nanBits<Layout>() | ((a & f::mantMask) >> shift));
+        else return bits(sign | nanBits<Layout>());
+    }
+    const wide fe  = a >> f::mantBitNum;
+    const swide e  = swide(fe == 0 ? 1U : fe) - rebias;// biased exponent in the target format
+    if(e > 0) {
+        // rebias and round, a mantissa carry goes in the exponent
+        const wide r= roundShiftEven<wide>(a - (wide(rebias) << f::mantBitNum), shift);
+        if(r > maxFiniteBits<Layout>()) return bits(sign | overflowBits<Layout>());
+        return bits(sign | r);
+    }
+    // denormal in the target format
+    const wide total= shift + wide(1 - e);
+    if(total > f::mantBitNum + 1U) return sign;
+    const wide m= fe == 0 ? a : ((a & f::mantMask) | f::implicitBit);
+    return bits(sign | roundShiftEven<wide>(m, u32(total)));
+}
+
+/**
+ * @brief Decode a smaller IEEE 754 like format into a native float.
+ *
+ * The conversion is exact.
+ *
+ * @tparam Layout The bit layout of the source format.
+ * @tparam FloatT The native float type (f32 or f64).
+ * @param b The bits in the source format.
+ * @return The float.
+ */
+template<typename Layout, typename FloatT= f32>
+[[nodiscard]] constexpr FloatT unpackFloat(const typename Layout::baseBits& b) noexcept {
+    static_assert(fitsIn<Layout, FloatT>(), "the format must fit in the float type");
+    using f              = RealTraits<FloatT>;
+    using wide           = typename f::baseBits;
+    using swide          = typename f::signedBits;
+    constexpr u32 shift  = f::mantBitNum - Layout::mantBitNum;
+    constexpr u32 sShift = f::mantBitNum + f::expoBitNum - Layout::mantBitNum - Layout::expoBitNum;
+    constexpr wide rebias= f::expoBias - Layout::expoBias;
+    const wide sign      = wide(b & Layout::signMask) << sShift;
+    const wide e         = wide(b & Layout::expoMask) >> Layout::mantBitNum;
+    const wide m         = wide(b & Layout::mantMask);
+    if constexpr(Layout::ieeeSpecials) {
+        if(e == Layout::fullExpo) return std::bit_cast<FloatT>(wide(sign | f::expoMask | (m << shift)));
+    } else {
+        if((b & Layout::notSign) == nanBits<Layout>()) return std::bit_cast<FloatT>(wide(sign | f::expoMask | (f::implicitBit >> 1U)));
+    }
+    if(e != 0) return std::bit_cast<FloatT>(wide(sign | ((e + rebias) << f::mantBitNum) | (m << shift)));
+    if(m == 0) return std::bit_cast<FloatT>(sign);
+    // denormal: normalize the mantissa
+    const wide p  = wide(std::bit_width(m)) - 1U;
+    const swide fe= swide(p + rebias + 1U) - swide(Layout::mantBitNum);
+    if constexpr(shift + rebias < 8 * sizeof(wide)) {
+        if(fe <= 0) return std::bit_cast<FloatT>(wide(sign | (m << (shift + rebias))));// also a denormal float
+    }
+    return std::bit_cast<FloatT>(wide(sign | (wide(fe) << f::mantBitNum) | ((m << (f::mantBitNum - p)) & f::mantMask)));
+}
+
+/**
+ * @brief class to handle the bits of a small float format without native type
+ *
+ * The value is only stored as bits, the computations are done with 32 bits floats.
+ *
+ * @tparam Layout The bit layout of the format.
+ */
+template<typename Layout>
+struct BitPacked {
+    using traits     = Layout;                      ///< the layout of the format
+    using baseFloat  = f32;                         ///< type used for the computations
+    using baseBits   = typename Layout::baseBits;   ///< base internal type of bits
+    using expoRawType= typename Layout::expoRawType;///< type of the biased exponent
+    using expoType   = typename Layout::expoType;   ///< type of the unbiased exponent
+
+    // ------------------------------------------------------------------------
+    // constructor and assignations
+    // ------------------------------------------------------------------------
+    /**
+     * @brief Default constructor.
+     */
+    constexpr BitPacked() noexcept= default;
+    /**
+     * @brief Constructor based on a float, rounded to the nearest.
+     * @param a The input float.
+     */
+    explicit constexpr BitPacked(const baseFloat& a) noexcept:
+        data{packFloat<Layout>(a)} {}
+    /**
+     * @brief Constructor based on a double, rounded to the nearest.
+     * @param a The input double.
+     */
+    explicit constexpr BitPacked(const f64& a) noexcept:
+        data{packFloat<Layout, f64>(a)} {}
+    /**
+     * @brief Constructor based on bits.
+     * @param a The input bits.
+     */
+    explicit constexpr BitPacked(const baseBits& a) noexcept:
+        data{a} {}
+    /**
+     * @brief Assignation operator based on a float, rounded to the nearest.
+     * @param a The other Float.
+     * @return this
+     */
+    constexpr BitPacked& operator=(const baseFloat& a) noexcept {
+        data= packFloat<Layout>(a);
+        return *this;
+    }
+    /**
+     * @brief Assignation operator based on bits.
+     * @param a The other bits.
+     * @return this
+     */
+    constexpr BitPacked& operator=(const baseBits& a) noexcept {
+        data= a;
+        return *this;
+    }
+
+    // ------------------------------------------------------------------------
+    // classical comparison on floats
+    // ------------------------------------------------------------------------
+    /**
+     * @brief Comparison operator equality.
+     * @param o The other value to compare.
+     * @return true if equality
+     */
+    [[nodiscard]] constexpr bool operator==(const BitPacked& o) const noexcept { return getFloat() == o.getFloat(); }
+    /**
+     * @brief Comparison operator inequality.
+     * @param o The other value to compare.
+     * @return true if not equality
+     */
+    [[nodiscard]] constexpr bool operator!=(const BitPacked& o) const noexcept { return getFloat() != o.getFloat(); }
+    /**
+     * @brief Comparison operator lower than.
+     * @param o The other value to compare.
+     * @return true if this lower than o
+     */
+    [[nodiscard]] constexpr bool operator<(const BitPacked& o) const noexcept { return getFloat() < o.getFloat(); }
+    /**
+     * @brief Comparison operator greater than.
+     * @param o The other value to compare.
+     * @return true if this greater than o
+     */
+    [[nodiscard]] constexpr bool operator>(const BitPacked& o) const noexcept { return getFloat() > o.getFloat(); }
+
+    // ------------------------------------------------------------------------
+    // member Access
+    // ------------------------------------------------------------------------
+    // the sign bit
+    /**
+     * @brief Get the sign bit.
+     * @return True if negative.
+     */
+    [[nodiscard]] constexpr bool sign() const noexcept { return (data & Layout::signMask) != 0; }
+    /**
+     * @brief Define the sign bit.
+     * @param s The new sign bit.
+     */
+    constexpr void setSign(bool s) noexcept { data= baseBits((data & Layout::notSign) | (s * Layout::signMask)); }
+    /**
+     * @brief Change the sign.
+     */
+    constexpr void toggleSign() noexcept { data^= Layout::signMask; }
+
+    // the exponent bits
+    /**
+     * @brief Get the bits representing the exponent.
+     * @return The exponent bits.
+     */
+    [[nodiscard]] constexpr expoRawType exponentRaw() const noexcept { return expoRawType((data & Layout::expoMask) >> Layout::mantBitNum); }
+    /**
+     * @brief get the exponent bits as a string.
+     * @return String with bit representation.
+     */
+    [[nodiscard]] std::string exponentRawBits() const noexcept { return std::bitset<Layout::expoBitNum>(exponentRaw()).to_string(); }
+    /**
+     * @brief Get The value of the exponent unbiased
+     * @return unbiased value of the exponent
+     */
+    [[nodiscard]] constexpr expoType exponent() const noexcept { return expoType(exponentRaw() - Layout::expoBias); }
+    /**
+     * @brief Define the exponent bits
+     * @param exp the new exponent bits
+     */
+    constexpr void setExponentRaw(const baseBits& exp) noexcept { data= baseBits((data & Layout::notExpo) | ((exp << Layout::mantBitNum) & Layout::expoMask)); }
+    /**
+     * @brief Define the unbiased exponent.
+     * @param exp unbiased exponent
+     */
+    constexpr void setExponent(const expoType& exp) noexcept { setExponentRaw(baseBits(exp + Layout::expoBias)); }
+
+    // the mantissa bits
+    /**
+     * @brief Get raw bits of the mantissa.
+     * @return The raw bits of the mantissa.
+     */
+    [[nodiscard]] constexpr baseBits mantissaRaw() const noexcept { return data & Layout::mantMask; }
+    /**
+     * @brief get the mantissa bits as a string.
+     * @return String with bit representation.
+     */
+    [[nodiscard]] std::string mantissaRawBits() const noexcept { return std::bitset<Layout::mantBitNum>(mantissaRaw()).to_string(); }
+    /**
+     * @brief Get the mantissa with the implicit bit.
+     * @return The mantissa.
+     */
+    [[nodiscard]] constexpr baseBits mantissa() const noexcept { return mantissaRaw() | Layout::implicitBit; }
+    /**
+     * @brief Define the mantissa bits.
+     * @param m The new mantissa bits.
+     */
+    constexpr void setMantissaRaw(const baseBits& m) noexcept { data= baseBits((data & Layout::notMant) | (m & Layout::mantMask)); }
+    /**
+     * @brief Get a string with the separated bit fields.
+     * @return String with bit representation.
+     */
+    [[nodiscard]] std::string rawBits() const noexcept {
+        std::stringstream oss;
+        oss << "[" << std::bitset<1>(sign()) << "][" << std::bitset<Layout::expoBitNum>(exponentRaw()) << "][" << std::bitset<Layout::mantBitNum>(mantissaRaw()) << "]";
+        return oss.str();
+    }
+
+    // ------------------------------------------------------------------------
+    // Direct Access
+    // ------------------------------------------------------------------------
+    /**
+     * @brief Get the value as a 32 bits float (exact).
+     * @return The float.
+     */
+    [[nodiscard]] constexpr baseFloat getFloat() const noexcept { return unpackFloat<Layout>(data); }
+    /**
+     * @brief Get the value as a 64 bits float (exact).
+     * @return The double.
+     */
+    [[nodiscard]] constexpr f64 getDouble() const noexcept { return unpackFloat<Layout, f64>(data); }
+    /**
+     * @brief Get a copy of the bits.
+     * @return The bits.
+     */
+    [[nodiscard]] constexpr baseBits getBits() const noexcept { return data; }
+    /**
+     * @brief Access to the bits.
+     * @return The bits.
+     */
+    [[nodiscard]] constexpr const baseBits& bits() const noexcept { return data; }
+    /**
+     * @brief Access to the bits.
+     * @return The bits.
+     */
+    [[nodiscard]] constexpr baseBits& bits() noexcept { return data; }
+
+    // ------------------------------------------------------------------------
+    // Normalization information
+    // ------------------------------------------------------------------------
+    /**
+     * @brief Check if the number is normalized.
+     * @return True if normalized.
+     */
+    [[nodiscard]] constexpr bool isNormalized() const noexcept { return !isDenormalized(); }
+    /**
+     * @brief Check if the number is denormalized (same definition as BitReal).
+     * @return True if denormalized.
+     */
+    [[nodiscard]] constexpr bool isDenormalized() const noexcept {
+        if constexpr(Layout::ieeeSpecials) return (exponentRaw() == 0 && mantissaRaw() != 0) || exponentRaw() == Layout::fullExpo;
+        else return (exponentRaw() == 0 && mantissaRaw() != 0) || isNaN();
+    }
+    /**
+     * @brief Check if the number is infinite (never for formats without infinity).
+     * @return True if infinite.
+     */
+    [[nodiscard]] constexpr bool isInfinite() const noexcept { return Layout::ieeeSpecials && (data & Layout::notSign) == Layout::expoMask; }
+    /**
+     * @brief Check if the number is not a number.
+     * @return True if NaN.
+     */
+    [[nodiscard]] constexpr bool isNaN() const noexcept {
+        if constexpr(Layout::ieeeSpecials) return (data & Layout::notSign) > Layout::expoMask;
+        else return (data & Layout::notSign) == nanBits<Layout>();
+    }
+
+private:
+    baseBits data{0};///< the bits
+};
+
+}// namespace fln::object
@@ -0,0 +1,133 @@
+/**
+ * \file RealFunctions.h
+ *
+ * \date 17/10/2026
+ * \author Silmaen
+ */
+#pragma once
+#include "RealType.h"
+#include "approximationPolynomials.h"
+
+namespace fln::object {
+
+/**
+ * @brief absolute value of the given float
+ * @param f the float to measure
+ * @return the absolute value of f
+ */
+template<typename FloatT, typename Traits>
+[[nodiscard]] constexpr BitReal<FloatT, Traits> abs(const BitReal<FloatT, Traits>& f) noexcept {
+    return BitReal<FloatT, Traits>(f.bits() & Traits::notSign);
+}
+
+/**
+ * @brief Fast approximate logarithm base 2.
+ *
+ * Works for positive values of f, for negative value, the behavior is undefined.
+ *
+ * The absolute error is between 0.0 and -0.04 for any positive input value.
+ *
+ * @warning no test are done on inputs, so incorrect inputs leads tu undefined behavior
+ *
+ * @param f The input value.
+ * @return The approximate log2.
+ */
+template<typename FloatT, typename Traits>
+[[nodiscard]] inline FloatT log2(const BitReal<FloatT, Traits>& f) {
+    using sBits= typename Traits::signedBits;
+    return FloatT((sBits)f.bits() - (sBits)Traits::oneAsInt) * Traits::scaleDown;
+}
+/**
+ * @brief Fast approximate logarithm base 2 of the absolute value.
+ *
+ * The absolute error is between 0.0 and -0.04 for any positive input value.
+ *
+ * @warning no test are done on inputs, so incorrect inputs leads tu undefined behavior
+ *
+ * @param f The input value.
+ * @return The approximate log2.
+ */
+template<typename FloatT, typename Traits>
+[[nodiscard]] inline FloatT log2a(const BitReal<FloatT, Traits>& f) {
+    using sBits= typename Traits::signedBits;
+    return FloatT((sBits)(f.bits() & Traits::notSign) - (sBits)Traits::oneAsInt) * Traits::scaleDown;
+}
+
+/**
+ * @brief Fast approximation of the power of 2.
+ *
+ * Works for values in the range of the exponent (-120 & 120 for 32bits float), else the
+ * result is overflowing and behavior is undefined.
+ *
+ * Relative error is between 0.0 and -0.04 for any value in non-overflowing range.
+ *
+ * @warning no test are done on inputs, so incorrect inputs leads tu undefined behavior
+ *
+ * @param f The input value.
+ * @return The approximate exp2.
+ */
+template<typename FloatT, typename Traits>
+[[nodiscard]] inline FloatT exp2(const BitReal<FloatT, Traits>& f) {
+    using sBits= typename Traits::signedBits;
+    BitReal<FloatT, Traits> a;
+    a.bits()= (sBits)(f.fl() * Traits::scaleUp) + (sBits)Traits::oneAsInt;
+    return a.getFloat();
+}
+/**
+ * @brief compute the power p of float f
+ *
+ * @warning no test are done on inputs, so incorrect inputs leads tu undefined behavior
+ *
+ * @param f the base
+ * @param p the exponent
+ * @return f^p
+ */
+template<typename FloatT, typename Traits>
+[[nodiscard]] inline FloatT pow(const BitReal<FloatT, Traits>& f, const BitReal<FloatT, Traits>& p) {
+    using sBits= typename Traits::signedBits;
+    BitReal<FloatT, Traits> a;
+    a.bits()= (sBits(p.fl() * ((sBits)f.bits() - (sBits)Traits::oneAsInt)) + Traits::oneAsInt);
+    return a.fl();
+}
+
+/**
+ * @brief Approximate logarithm base 2 with a polynomial correction of the mantissa.
+ *
+ * The maximum absolute errors of the tiers are given in fln::poly::Log2.
+ *
+ * @warning no test are done on inputs, so incorrect inputs leads tu undefined behavior
+ *
+ * @tparam P The precision tier.
+ * @param f The input value.
+ * @return The approximate log2.
+ */
+template<Precision P, typename FloatT, typename Traits>
+[[nodiscard]] inline FloatT log2(const BitReal<FloatT, Traits>& f) {
+    const FloatT m= FloatT(f.mantissaRaw()) * Traits::scaleDown;
+    return FloatT(f.exponent()) + poly::horner<FloatT>(poly::Log2<P>::coefficients, m);
+}
+
+/**
+ * @brief Approximate power of 2 with a polynomial correction of the mantissa.
+ *
+ * Works for values in the range of the normalized exponents (-126 & 127 for 32bits
+ * float, -1022 & 1023 for 64bits float), else the result is overflowing and behavior is undefined.
+ *
+ * The maximum relative errors of the tiers are given in fln::poly::Exp2.
+ *
+ * @warning no test are done on inputs, so incorrect inputs leads tu undefined behavior
+ *
+ * @tparam P The precision tier.
+ * @param f The input value.
+ * @return The approximate exp2.
+ */
+template<Precision P, typename FloatT, typename Traits>
+[[nodiscard]] inline FloatT exp2(const BitReal<FloatT, Traits>& f) {
+    using sBits  = typename Traits::signedBits;
+    const sBits e= sBits(f.fl()) - (f.fl() < FloatT(sBits(f.fl())));// floor
+    BitReal<FloatT, Traits> a(FloatT(1) + poly::horner<FloatT>(poly::Exp2<P>::coefficients, f.fl() - FloatT(e)));
+    a.setExponentRaw(typename Traits::baseBits(a.exponentRaw() + e));
+    return a.getFloat();
+}
+
+}// namespace fln::object
@@ -0,0 +1,832 @@
+/**
+ * \file RealType.h
+ *
+ * \date 17/10/2026
+ * \author Silmaen
+ */
+
+#pragma once
+#include "baseType.h"
+#include <bitset>
+#include <sstream>
+
+/**
+ * @namespace fln::object
+ * @brief set of function based on a float object that allow bit manipulation
+ */
+namespace fln::object {
+
+/**
+ * @brief Compile-time layout of the bits of an IEEE 754 like binary format.
+ *
+ * All the masks and magic numbers are derived from the widths of the fields. The fields
+ * are in the lowest bits of the storage, the unused highest bits stay at zero.
+ *
+ * @tparam BitsT The unsigned integer type holding the bits.
+ * @tparam ExpoRawT The unsigned type able to hold the biased exponent.
+ * @tparam ExpoT The signed type able to hold the unbiased exponent.
+ * @tparam MantBits Number of bits in the mantissa.
+ * @tparam ExpoBits Number of bits in the exponent.
+ * @tparam Bias The exponent bias (IEEE 754 bias by default).
+ */
+template<typename BitsT, typename ExpoRawT, typename ExpoT, u32 MantBits, u32 ExpoBits, u32 Bias= (1U << (ExpoBits - 1U)) - 1U>
+struct BitLayout {
+    static_assert(1 + ExpoBits + MantBits <= 8 * sizeof(BitsT), "the fields must fit in the bits");
+    using baseBits                       = BitsT;                                      ///< base internal type of bits
+    using expoRawType                    = ExpoRawT;                                   ///< type of the biased exponent
+    using expoType                       = ExpoT;                                      ///< type of the unbiased exponent
+    static constexpr baseBits one        = 1U;                                         ///< one
+    static constexpr baseBits mantBitNum = MantBits;                                   ///< number of bit in the mantissa (see IEEE 754)
+    static constexpr baseBits expoBitNum = ExpoBits;                                   ///< number of bits in the exponent (see IEEE 754)
+    static constexpr baseBits bitNum     = 1U + ExpoBits + MantBits;                   ///< number of used bits
+    static constexpr baseBits signMask   = one << (mantBitNum + expoBitNum);           ///< bit mask for the sign
+    static constexpr baseBits usedMask   = baseBits((signMask << one) - one);          ///< bit mask for all the used bits
+    static constexpr baseBits mantMask   = (one << mantBitNum) - one;                  ///< bitmask for the mantissa
+    static constexpr baseBits expoMask   = baseBits(usedMask & ~(signMask | mantMask));///< bit mask for the exponent
+    static constexpr baseBits expoBias   = Bias;                                       ///< bias of exponent (see IEEE 754)
+    static constexpr baseBits notSign    = baseBits(usedMask & ~signMask);             ///< bit mask for all except the sign
+    static constexpr baseBits notExpo    = baseBits(usedMask & ~expoMask);             ///< bit mask for all except the exponent
+    static constexpr baseBits notMant    = baseBits(usedMask & ~mantMask);             ///< bitmask for all except the mantissa
+    static constexpr baseBits fullExpo   = expoMask >> mantBitNum;                     ///< exponent fully filled
+    static constexpr baseBits implicitBit= one << mantBitNum;                          ///< the implicit mantissa bit
+    static constexpr baseBits oneAsInt   = expoBias << mantBitNum;                     ///< bit representation of the float 1.0
+    static constexpr bool ieeeSpecials   = true;                                       ///< the full exponent encodes infinity and NaN (else only all ones is NaN)
+    static constexpr bool saturate       = false;                                      ///< overflows are clamped to the largest finite value
+};
+
+/**
+ * @brief Compile-time layout of a native floating type.
+ *
+ * @tparam FloatT The native floating type.
+ * @tparam BitsT The unsigned integer type of the same size.
+ * @tparam SignedT The signed integer type of the same size.
+ * @tparam ExpoRawT The unsigned type able to hold the biased exponent.
+ * @tparam ExpoT The signed type able to hold the unbiased exponent.
+ * @tparam MantBits Number of bits in the mantissa.
+ * @tparam ExpoBits Number of bits in the exponent.
+ */
+template<typename FloatT, typename BitsT, typename SignedT, typename ExpoRawT, typename ExpoT, u32 MantBits, u32 ExpoBits>
+struct RealLayout: BitLayout<BitsT, ExpoRawT, ExpoT, MantBits, ExpoBits> {
+    static_assert(sizeof(FloatT) == sizeof(BitsT), "float and bits types must have the same size");
+    using base      = BitLayout<BitsT, ExpoRawT, ExpoT, MantBits, ExpoBits>;///< layout of the bits
+    using baseFloat = FloatT;                                               ///< base internal type of float
+    using signedBits= SignedT;                                              ///< signed integer of the same size
+    static constexpr baseFloat scaleUp  = static_cast<baseFloat>(base::implicitBit);///< Scaling bit_asFloat to Int
+    static constexpr baseFloat scaleDown= static_cast<baseFloat>(1) / scaleUp;     ///< Scaling bit_asInt to Float
+};
+
+/**
+ * @brief Layout traits of a native floating type.
+ * @tparam FloatT The floating type.
+ */
+template<typename FloatT>
+struct RealTraits;
+
+/**
+ * @brief Layout of the 32 bits float (binary32).
+ */
+template<>
+struct RealTraits<f32>: RealLayout<f32, u32, s32, u8, s8, 23, 8> {};
+
+/**
+ * @brief Layout of the 64 bits float (binary64).
+ */
+template<>
+struct RealTraits<f64>: RealLayout<f64, u64, s64, u16, s16, 52, 11> {};
+
+/**
+ * @brief class to better handle float and their bits
+ *
+ * The layout of the format is given by the traits, so every operation is written once
+ * for all the formats.
+ *
+ * this class is not designed for performance
+ *
+ * @tparam FloatT The native floating type.
+ * @tparam Traits The layout of the format.
+ */
+template<typename FloatT, typename Traits= RealTraits<FloatT>>
+struct BitReal {
+    using traits     = Traits;                      ///< the layout of the format
+    using baseFloat  = typename Traits::baseFloat;  ///< base internal type of float
+    using baseBits   = typename Traits::baseBits;   ///< base internal type of bits
+    using expoRawType= typename Traits::expoRawType;///< type of the biased exponent
+    using expoType   = typename Traits::expoType;   ///< type of the unbiased exponent
+
+    // ------------------------------------------------------------------------
+    // constructor and assignations
+    // ------------------------------------------------------------------------
+    /**
+     * @brief Default constructor.
+     */
+    constexpr BitReal() noexcept= default;
+    /**
+     * @brief Default copy constructor.
+     */
+    constexpr BitReal(const BitReal&) noexcept= default;
+    /**
+     * @brief Default move constructor.
+     */
+    constexpr BitReal(BitReal&&) noexcept= default;
+    /**
+     * @brief Constructor based on a float.
+     * @param a The input float.
+     */
+    explicit constexpr BitReal(const baseFloat& a) noexcept:
+        data{a} {}
+    /**
+     * @brief Constructor copy based on float.
+     * @param a The input float.
+     */
+    explicit constexpr BitReal(baseFloat&& a) noexcept:
+        data{a} {}
+    /**
+     * @brief Constructor based on bits.
+     * @param a The input bits.
+     */
+    explicit constexpr BitReal(const baseBits& a) noexcept { data.i= a; }
+    /**
+     * @brief Constructor copy based on bits.
+     * @param a The input bits.
+     */
+    explicit constexpr BitReal(baseBits&& a) noexcept { data.i= a; }
+    /**
+     * @brief Default assignation operator.
+     * @param a The other BitReal.
+     * @return this
+     */
+    constexpr BitReal& operator=(const BitReal& a) noexcept= default;
+    /**
+     * @brief Default assignation operator.
+     * @param a The other BitReal.
+     * @return this
+     */
+    constexpr BitReal& operator=(BitReal&& a) noexcept= default;
+    /**
+     * @brief Assignation operator based on a float.
+     * @param a The other Float.
+     * @return this
+     */
+    constexpr BitReal& operator=(const baseFloat& a) noexcept {
+        data.f= a;
+        return *this;
+    }
+    /**
+     * @brief Assignation operator based on a float.
+     * @param a The other Float.
+     * @return this
+     */
+    constexpr BitReal& operator=(baseFloat&& a) noexcept {
+        data.f= a;
+        return *this;
+    }
+    /**
+     * @brief Assignation operator based on bits.
+     * @param a The other bits.
+     * @return this
+     */
+    constexpr BitReal& operator=(const baseBits& a) noexcept {
+        data.i= a;
+        return *this;
+    }
+    /**
+     * @brief Assignation operator based on bits.
+     * @param a The other bits.
+     * @return this
+     */
+    constexpr BitReal& operator=(baseBits&& a) noexcept {
+        data.i= a;
+        return *this;
+    }
+    // ------------------------------------------------------------------------
+    // classical comparison on floats
+    // ------------------------------------------------------------------------
+    /**
+     * @brief Comparison operator equality.
+     * @param o The BitReal to compare.
+     * @return true if equality
+     */
+    [[nodiscard]] constexpr bool operator==(const BitReal& o) const noexcept{ return data.f == o.data.f; }
+    /**
+     * @brief Comparison operator inequality.
+     * @param o The BitReal to compare.
+     * @return true if not equality
+     */
+    [[nodiscard]] constexpr bool operator!=(const BitReal& o) const noexcept{ return data.f != o.data.f; }
+    /**
+     * @brief Comparison operator greater than.
+     * @param o The BitReal to compare.
+     * @return true if this greater than o
+     */
+    [[nodiscard]] constexpr bool operator>(const BitReal& o) const noexcept{ return data.f > o.data.f; }
+    /**
+     * @brief Comparison operator lower than.
+     * @param o The BitReal to compare.
+     * @return true if this lower than o
+     */
+    [[nodiscard]] constexpr bool operator<(const BitReal& o) const noexcept{ return data.f < o.data.f; }
+    /**
+     * @brief Comparison operator greater or equal than.
+     * @param o The BitReal to compare.
+     * @return true if this greater or equal than o
+     */
+    [[nodiscard]] constexpr bool operator>=(const BitReal& o) const noexcept{ return data.f >= o.data.f; }
+    /**
+     * @brief Comparison operator lower or equal than.
+     * @param o The BitReal to compare.
+     * @return true if this lower or equal than o
+     */
+    [[nodiscard]] constexpr bool operator<=(const BitReal& o) const noexcept{ return data.f <= o.data.f; }
+    /**
+     * @brief Comparison operator equality.
+     * @param o The float to compare.
+     * @return true if equality
+     */
+    [[nodiscard]] constexpr bool operator==(const baseFloat& o) const noexcept{ return data.f == o; }
+    /**
+     * @brief Comparison operator inequality.
+     * @param o The float to compare.
+     * @return true if not equality
+     */
+    [[nodiscard]] constexpr bool operator!=(const baseFloat& o) const noexcept{ return data.f != o; }
+    /**
+     * @brief Comparison operator greater than.
+     * @param o The float to compare.
+     * @return true if this greater than o
+     */
+    [[nodiscard]] constexpr bool operator>(const baseFloat& o) const noexcept{ return data.f > o; }
+    /**
+     * @brief Comparison operator lower than.
+     * @param o The float to compare.
+     * @return true if this lower than o
+     */
+    [[nodiscard]] constexpr bool operator<(const baseFloat& o) const noexcept{ return data.f < o; }
+    /**
+     * @brief Comparison operator greater or equal than.
+     * @param o The float to compare.
+     * @return true if this greater or equal than o
+     */
+    [[nodiscard]] constexpr bool operator>=(const baseFloat& o) const noexcept{ return data.f >= o; }
+    /**
+     * @brief Comparison operator lower or equal than.
+     * @param o The float to compare.
+     * @return true if this lower or equal than o
+     */
+    [[nodiscard]] constexpr bool operator<=(const baseFloat& o) const noexcept{ return data.f <= o; }
+
+    // ------------------------------------------------------------------------
+    // arithmetic operators
+    // ------------------------------------------------------------------------
+    /**
+     * @brief Self add.
+     * @param b The other number to add.
+     * @return this
+     */
+    [[nodiscard]] constexpr BitReal& operator+=(const BitReal& b) noexcept{
+        data.f+= (b.fl());
+        return *this;
+    }
+    /**
+     * @brief Self add.
+     * @param b The other number to add.
+     * @return this
+     */
+    [[nodiscard]] constexpr BitReal& operator+=(const baseFloat& b) noexcept{
+        data.f+= b;
+        return *this;
+    }
+    /**
+     * @brief Add.
+     * @param b The other number to add.
+     * @return Result
+     */
+    [[nodiscard]] constexpr BitReal operator+(const BitReal& b) const noexcept{
+        BitReal bb(*this);
+        return bb+= b;
+    }
+    /**
+     * @brief Add.
+     * @param b The other number to add.
+     * @return Result
+     */
+    [[nodiscard]] constexpr BitReal operator+(const baseFloat& b) const noexcept{
+        BitReal bb(*this);
+        return bb+= b;
+    }
+    /**
+     * @brief Add.
+     * @param b The other number to add.
+     * @param a The number to add.
+     * @return Result
+     */
+    [[nodiscard]] friend constexpr BitReal operator+(const baseFloat& b, const BitReal& a) noexcept{ return a + b; }
+
+    /**
+     * @brief Self subtract.
+     * @param b The other number to subtract.
+     * @return this
+     */
+    [[nodiscard]] constexpr BitReal& operator-=(const BitReal& b) noexcept{
+        data.f-= (b.fl());
+        return *this;
+    }
+    /**
+     * @brief Self subtract.
+     * @param b The other number to subtract.
+     * @return this
+     */
+    [[nodiscard]] constexpr BitReal& operator-=(const baseFloat& b) noexcept{
+        data.f-= b;
+        return *this;
+    }
+    /**
+     * @brief subtract.
+     * @param b The other number to subtract.
+     * @return Result
+     */
+    [[nodiscard]] constexpr BitReal operator-() const noexcept{
+        BitReal bb(*this);
+        bb.toggleSign();
+        return bb;
+    }
+    /**
+     * @brief subtract.
+     * @param b The other number to subtract.
+     * @return Result
+     */
+    [[nodiscard]] constexpr BitReal operator-(const BitReal& b) const noexcept{
+        BitReal bb(*this);
+        return bb-= b;
+    }
+    /**
+     * @brief subtract.
+     * @param b The other number to subtract.
+     * @return Result
+     */
+    [[nodiscard]] constexpr BitReal operator-(const baseFloat& b) const noexcept{
+        BitReal bb(*this);
+        return bb-= b;
+    }
+    /**
+     * @brief subtract.
+     * @param b The other number to subtract.
+     * @param a The number to subtract.
+     * @return Result
+     */
+    [[nodiscard]] friend constexpr BitReal operator-(const baseFloat& b, const BitReal& a) noexcept{ return -a + b; }
+
+    /**
+     * @brief Self multiply.
+     * @param b The other number to multiply.
+     * @return this
+     */
+    [[nodiscard]] constexpr BitReal& operator*=(const BitReal& b) noexcept{
+        data.f*= (b.fl());
+        return *this;
+    }
+    /**
+     * @brief Self multiply.
+     * @param b The other number to multiply.
+     * @return this
+     */
+    [[nodiscard]] constexpr BitReal& operator*=(const baseFloat& b) noexcept{
+        data.f*= b;
+        return *this;
+    }
+    /**
+     * @brief multiply.
+     * @param b The other number to multiply.
+     * @return Result
+     */
+    [[nodiscard]] constexpr BitReal operator*(const BitReal& b) const noexcept{
+        BitReal bb(*this);
+        return bb*= b;
+    }
+    /**
+     * @brief multiply.
+     * @param b The other number to multiply.
+     * @return Result
+     */
+    [[nodiscard]] constexpr BitReal operator*(const baseFloat& b) const noexcept{
+        BitReal bb(*this);
+        return bb*= b;
+    }
+    /**
+     * @brief multiply.
+     * @param b The other number to multiply.
+     * @param a The number to multiply.
+     * @return Result
+     */
+    [[nodiscard]] friend constexpr BitReal operator*(const baseFloat& b, const BitReal& a) noexcept{ return a * b; }
+
+    /**
+     * @brief Self divide.
+     * @param b The other number to divide.
+     * @return this
+     */
+    [[nodiscard]] constexpr BitReal& operator/=(const BitReal& b) noexcept{
+        data.f/= (b.fl());
+        return *this;
+    }
+    /**
+     * @brief Self divide.
+     * @param b The other number to divide.
+     * @return this
+     */
+    [[nodiscard]] constexpr BitReal& operator/=(const baseFloat& b) noexcept{
+        data.f/= b;
+        return *this;
+    }
+    /**
+     * @brief divide.
+     * @param b The other number to divide.
+     * @return Result
+     */
+    [[nodiscard]] constexpr BitReal operator/(const BitReal& b) const noexcept{
+        BitReal bb(*this);
+        return bb/= b;
+    }
+    /**
+     * @brief divide.
+     * @param b The other number to divide.
+     * @return Result
+     */
+    [[nodiscard]] constexpr BitReal operator/(const baseFloat& b) const noexcept{
+        BitReal bb(*this);
+        return bb/= b;
+    }
+    /**
+     * @brief divide.
+     * @param b The other number to divide.
+     * @param a The number to divide.
+     * @return Result
+     */
+    [[nodiscard]] friend constexpr BitReal operator/(const baseFloat& b, const BitReal& a) noexcept{ return BitReal(b / a.fl()); }
+
+    // ------------------------------------------------------------------------
+    // bit shift operators
+    // ------------------------------------------------------------------------
+    /**
+     * @brief Self bit shift left.
+     * @param b The number of bits to shift.
+     * @return this
+     */
+    [[nodiscard]] constexpr BitReal& operator<<=(const BitReal& b) noexcept{
+        data.i<<= (b.bits());
+        return *this;
+    }
+    /**
+     * @brief Self bit shift left.
+     * @param b The number of bits to shift.
+     * @return this
+     */
+    [[nodiscard]] constexpr BitReal& operator<<=(const baseBits& b) noexcept{
+        data.i<<= b;
+        return *this;
+    }
+    /**
+     * @brief Bit shift left.
+     * @param b The number of bits to shift.
+     * @return Shifted Number
+     */
+    [[nodiscard]] constexpr BitReal operator<<(const BitReal& b) const noexcept{
+        BitReal bb(*this);
+        return bb<<= b;
+    }
+    /**
+     * @brief Bit shift left.
+     * @param b The number of bits to shift.
+     * @return Shifted Number
+     */
+    [[nodiscard]] constexpr BitReal operator<<(const baseBits& b) const noexcept{
+        BitReal bb(*this);
+        return bb<<= b;
+    }
+    /**
+     * @brief Self bit shift right.
+     * @param b The number of bits to shift.
+     * @return this
+     */
+    [[nodiscard]] constexpr BitReal& operator>>=(const BitReal& b) noexcept{
+        data.i>>= (b.bits());
+        return *this;
+    }
+
+    /**
+     * @brief Self bit shift right.
+     * @param b The number of bits to shift.
+     * @return this
+     */
+    [[nodiscard]] constexpr BitReal& operator>>=(const baseBits& b) noexcept{
+        data.i>>= b;
+        return *this;
+    }
+    /**
+     * @brief Bit shift right.
+     * @param b The number of bits to shift.
+     * @return Shifted Number
+     */
+    [[nodiscard]] constexpr BitReal operator>>(const BitReal& b) const noexcept{
+        BitReal bb(*this);
+        return bb>>= b;
+    }
+    /**
+     * @brief Bit shift right.
+     * @param b The number of bits to shift.
+     * @return Shifted Number
+     */
+    [[nodiscard]] constexpr BitReal operator>>(const baseBits& b) const noexcept{
+        BitReal bb(*this);
+        return bb>>= b;
+    }
+    // ------------------------------------------------------------------------
+    // bitwise operators
+    // ------------------------------------------------------------------------
+    /**
+     * @brief Self bitwise and.
+     * @param b The bits to add.
+     * @return this
+     */
+    [[nodiscard]] constexpr BitReal& operator&=(const BitReal& b) noexcept{
+        data.i&= (b.bits());
+        return *this;
+    }
+    /**
+     * @brief Self bitwise and.
+     * @param b The bits to add.
+     * @return this
+     */
+    [[nodiscard]] constexpr BitReal& operator&=(const baseBits& b) noexcept{
+        data.i&= b;
+        return *this;
+    }
+    /**
+     * @brief Bitwise and.
+     * @param b The bits to add.
+     * @return Result
+     */
+    [[nodiscard]] constexpr BitReal operator&(const BitReal& b) const noexcept{
+        BitReal bb(*this);
+        return bb&= b;
+    }
+    /**
+     * @brief Bitwise and.
+     * @param b The bits to add.
+     * @return Result
+     */
+    [[nodiscard]] constexpr BitReal operator&(const baseBits& b) const noexcept{
+        BitReal bb(*this);
+        return bb&= b;
+    }
+    /**
+     * @brief Self bitwise or.
+     * @param b The bits to or.
+     * @return this
+     */
+    [[nodiscard]] constexpr BitReal& operator|=(const BitReal& b) noexcept{
+        data.i|= (b.bits());
+        return *this;
+    }
+    /**
+     * @brief Self bitwise or.
+     * @param b The bits to or.
+     * @return this
+     */
+    [[nodiscard]] constexpr BitReal& operator|=(const baseBits& b) noexcept{
+        data.i|= b;
+        return *this;
+    }
+    /**
+     * @brief Bitwise or.
+     * @param b The bits to or.
+     * @return Result
+     */
+    [[nodiscard]] constexpr BitReal operator|(const BitReal& b) const noexcept{
+        BitReal bb(*this);
+        return bb|= b;
+    }
+    /**
+     * @brief Bitwise or.
+     * @param b The bits to or.
+     * @return Result
+     */
+    [[nodiscard]] constexpr BitReal operator|(const baseBits& b) const noexcept{
+        BitReal bb(*this);
+        return bb|= b;
+    }
+    /**
+     * @brief Self bitwise xor.
+     * @param b The bits to xor.
+     * @return this
+     */
+    [[nodiscard]] constexpr BitReal& operator^=(const BitReal& b) noexcept{
+        data.i^= (b.bits());
+        return *this;
+    }
+    /**
+     * @brief Self bitwise xor.
+     * @param b The bits to xor.
+     * @return this
+     */
+    [[nodiscard]] constexpr BitReal& operator^=(const baseBits& b) noexcept{
+        data.i^= b;
+        return *this;
+    }
+    /**
+     * @brief Bitwise xor.
+     * @param b The bits to xor.
+     * @return Result
+     */
+    [[nodiscard]] constexpr BitReal operator^(const BitReal& b) const noexcept{
+        BitReal bb(*this);
+        return bb^= b;
+    }
+    /**
+     * @brief Bitwise xor.
+     * @param b The bits to xor.
+     * @return Result
+     */
+    [[nodiscard]] constexpr BitReal operator^(const baseBits& b) const noexcept{
+        BitReal bb(*this);
+        return bb^= b;
+    }
+    /**
+     * @brief Bitwise not.
+     * @param b The bits to not.
+     * @return Result
+     */
+    [[nodiscard]] constexpr BitReal operator~() const noexcept{
+        BitReal bb(*this);
+        bb.bits()= ~bb.bits();
+        return bb;
+    }
+
+    // ------------------------------------------------------------------------
+    // member Access
+    // ------------------------------------------------------------------------
+    // the sign bit
+    /**
+     * @brief Get the value of the bit sign
+     * @return true if negative.
+     */
+    [[nodiscard]] constexpr bool sign() const noexcept{ return (data.i & Traits::signMask) != 0; }
+    /**
+     * @brief define the sign of the float
+     * @param s the new sign
+     */
+    void setSign(bool s) noexcept{ data.i= (data.i & Traits::notSign) | (s * Traits::signMask); }
+    /**
+     * @brief change the sign of the float
+     */
+    constexpr void toggleSign() noexcept{ data.i^= Traits::signMask; }
+
+    // the exponent bits
+    /**
+     * @brief Get the bits representing the exponent.
+     * @return The exponent bits.
+     */
+    [[nodiscard]] constexpr expoRawType exponentRaw() const noexcept{ return (data.i & Traits::expoMask) >> Traits::mantBitNum; }
+    /**
+     * @brief get the exponent bits as a string.
+     * @return String with bit representation.
+     */
+    [[nodiscard]] std::string exponentRawBits() const noexcept{
+        std::string a;
+        for(u8 i= 0; i < Traits::expoBitNum; ++i) {
+            baseBits bitMask= Traits::one << (Traits::expoBitNum + Traits::mantBitNum - Traits::one - i);
+            a+= ((data.i & bitMask) == bitMask) ? "1" : "0";
+        }
+        return a;
+    }
+    /**
+     * @brief Get The value of the exponent unbiased
+     * @return unbiased value of the exponent
+     */
+    [[nodiscard]] constexpr expoType exponent() const noexcept{ return exponentRaw() - Traits::expoBias; }
+    /**
+     * @brief Define the exponent bits
+     * @param exp the new exponent bits
+     */
+    void setExponentRaw(const baseBits& exp) noexcept{ data.i= (data.i & Traits::notExpo) | ((exp << Traits::mantBitNum) & Traits::expoMask); }
+    /**
+     * @brief Define the unbiased exponent.
+     * @param exp unbiased exponent
+     */
+    void setExponent(const expoType& exp) noexcept{ setExponentRaw(exp + Traits::expoBias); }
+
+    // the mantissa bits
+    /**
+     * @brief Get raw bits of the mantissa.
+     * @return The raw bits of the mantissa.
+     */
+    [[nodiscard]] constexpr baseBits mantissaRaw() const noexcept{ return (data.i & Traits::mantMask); }
+    /**
+     * @brief Get raw bits of the mantissa as string.
+     * @return String with mantissa's bits.
+     */
+    [[nodiscard]] std::string mantissaRawBits() const noexcept{
+        std::string a;
+        for(u8 i= 0; i < Traits::mantBitNum; ++i) {
+            baseBits bitMask= Traits::one << (Traits::mantBitNum - Traits::one - i);
+            a+= ((data.i & bitMask) == bitMask) ? "1" : "0";
+        }
+        return a;
+    }
+    /**
+     * @brief Get bits of the mantissa with the implicit one.
+     * @return The bits of the mantissa.
+     */
+    [[nodiscard]] constexpr baseBits mantissa() const noexcept{ return (data.i & Traits::mantMask) | Traits::implicitBit; }
+    /**
+     * @brief Set raw bits of the mantissa.
+     * @param m The bits of the mantissa.
+     */
+    void setMantissaRaw(const baseBits& m) noexcept{ data.i= (data.i & Traits::notMant) | (m & Traits::mantMask); }
+
+    /**
+     * @brief Get a string representation of all bits.
+     * @return String of the bits
+     */
+    [[nodiscard]] std::string rawBits() const noexcept{
+        std::stringstream oss;
+        oss << "[" << std::bitset<Traits::one>(sign()) << "][" << std::bitset<Traits::expoBitNum>(exponentRaw()) << "][" << std::bitset<Traits::mantBitNum>(mantissaRaw()) << "]";
+        return oss.str();
+    }
+
+    // ------------------------------------------------------------------------
+    // Direct Access
+    // ------------------------------------------------------------------------
+    /**
+     * @brief View this object as a float.
+     * @return A float copy of this object.
+     */
+    [[nodiscard]] constexpr baseFloat getFloat() const noexcept{ return data.f; }
+    /**
+     * @brief View this object as a set of bits.
+     * @return A uint copy of this object
+     */
+    [[nodiscard]] constexpr baseBits getBits() const noexcept{ return data.i; }
+    /**
+     * @brief Access to the bits const.
+     * @return Const reference to the bits.
+     */
+    [[nodiscard]] constexpr const baseBits& bits() const noexcept{ return data.i; }
+    /**
+     * @brief Access to the bits.
+     * @return Reference to the bits.
+     */
+    [[nodiscard]] constexpr baseBits& bits() noexcept{ return data.i; }
+    /**
+     * @brief Access to the bits const.
+     * @return Const reference to the bits.
+     */
+    [[nodiscard]] constexpr const baseFloat& fl() const noexcept{ return data.f; }
+    /**
+     * @brief Access to the bits.
+     * @return Reference to the bits.
+     */
+    [[nodiscard]] constexpr baseFloat& fl() noexcept{ return data.f; }
+
+    // ------------------------------------------------------------------------
+    // Normalization information
+    // ------------------------------------------------------------------------
+    /**
+     * @brief Determine if a float is a normalize one.
+     * @return true if the float is a normalized one.
+     */
+    [[nodiscard]] constexpr bool isNormalized() const noexcept{
+        return !isDenormalized();
+    }
+    /**
+     * @brief Determine if a float is not a normalize one.
+     * @return true if the float is not a normalized one.
+     */
+    [[nodiscard]] constexpr bool isDenormalized() const noexcept{
+        return (exponentRaw() == 0 && mantissaRaw() != 0) || exponentRaw() == Traits::fullExpo;
+    }
+    /**
+     * @brief Determine if a float is an infinite representation.
+     * @return true if the float is an infinite representation.
+     */
+    [[nodiscard]] constexpr bool isInfinite() const noexcept{
+        return ((data.i & Traits::expoMask) == Traits::expoMask) && ((data.i & Traits::mantMask) == 0);
+    }
+    /**
+     * @brief Determine if a float is not a number.
+     * @return true if the float is not a number.
+     */
+    [[nodiscard]] constexpr bool isNaN() const noexcept{
+        return ((data.i & Traits::expoMask) == Traits::expoMask) && ((data.i & Traits::mantMask) != 0);
+    }
+
+private:
+    /**
+     * @brief internal data
+     */
+    union Data {
+        baseFloat f;///< data view as float
+        baseBits i; ///< data view as bits
+    } data{0};
+};
+
+}// namespace fln::object
\ No newline at end of file
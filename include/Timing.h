@@ -7,6 +7,17 @@
 #include "baseDefines.h"
 #include "baseType.h"
 
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define FLN_TIME_TSC
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#elif defined(__aarch64__) && !defined(_MSC_VER)
+#define FLN_TIME_CNTVCT
+#endif
+
 /**
  * namespace fln::time
  * @brief time management
@@ -89,4 +100,170 @@ struct Timer {
     }
 };
 
+// ---=== cycle counter ===---
+
+/**
+ * @brief Read the cycle counter, for the start of a measure.
+ *
+ * On x86 this is rdtsc preceded by lfence so the previous instructions are completed
+ * and the measured ones cannot start before the read. On aarch64 the virtual counter
+ * is read after an isb; elsewhere the steady clock in nanoseconds is used.
+ *
+ * @return The counter value in ticks.
+ */
+[[nodiscard]] inline u64 cycleStart() noexcept {
+#if defined(FLN_TIME_TSC)
+    _mm_lfence();
+    return __rdtsc();
+#elif defined(FLN_TIME_CNTVCT)
+    u64 value;
+    asm volatile("isb; mrs %0, cntvct_el0"
+                 : "=r"(value)
+                 :
+                 : "memory");
+    return value;
+#else
+    return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+/**
+ * @brief Read the cycle counter, for the end of a measure.
+ *
+ * On x86 this is rdtscp, which waits for the measured instructions, followed by lfence
+ * so the next instructions cannot start before the read.
+ *
+ * @return The counter value in ticks.
+ */
+[[nodiscard]] inline u64 cycleStop() noexcept {
+#if defined(FLN_TIME_TSC)
+    u32 aux;
+    const u64 value= __rdtscp(&aux);
+    _mm_lfence();
+    return value;
+#else
+    return cycleStart();
+#endif
+}
+
+/**
+ * @brief Read the cycle counter without serialization (cheapest, for polling).
+ * @return The counter value in ticks.
+ */
+[[nodiscard]] inline u64 cycleNow() noexcept {
+#if defined(FLN_TIME_TSC)
+    return __rdtsc();
+#else
+    return cycleStart();
+#endif
+}
+
+/**
+ * @brief Get the frequency of the cycle counter.
+ *
+ * The x86 time stamp counter is calibrated once against the steady clock (about 10ms
+ * at the first call), the aarch64 counter frequency is read from cntfrq_el0.
+ *
+ * @return The number of ticks per nanosecond.
+ */
+[[nodiscard]] f64 cycleFrequency();
+
+/**
+ * @brief Check if the cycle counter is a hardware counter with constant rate.
+ * @return False if the fall back on the steady clock is used.
+ */
+[[nodiscard]] bool hasCycleCounter() noexcept;
+
+/**
+ * @brief low overhead timing structure based on the CPU cycle counter
+ *
+ * Same usage as Timer, but reading the time costs a few tens of cycles instead of a
+ * system clock call. The time stamp counter runs at a constant rate (not the actual
+ * core frequency) on all recent x86 CPUs; the conversion to nanoseconds uses
+ * cycleFrequency().
+ */
+struct CycleTimer {
+    /// default number of calls to timeCheck between two reads of the counter
+    static constexpr u32 defaultCheckInterval= 64;
+    /**
+     * @brief Start the chronometer
+     * @param durationInMilliseconds the duration before throwing an exception (0.0: disable)
+     * @param checkInterval the counter is read only once every checkInterval calls of timeCheck
+     */
+    inline void startTimer(double durationInMilliseconds= 0.0, u32 checkInterval= defaultCheckInterval) {
+        m_deadline     = durationInMilliseconds > 0.0 ? static_cast<u64>(durationInMilliseconds * 1e6 * cycleFrequency()) : 0;
+        m_checkInterval= checkInterval > 0 ? checkInterval : 1;
+        m_countdown    = m_checkInterval;
+        m_started      = true;
+        m_start        = cycleStart();
+        if(m_deadline > 0) m_deadline+= m_start;
+    }
+    /**
+     * @brief stop timer and save the duration
+     */
+    inline void stopTimer() {
+        const u64 stop= cycleStop();
+        if(!m_started) return;
+        m_cycles = stop - m_start;
+        m_started= false;
+    }
+    /**
+     * @brief check the time for timeout, cheap enough to be called in a hot loop
+     *
+     * The counter is only read once every checkInterval calls.
+     * do nothing if chronometer is not started or if no duration is set
+     * throw a timeout exception & stop chronometer if time ran out
+     */
+    inline void timeCheck() {
+        if(--m_countdown != 0) return;
+        m_countdown= m_checkInterval;
+        if(timedOut()) {
+            stopTimer();
+            throw TimeoutException();
+        }
+    }
+    /**
+     * @brief check if the time ran out, without exception
+     * @return true if the chronometer is started with a duration which is elapsed
+     */
+    [[nodiscard]] inline bool timedOut() const noexcept { return m_started && m_deadline != 0 && cycleNow() > m_deadline; }
+    /**
+     * @brief get the chronometer value in counter ticks
+     * @return the duration if chronometer is stopped, else the ticks since the start
+     */
+    [[nodiscard]] inline u64 currentCycles() const noexcept {
+        if(m_started) return cycleStop() - m_start;
+        return m_cycles;
+    }
+    /**
+     * @brief get the chronometer value in nanoseconds
+     * @return the duration if chronometer is stopped, else the time since the start
+     */
+    [[nodiscard]] std::chrono::nanoseconds currentTimeTakenInNanoSeconds() const {
+        return std::chrono::nanoseconds(static_cast<long long>(static_cast<f64>(currentCycles()) / cycleFrequency()));
+    }
+    /**
+     * @brief get the chronometer value in milliseconds
+     * @return the chronometer value in milliseconds
+     */
+    [[nodiscard]] f64 currentTimeTakenInMilliSeconds() const { return static_cast<f64>(currentCycles()) / cycleFrequency() / 1000000.0; }
+
+    u64 m_start        = 0;                   ///< The counter when chronometer starts.
+    u64 m_deadline     = 0;                   ///< The counter value of the timeout (0: no timeout).
+    u64 m_cycles       = 0;                   ///< The current duration in ticks.
+    u32 m_checkInterval= defaultCheckInterval;///< Number of timeCheck calls between two counter reads.
+    u32 m_countdown    = defaultCheckInterval;///< Remaining timeCheck calls before the next counter read.
+    bool m_started     = false;               ///< The state of the chronometer
+    /**
+     * @brief friend streaming operator
+     * @param os the inbound output stream
+     * @param timer the CycleTimer object to stream
+     * @return the outbound output stream
+     */
+    inline friend ostream& operator<<(ostream& os, const CycleTimer& timer) {
+        os << "Time taken: " << timer.currentTimeTakenInMilliSeconds() << "ms (" << timer.currentCycles() << " ticks)";
+        return (os);
+    }
+};
+
 }// namespace fln
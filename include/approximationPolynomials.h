@@ -0,0 +1,104 @@
+/**
+ * \file approximationPolynomials.h
+ *
+ * \date 17/10/2026
+ * \author Silmaen
+ */
+#pragma once
+#include "baseType.h"
+
+namespace fln {
+
+/**
+ * @brief Accuracy tiers of the polynomial corrected approximations
+ *
+ * The higher the precision, the higher the degree of the polynomial and the cost.
+ */
+enum struct Precision {
+    Fast,  ///< degree 2 polynomial
+    Medium,///< degree 4 polynomial
+    High   ///< degree 5 polynomial
+};
+
+/**
+ * @brief minimax polynomial coefficients used to correct the linear mantissa approximations
+ *
+ * The polynomials are fitted on [0,1) with the constraint p(0)=0 and p(1)=1 so the results
+ * are continuous between two consecutive exponents. Coefficients are given for the
+ * powers 1 to degree of the polynomial.
+ */
+namespace poly {
+
+/**
+ * @brief Coefficients of the approximation of log2(1+m) for m in [0,1)
+ * @tparam P The precision tier.
+ */
+template<Precision P>
+struct Log2;
+/**
+ * @brief Coefficients of the approximation of log2(1+m), degree 2, max absolute error 7.7e-3
+ */
+template<>
+struct Log2<Precision::Fast> {
+    static constexpr f64 coefficients[]= {1.34655538, -0.346555384};///< polynomial coefficients
+};
+/**
+ * @brief Coefficients of the approximation of log2(1+m), degree 4, max absolute error 1.2e-4
+ */
+template<>
+struct Log2<Precision::Medium> {
+    static constexpr f64 coefficients[]= {1.43872575, -0.677784013, 0.321188982, -0.0821307174};///< polynomial coefficients
+};
+/**
+ * @brief Coefficients of the approximation of log2(1+m), degree 5, max absolute error 1.6e-5
+ */
+template<>
+struct Log2<Precision::High> {
+    static constexpr f64 coefficients[]= {1.44191704, -0.709096459, 0.415606093, -0.193575736, 0.0451490614};///< polynomial coefficients
+};
+
+/**
+ * @brief Coefficients of the approximation of 2^f-1 for f in [0,1)
+ * @tparam P The precision tier.
+ */
+template<Precision P>
+struct Exp2;
+/**
+ * @brief Coefficients of the approximation of 2^f-1, degree 2, max relative error 2.7e-3
+ */
+template<>
+struct Exp2<Precision::Fast> {
+    static constexpr f64 coefficients[]= {0.660233972, 0.339766028};///< polynomial coefficients
+};
+/**
+ * @brief Coefficients of the approximation of 2^f-1, degree 4, max relative error 3.4e-6
+ */
+template<>
+struct Exp2<Precision::Medium> {
+    static constexpr f64 coefficients[]= {0.693032121, 0.241379763, 0.052032369, 0.0135557472};///< polynomial coefficients
+};
+/**
+ * @brief Coefficients of the approximation of 2^f-1, degree 5, max relative error 9.3e-8
+ */
+template<>
+struct Exp2<Precision::High> {
+    static constexpr f64 coefficients[]= {0.693151739, 0.240159271, 0.055818676, 0.0089909951, 0.00187931865};///< polynomial coefficients
+};
+
+/**
+ * @brief Evaluate x * (c[0] + c[1]*x + ... + c[N-1]*x^(N-1)) using Horner's scheme.
+ * @tparam T The float type of the computation.
+ * @tparam N The number of coefficients.
+ * @param c The coefficients.
+ * @param x The variable.
+ * @return The polynomial value.
+ */
+template<class T, size_t N>
+[[nodiscard]] constexpr T horner(const f64 (&c)[N], const T& x) noexcept {
+    T r= static_cast<T>(c[N - 1]);
+    for(size_t i= N - 1; i > 0; --i) r= r * x + static_cast<T>(c[i - 1]);
+    return r * x;
+}
+
+}// namespace poly
+}// namespace fln
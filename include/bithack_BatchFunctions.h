@@ -0,0 +1,360 @@
+/**
+ * \file bithack_BatchFunctions.h
+ *
+ * \date 17/10/2026
+ * \author Silmaen
+ */
+
+#pragma once
+#include "bithack_Functions.h"
+#include <span>
+
+/**
+ * @brief array versions of the bit hack functions
+ *
+ * Every function takes an input array, an output array and a number of elements
+ * (or the equivalent spans). The loops are plain element-wise loops over the
+ * std::bit_cast based kernels of fln::bithack, so the compiler is able to vectorize
+ * them. Unaligned pointers and sizes that are not multiple of the vector width are
+ * supported, input and output may be the same array (in-place computation).
+ *
+ * For span overloads, the number of processed element is the smallest of the span's sizes.
+ */
+namespace fln::bithack::batch {
+
+namespace detail {
+/**
+ * @brief Apply an element-wise kernel over an array.
+ * @tparam T The float type.
+ * @tparam Kernel The kernel type.
+ * @param in The input array.
+ * @param out The output array.
+ * @param n The number of elements.
+ * @param kernel The function to apply.
+ */
+template<class T, class Kernel>
+inline void apply(const T* in, T* out, size_t n, Kernel kernel) noexcept {
+    for(size_t i= 0; i < n; ++i) out[i]= kernel(in[i]);
+}
+/**
+ * @brief Apply an element-wise binary kernel over two arrays.
+ * @tparam T The float type.
+ * @tparam Kernel The kernel type.
+ * @param a The first input array.
+ * @param b The second input array.
+ * @param out The output array.
+ * @param n The number of elements.
+ * @param kernel The function to apply.
+ */
+template<class T, class Kernel>
+inline void apply(const T* a, const T* b, T* out, size_t n, Kernel kernel) noexcept {
+    for(size_t i= 0; i < n; ++i) out[i]= kernel(a[i], b[i]);
+}
+/**
+ * @brief Get the number of element to process with two spans.
+ * @param a The first size.
+ * @param b The second size.
+ * @return The size to process.
+ */
+[[nodiscard]] constexpr size_t size(size_t a, size_t b) noexcept { return a < b ? a : b; }
+}// namespace detail
+
+// ---=== ABS ===---
+/**
+ * @brief Absolute value of an array.
+ * @param in The input array.
+ * @param out The output array.
+ * @param n The number of elements.
+ */
+inline void abs(const f32* in, f32* out, size_t n) noexcept {
+    detail::apply(in, out, n, [](const f32& x) { return bithack::abs(x); });
+}
+/**
+ * @brief Absolute value of an array.
+ * @param in The input array.
+ * @param out The output array.
+ * @param n The number of elements.
+ */
+inline void abs(const f64* in, f64* out, size_t n) noexcept {
+    detail::apply(in, out, n, [](const f64& x) { return bithack::abs(x); });
+}
+/**
+ * @brief Absolute value of an array.
+ * @param in The input span.
+ * @param out The output span.
+ */
+inline void abs(std::span<const f32> in, std::span<f32> out) noexcept { abs(in.data(), out.data(), detail::size(in.size(), out.size())); }
+/**
+ * @brief Absolute value of an array.
+ * @param in The input span.
+ * @param out The output span.
+ */
+inline void abs(std::span<const f64> in, std::span<f64> out) noexcept { abs(in.data(), out.data(), detail::size(in.size(), out.size())); }
+
+// ---=== NEGATE ===---
+/**
+ * @brief Change the sign of every element of an array.
+ * @param in The input array.
+ * @param out The output array.
+ * @param n The number of elements.
+ */
+inline void negate(const f32* in, f32* out, size_t n) noexcept {
+    detail::apply(in, out, n, [](const f32& x) { return bithack::negate(x); });
+}
+/**
+ * @brief Change the sign of every element of an array.
+ * @param in The input array.
+ * @param out The output array.
+ * @param n The number of elements.
+ */
+inline void negate(const f64* in, f64* out, size_t n) noexcept {
+    detail::apply(in, out, n, [](const f64& x) { return bithack::negate(x); });
+}
+/**
+ * @brief Change the sign of every element of an array.
+ * @param in The input span.
+ * @param out The output span.
+ */
+inline void negate(std::span<const f32> in, std::span<f32> out) noexcept { negate(in.data(), out.data(), detail::size(in.size(), out.size())); }
+/**
+ * @brief Change the sign of every element of an array.
+ * @param in The input span.
+ * @param out The output span.
+ */
+inline void negate(std::span<const f64> in, std::span<f64> out) noexcept { negate(in.data(), out.data(), detail::size(in.size(), out.size())); }
+
+// ---=== LOG2 ===---
+/**
+ * @brief Fast approximate logarithm base 2 of an array (see fln::bithack::log2).
+ * @param in The input array.
+ * @param out The output array.
+ * @param n The number of elements.
+ */
+inline void log2(const f32* in, f32* out, size_t n) noexcept {
+    detail::apply(in, out, n, [](const f32& x) { return bithack::log2(x); });
+}
+/**
+ * @brief Fast approximate logarithm base 2 of an array (see fln::bithack::log2).
+ * @param in The input array.
+ * @param out The output array.
+ * @param n The number of elements.
+ */
+inline void log2(const f64* in, f64* out, size_t n) noexcept {
+    detail::apply(in, out, n, [](const f64& x) { return bithack::log2(x); });
+}
+/**
+ * @brief Fast approximate logarithm base 2 of an array (see fln::bithack::log2).
+ * @param in The input span.
+ * @param out The output span.
+ */
+inline void log2(std::span<const f32> in, std::span<f32> out) noexcept { log2(in.data(), out.data(), detail::size(in.size(), out.size())); }
+/**
+ * @brief Fast approximate logarithm base 2 of an array (see fln::bithack::log2).
+ * @param in The input span.
+ * @param out The output span.
+ */
+inline void log2(std::span<const f64> in, std::span<f64> out) noexcept { log2(in.data(), out.data(), detail::size(in.size(), out.size())); }
+
+// ---=== EXP2 ===---
+/**
+ * @brief Fast approximate power of 2 of an array (see fln::bithack::exp2).
+ * @param in The input array.
+ * @param out The output array.
+ * @param n The number of elements.
+ */
+inline void exp2(const f32* in, f32* out, size_t n) noexcept {
+    detail::apply(in, out, n, [](const f32& x) { return bithack::exp2(x); });
+}
+/**
+ * @brief Fast approximate power of 2 of an array (see fln::bithack::exp2).
+ * @param in The input array.
+ * @param out The output array.
+ * @param n The number of elements.
+ */
+inline void exp2(const f64* in, f64* out, size_t n) noexcept {
+    detail::apply(in, out, n, [](const f64& x) { return bithack::exp2(x); });
+}
+/**
+ * @brief Fast approximate power of 2 of an array (see fln::bithack::exp2).
+ * @param in The input span.
+ * @param out The output span.
+ */
+inline void exp2(std::span<const f32> in, std::span<f32> out) noexcept { exp2(in.data(), out.data(), detail::size(in.size(), out.size())); }
+/**
+ * @brief Fast approximate power of 2 of an array (see fln::bithack::exp2).
+ * @param in The input span.
+ * @param out The output span.
+ */
+inline void exp2(std::span<const f64> in, std::span<f64> out) noexcept { exp2(in.data(), out.data(), detail::size(in.size(), out.size())); }
+
+// ---=== POW ===---
+/**
+ * @brief Fast approximate power of an array with a constant exponent (see fln::bithack::pow).
+ * @param in The input array of bases.
+ * @param out The output array.
+ * @param n The number of elements.
+ * @param p The exponent.
+ */
+inline void pow(const f32* in, f32* out, size_t n, const f32& p) noexcept {
+    detail::apply(in, out, n, [p](const f32& x) { return bithack::pow(x, p); });
+}
+/**
+ * @brief Fast approximate power of an array with a constant exponent (see fln::bithack::pow).
+ * @param in The input array of bases.
+ * @param out The output array.
+ * @param n The number of elements.
+ * @param p The exponent.
+ */
+inline void pow(const f64* in, f64* out, size_t n, const f64& p) noexcept {
+    detail::apply(in, out, n, [p](const f64& x) { return bithack::pow(x, p); });
+}
+/**
+ * @brief Fast approximate element-wise power of an array (see fln::bithack::pow).
+ * @param in The input array of bases.
+ * @param p The input array of exponents.
+ * @param out The output array.
+ * @param n The number of elements.
+ */
+inline void pow(const f32* in, const f32* p, f32* out, size_t n) noexcept {
+    detail::apply(in, p, out, n, [](const f32& x, const f32& y) { return bithack::pow(x, y); });
+}
+/**
+ * @brief Fast approximate element-wise power of an array (see fln::bithack::pow).
+ * @param in The input array of bases.
+ * @param p The input array of exponents.
+ * @param out The output array.
+ * @param n The number of elements.
+ */
+inline void pow(const f64* in, const f64* p, f64* out, size_t n) noexcept {
+    detail::apply(in, p, out, n, [](const f64& x, const f64& y) { return bithack::pow(x, y); });
+}
+/**
+ * @brief Fast approximate power of an array with a constant exponent (see fln::bithack::pow).
+ * @param in The input span of bases.
+ * @param out The output span.
+ * @param p The exponent.
+ */
+inline void pow(std::span<const f32> in, std::span<f32> out, const f32& p) noexcept { pow(in.data(), out.data(), detail::size(in.size(), out.size()), p); }
+/**
+ * @brief Fast approximate power of an array with a constant exponent (see fln::bithack::pow).
+ * @param in The input span of bases.
+ * @param out The output span.
+ * @param p The exponent.
+ */
+inline void pow(std::span<const f64> in, std::span<f64> out, const f64& p) noexcept { pow(in.data(), out.data(), detail::size(in.size(), out.size()), p); }
+/**
+ * @brief Fast approximate element-wise power of an array (see fln::bithack::pow).
+ * @param in The input span of bases.
+ * @param p The input span of exponents.
+ * @param out The output span.
+ */
+inline void pow(std::span<const f32> in, std::span<const f32> p, std::span<f32> out) noexcept {
+    pow(in.data(), p.data(), out.data(), detail::size(detail::size(in.size(), p.size()), out.size()));
+}
+/**
+ * @brief Fast approximate element-wise power of an array (see fln::bithack::pow).
+ * @param in The input span of bases.
+ * @param p The input span of exponents.
+ * @param out The output span.
+ */
+inline void pow(std::span<const f64> in, std::span<const f64> p, std::span<f64> out) noexcept {
+    pow(in.data(), p.data(), out.data(), detail::size(detail::size(in.size(), p.size()), out.size()));
+}
+
+// ---=== SQRT ===---
+/**
+ * @brief Fast approximate square root of an array (see fln::bithack::sqrt).
+ * @param in The input array.
+ * @param out The output array.
+ * @param n The number of elements.
+ */
+inline void sqrt(const f32* in, f32* out, size_t n) noexcept {
+    detail::apply(in, out, n, [](const f32& x) { return bithack::sqrt(x); });
+}
+/**
+ * @brief Fast approximate square root of an array (see fln::bithack::sqrt).
+ * @param in The input array.
+ * @param out The output array.
+ * @param n The number of elements.
+ */
+inline void sqrt(const f64* in, f64* out, size_t n) noexcept {
+    detail::apply(in, out, n, [](const f64& x) { return bithack::sqrt(x); });
+}
+/**
+ * @brief Fast approximate square root of an array (see fln::bithack::sqrt).
+ * @param in The input span.
+ * @param out The output span.
+ */
+inline void sqrt(std::span<const f32> in, std::span<f32> out) noexcept { sqrt(in.data(), out.data(), detail::size(in.size(), out.size())); }
+/**
+ * @brief Fast approximate square root of an array (see fln::bithack::sqrt).
+ * @param in The input span.
+ * @param out The output span.
+ */
+inline void sqrt(std::span<const f64> in, std::span<f64> out) noexcept { sqrt(in.data(), out.data(), detail::size(in.size(), out.size())); }
+
+/**
+ * @brief Fast approximate square root of an array (see fln::bithack::sqrt_pow).
+ * @param in The input array.
+ * @param out The output array.
+ * @param n The number of elements.
+ */
+inline void sqrt_pow(const f32* in, f32* out, size_t n) noexcept {
+    detail::apply(in, out, n, [](const f32& x) { return bithack::sqrt_pow(x); });
+}
+/**
+ * @brief Fast approximate square root of an array (see fln::bithack::sqrt_pow).
+ * @param in The input array.
+ * @param out The output array.
+ * @param n The number of elements.
+ */
+inline void sqrt_pow(const f64* in, f64* out, size_t n) noexcept {
+    detail::apply(in, out, n, [](const f64& x) { return bithack::sqrt_pow(x); });
+}
+/**
+ * @brief Fast approximate square root of an array (see fln::bithack::sqrt_pow).
+ * @param in The input span.
+ * @param out The output span.
+ */
+inline void sqrt_pow(std::span<const f32> in, std::span<f32> out) noexcept { sqrt_pow(in.data(), out.data(), detail::size(in.size(), out.size())); }
+/**
+ * @brief Fast approximate square root of an array (see fln::bithack::sqrt_pow).
+ * @param in The input span.
+ * @param out The output span.
+ */
+inline void sqrt_pow(std::span<const f64> in, std::span<f64> out) noexcept { sqrt_pow(in.data(), out.data(), detail::size(in.size(), out.size())); }
+
+/**
+ * @brief Fast approximate square root of an array (see fln::bithack::sqrt_b).
+ * @param in The input array.
+ * @param out The output array.
+ * @param n The number of elements.
+ */
+inline void sqrt_b(const f32* in, f32* out, size_t n) noexcept {
+    detail::apply(in, out, n, [](const f32& x) { return bithack::sqrt_b(x); });
+}
+/**
+ * @brief Fast approximate square root of an array (see fln::bithack::sqrt_b).
+ * @param in The input span.
+ * @param out The output span.
+ */
+inline void sqrt_b(std::span<const f32> in, std::span<f32> out) noexcept { sqrt_b(in.data(), out.data(), detail::size(in.size(), out.size())); }
+
+// ---=== INVERSE SQRT ===---
+/**
+ * @brief Fast approximate inverse square root of an array (see fln::bithack::rsqrt_quake).
+ * @param in The input array.
+ * @param out The output array.
+ * @param n The number of elements.
+ */
+inline void rsqrt_quake(const f32* in, f32* out, size_t n) noexcept {
+    detail::apply(in, out, n, [](const f32& x) { return bithack::rsqrt_quake(x); });
+}
+/**
+ * @brief Fast approximate inverse square root of an array (see fln::bithack::rsqrt_quake).
+ * @param in The input span.
+ * @param out The output span.
+ */
+inline void rsqrt_quake(std::span<const f32> in, std::span<f32> out) noexcept { rsqrt_quake(in.data(), out.data(), detail::size(in.size(), out.size())); }
+
+}// namespace fln::bithack::batch
@@ -7,7 +7,10 @@
 
 #pragma once
 #include "baseDefines.h"
+#include "approximationPolynomials.h"
 #include "baseType.h"
+#include <bit>
+#include <stdexcept>
 
 namespace fln {
 
@@ -32,31 +35,39 @@ constexpr u64 negZero64 = 0x8000000000000000;///< mask of the sign bit for 64bit
 constexpr u32 nnegZero32= ~negZero32;        ///< mask of the 32 bits except sign bit
 constexpr u64 nnegZero64= ~negZero64;        ///< mask of the 64 bits except sign bit
 
+// Bit masks and shifts for the mantissa and exponent
+constexpr u32 mantMask32= 0x007FFFFF;        ///< mask of the mantissa for 32 bits
+constexpr u64 mantMask64= 0x000FFFFFFFFFFFFF;///< mask of the mantissa for 64 bits
+constexpr u32 mantBits32= 23U;               ///< number of bits of the mantissa for 32 bits
+constexpr u64 mantBits64= 52U;               ///< number of bits of the mantissa for 64 bits
+constexpr s32 expoBias32= 127;               ///< bias of the exponent for 32 bits
+constexpr s64 expoBias64= 1023;              ///< bias of the exponent for 64 bits
+
 // Conversions float & int
 /**
  * @brief Get the 32bit float bit representation as 32bit unsigned
  * @param f The float to convert
  * @return The 32bits
  */
-[[nodiscard]] constexpr u32 asInt(const f32& f) { return *(u32*)&f; }
+[[nodiscard]] constexpr u32 asInt(const f32& f) { return std::bit_cast<u32>(f); }
 /**
  * @brief Get the 64bit float bit representation as 64bit unsigned
  * @param f The float to convert
  * @return The 64bits
  */
-[[nodiscard]] constexpr u64 asInt(const f64& f) { return *(u64*)&f; }
+[[nodiscard]] constexpr u64 asInt(const f64& f) { return std::bit_cast<u64>(f); }
 /**
  * @brief Get the 32bit float based on a 32bit representation.
  * @param i The 32bits integer.
  * @return The corresponding 32bit float.
  */
-[[nodiscard]] constexpr f32 asFloat(const u32& i) { return *(f32*)&i; }
+[[nodiscard]] constexpr f32 asFloat(const u32& i) { return std::bit_cast<f32>(i); }
 /**
  * @brief Get the 64bit float based on a 64bit representation.
  * @param i The 64bits integer.
  * @return The corresponding 64bit float.
  */
-[[nodiscard]] constexpr f64 asFloat(const u64& i) { return *(f64*)&i; }
+[[nodiscard]] constexpr f64 asFloat(const u64& i) { return std::bit_cast<f64>(i); }
 
 //sign
 /**
@@ -147,6 +158,88 @@ constexpr u64 nnegZero64= ~negZero64;        ///< mask of the 64 bits except sig
  */
 [[nodiscard]] constexpr f64 exp2(const f64& f) { return asFloat(s64(f * ScaleUp64) + oneAsInt64); }
 
+/**
+ * @brief Approximate logarithm base 2 with a polynomial correction of the mantissa.
+ *
+ * Works for positive normalized values of f, for other values, the behavior is undefined.
+ *
+ * Maximum absolute error (see fln::poly::Log2):
+ * - Precision::Fast: 7.7e-3
+ * - Precision::Medium: 1.2e-4
+ * - Precision::High: 2.0e-5 (float rounding for large exponents)
+ *
+ * @tparam P The precision tier.
+ * @param f The input value.
+ * @return The approximate log2.
+ */
+template<Precision P>
+[[nodiscard]] constexpr f32 log2(const f32& f) {
+    const u32 i= asInt(f);
+    const f32 m= f32(i & mantMask32) * ScaleDown32;
+    return f32(s32(i >> mantBits32) - expoBias32) + poly::horner<f32>(poly::Log2<P>::coefficients, m);
+}
+/**
+ * @brief Approximate logarithm base 2 with a polynomial correction of the mantissa.
+ *
+ * Works for positive normalized values of f, for other values, the behavior is undefined.
+ *
+ * Maximum absolute error (see fln::poly::Log2):
+ * - Precision::Fast: 7.7e-3
+ * - Precision::Medium: 1.2e-4
+ * - Precision::High: 1.6e-5
+ *
+ * @tparam P The precision tier.
+ * @param f The input value.
+ * @return The approximate log2.
+ */
+template<Precision P>
+[[nodiscard]] constexpr f64 log2(const f64& f) {
+    const u64 i= asInt(f);
+    const f64 m= f64(i & mantMask64) * ScaleDown64;
+    return f64(s64(i >> mantBits64) - expoBias64) + poly::horner<f64>(poly::Log2<P>::coefficients, m);
+}
+
+/**
+ * @brief Approximate power of 2 with a polynomial correction of the mantissa.
+ *
+ * Works for values between -126 & 127, else the result is overflowing 32bits float and behavior is undefined.
+ *
+ * Maximum relative error (see fln::poly::Exp2):
+ * - Precision::Fast: 2.7e-3
+ * - Precision::Medium: 3.5e-6
+ * - Precision::High: 1.9e-7 (float rounding)
+ *
+ * @tparam P The precision tier.
+ * @param f The input value.
+ * @return The approximate exp2.
+ */
+template<Precision P>
+[[nodiscard]] constexpr f32 exp2(const f32& f) {
+    const s32 e = s32(f) - (f < f32(s32(f)));// floor
+    const f32 fr= f - f32(e);
+    return asFloat(asInt(1.0f + poly::horner<f32>(poly::Exp2<P>::coefficients, fr)) + (u32(e) << mantBits32));
+}
+/**
+ * @brief Approximate power of 2 with a polynomial correction of the mantissa.
+ *
+ * Works for values between -1022 & 1023, else the result is overflowing 64bits float and behavior is undefined.
+ *
+ * Maximum relative error (see fln::poly::Exp2):
+ * - Precision::Fast: 2.7e-3
+ * - Precision::Medium: 3.4e-6
+ * - Precision::High: 9.3e-8
+ *
+ * @tparam P The precision tier.
+ * @param f The input value.
+ * @return The approximate exp2.
+ */
+template<Precision P>
+[[nodiscard]] constexpr f64 exp2(const f64& f) {
+    const s64 e = s64(f) - (f < f64(s64(f)));// floor
+    const f64 fr= f - f64(e);
+    return asFloat(asInt(1.0 + poly::horner<f64>(poly::Exp2<P>::coefficients, fr)) + (u64(e) << mantBits64));
+}
+
 /**
  * @brief compute the power p of float f
  * @param f the base
@@ -201,28 +294,164 @@ constexpr u64 nnegZero64= ~negZero64;        ///< mask of the 64 bits except sig
     return bithack::asFloat(sqrt_magic + (bithack::asInt(x) >> 1U));
 }
 
+// Newton-Raphson refinement
+/**
+ * @brief Measured maximum relative errors of the refined square roots and inverse square roots, over the whole normal range
+ *
+ * The index of the arrays is the number of Newton-Raphson steps.
+ */
+namespace refinement {
+constexpr u32 rsqrtMagic32= 0x5f3759dfU;           ///< magic number for the inverse square root of 32 bits floats
+constexpr u64 rsqrtMagic64= 0x5FE6EB50C7B537A9ULL; ///< magic number for the inverse square root of 64 bits floats
+constexpr f64 rsqrtError32[]= {3.5e-2, 1.8e-3, 4.8e-6, 2.0e-7};        ///< rsqrt errors for 32 bits floats
+constexpr f64 rsqrtError64[]= {3.5e-2, 1.8e-3, 4.7e-6, 3.2e-11, 4.4e-16};///< rsqrt errors for 64 bits floats
+constexpr f64 sqrtError32[] = {6.1e-2, 1.8e-3, 1.6e-6, 9.0e-8};        ///< sqrt errors for 32 bits floats
+constexpr f64 sqrtError64[] = {6.1e-2, 1.8e-3, 1.6e-6, 1.2e-12, 2.3e-16};///< sqrt errors for 64 bits floats
+
+/**
+ * @brief Get the smallest number of steps with an error below the tolerance.
+ *
+ * In a constant expression, an unreachable tolerance is a compilation error.
+ *
+ * @tparam N The number of known steps.
+ * @param errors The measured errors.
+ * @param tolerance The maximal relative error wanted.
+ * @return The number of steps.
+ * @throw std::invalid_argument if no number of steps reaches the tolerance.
+ */
+template<size_t N>
+[[nodiscard]] constexpr u32 stepsFor(const f64 (&errors)[N], const f64& tolerance) {
+    for(u32 i= 0; i < N; ++i)
+        if(errors[i] <= tolerance) return i;
+    throw std::invalid_argument("refinement: the tolerance cannot be reached");
+}
+}// namespace refinement
+
+/**
+ * @brief Get the cheapest number of refinement steps of rsqrt meeting a relative tolerance.
+ * @tparam T The float type.
+ * @param tolerance The maximal relative error wanted.
+ * @return The number of steps to use as template parameter of rsqrt.
+ * @throw std::invalid_argument if the tolerance cannot be reached (compilation error in a constant expression).
+ */
+template<class T>
+[[nodiscard]] constexpr u32 rsqrtSteps(const f64& tolerance) {
+    if constexpr(sizeof(T) == sizeof(f32)) return refinement::stepsFor(refinement::rsqrtError32, tolerance);
+    else return refinement::stepsFor(refinement::rsqrtError64, tolerance);
+}
+/**
+ * @brief Get the cheapest number of refinement steps of sqrt meeting a relative tolerance.
+ * @tparam T The float type.
+ * @param tolerance The maximal relative error wanted.
+ * @return The number of steps to use as template parameter of sqrt.
+ * @throw std::invalid_argument if the tolerance cannot be reached (compilation error in a constant expression).
+ */
+template<class T>
+[[nodiscard]] constexpr u32 sqrtSteps(const f64& tolerance) {
+    if constexpr(sizeof(T) == sizeof(f32)) return refinement::stepsFor(refinement::sqrtError32, tolerance);
+    else return refinement::stepsFor(refinement::sqrtError64, tolerance);
+}
+
+/**
+ * @brief Inverse square root with magic number estimate and Newton-Raphson refinement.
+ *
+ * Each step costs 3 multiplications and 1 subtraction. Maximum relative error (refinement::rsqrtError32):
+ * |Steps|0     |1     |2     |3     |
+ * |-----|------|------|------|------|
+ * |error|3.5e-2|1.8e-3|4.8e-6|2.0e-7|
+ *
+ * @tparam Steps The number of refinement steps.
+ * @param x The float to inverse square root (strictly positive).
+ * @return The inverse square root.
+ */
+template<u32 Steps>
+[[nodiscard]] constexpr f32 rsqrt(const f32& x) {
+    const f32 x2= x * 0.5F;
+    f32 y       = asFloat(refinement::rsqrtMagic32 - (asInt(x) >> 1U));
+    for(u32 i= 0; i < Steps; ++i) y= y * (1.5F - (x2 * y * y));
+    return y;
+}
+/**
+ * @brief Inverse square root with magic number estimate and Newton-Raphson refinement.
+ *
+ * Each step costs 3 multiplications and 1 subtraction. Maximum relative error (refinement::rsqrtError64):
+ * |Steps|0     |1     |2     |3      |4      |
+ * |-----|------|------|------|-------|-------|
+ * |error|3.5e-2|1.8e-3|4.7e-6|3.2e-11|4.4e-16|
+ *
+ * @tparam Steps The number of refinement steps.
+ * @param x The float to inverse square root (strictly positive).
+ * @return The inverse square root.
+ */
+template<u32 Steps>
+[[nodiscard]] constexpr f64 rsqrt(const f64& x) {
+    const f64 x2= x * 0.5;
+    f64 y       = asFloat(refinement::rsqrtMagic64 - (asInt(x) >> 1U));
+    for(u32 i= 0; i < Steps; ++i) y= y * (1.5 - (x2 * y * y));
+    return y;
+}
+
+/**
+ * @brief Square root with bit hack estimate and Newton-Raphson (Heron) refinement.
+ *
+ * Each step costs 1 division, 1 addition and 1 multiplication. Maximum relative error (refinement::sqrtError32):
+ * |Steps|0     |1     |2     |3     |
+ * |-----|------|------|------|------|
+ * |error|6.1e-2|1.8e-3|1.6e-6|9.0e-8|
+ *
+ * @tparam Steps The number of refinement steps.
+ * @param f The float to square root (strictly positive).
+ * @return The square root.
+ */
+template<u32 Steps>
+[[nodiscard]] constexpr f32 sqrt(const f32& f) {
+    f32 y= sqrt(f);
+    for(u32 i= 0; i < Steps; ++i) y= 0.5F * (y + f / y);
+    return y;
+}
+/**
+ * @brief Square root with bit hack estimate and Newton-Raphson (Heron) refinement.
+ *
+ * Each step costs 1 division, 1 addition and 1 multiplication. Maximum relative error (refinement::sqrtError64):
+ * |Steps|0     |1     |2     |3      |4      |
+ * |-----|------|------|------|-------|-------|
+ * |error|6.1e-2|1.8e-3|1.6e-6|1.2e-12|2.3e-16|
+ *
+ * @tparam Steps The number of refinement steps.
+ * @param f The float to square root (strictly positive).
+ * @return The square root.
+ */
+template<u32 Steps>
+[[nodiscard]] constexpr f64 sqrt(const f64& f) {
+    f64 y= sqrt(f);
+    for(u32 i= 0; i < Steps; ++i) y= 0.5 * (y + f / y);
+    return y;
+}
+/**
+ * @brief Square root using codingame formula with Newton-Raphson (Heron) refinement.
+ *
+ * Same errors as the refined fln::bithack::sqrt.
+ *
+ * @tparam Steps The number of refinement steps.
+ * @param x The float to square root (strictly positive).
+ * @return The square root.
+ */
+template<u32 Steps>
+[[nodiscard]] constexpr f32 sqrt_b(const f32& x) {
+    f32 y= sqrt_b(x);
+    for(u32 i= 0; i < Steps; ++i) y= 0.5F * (y + x / y);
+    return y;
+}
+
 /**
  * @brief inverse square root as defined n Quake
+ *
+ * This is fln::bithack::rsqrt with one refinement step.
+ *
  * @param x the float to inverse square root
  * @return theinverse square root
  */
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wstrict-aliasing"
-[[nodiscard]] inline f32 rsqrt_quake(const f32& x) {
-    long i;
-    float x2, y;
-    const float threehalfs= 1.5F;
-
-    x2= x * 0.5F;
-    y = x;
-    i = *(long*)&y;           // evil floating point bit level hacking
-    i = 0x5f3759df - (i >> 1);// what the fuck?
-    y = *(float*)&i;
-    y = y * (threehalfs - (x2 * y * y));// 1st iteration
-    //	y = y * ( threehalfs - ( x2 * y * y ) ); // 2nd iteration, this can be removed
-    return y;
-}
-#pragma GCC diagnostic pop
+[[nodiscard]] constexpr f32 rsqrt_quake(const f32& x) { return rsqrt<1>(x); }
 }// namespace bithack
 
 // ---=== SQRT 32 ===---
@@ -0,0 +1,102 @@
+/**
+ * \file bithack_SimdFunctions.h
+ *
+ * \date 17/10/2026
+ * \author Silmaen
+ */
+
+#pragma once
+#include "baseType.h"
+
+/**
+ * @brief explicit SIMD versions of the bit hack array functions with runtime dispatch
+ *
+ * The kernels are hand written with SSE4.1, AVX2 and AVX-512 intrinsics. The best
+ * instruction set available on the host is detected once (cpuid) at the first call,
+ * with a scalar fallback (fln::bithack::batch) when none is available or on non x86 targets.
+ *
+ * The results are the same as the scalar fln::bithack functions, the only possible
+ * differences are last bit rounding where the compiler contracts multiply-add into fma.
+ */
+namespace fln::bithack::simd {
+
+/**
+ * @brief The instruction sets that can be used by the kernels
+ */
+enum struct Isa {
+    Scalar,///< no explicit SIMD, fall back to fln::bithack::batch
+    SSE41, ///< SSE 4.1, 4 floats per vector
+    AVX2,  ///< AVX2, 8 floats per vector
+    AVX512 ///< AVX-512 foundation, 16 floats per vector
+};
+
+/**
+ * @brief Get the name of an instruction set.
+ * @param isa The instruction set.
+ * @return Its name.
+ */
+[[nodiscard]] const char* isaName(Isa isa) noexcept;
+/**
+ * @brief Check if the host CPU supports an instruction set.
+ * @param isa The instruction set to check.
+ * @return True if the kernels of this instruction set can run.
+ */
+[[nodiscard]] bool isSupported(Isa isa) noexcept;
+/**
+ * @brief Get the best instruction set supported by the host CPU.
+ * @return The best instruction set.
+ */
+[[nodiscard]] Isa bestIsa() noexcept;
+/**
+ * @brief Get the instruction set currently used by the kernels.
+ * @return The active instruction set.
+ */
+[[nodiscard]] Isa activeIsa() noexcept;
+/**
+ * @brief Force the instruction set used by the kernels (mainly for testing and benchmarking).
+ *
+ * If the host CPU does not support the requested set, the active set is not changed.
+ *
+ * @param isa The instruction set to use.
+ * @return True if the instruction set is now active.
+ */
+bool setActiveIsa(Isa isa) noexcept;
+
+/**
+ * @brief Fast approximate logarithm base 2 of an array (see fln::bithack::log2).
+ * @param in The input array.
+ * @param out The output array.
+ * @param n The number of elements.
+ */
+void log2(const f32* in, f32* out, size_t n) noexcept;
+/**
+ * @brief Fast approximate power of 2 of an array (see fln::bithack::exp2).
+ * @param in The input array.
+ * @param out The output array.
+ * @param n The number of elements.
+ */
+void exp2(const f32* in, f32* out, size_t n) noexcept;
+/**
+ * @brief Fast approximate power of an array with a constant exponent (see fln::bithack::pow).
+ * @param in The input array of bases.
+ * @param out The output array.
+ * @param n The number of elements.
+ * @param p The exponent.
+ */
+void pow(const f32* in, f32* out, size_t n, f32 p) noexcept;
+/**
+ * @brief Fast approximate square root of an array (see fln::bithack::sqrt).
+ * @param in The input array.
+ * @param out The output array.
+ * @param n The number of elements.
+ */
+void sqrt(const f32* in, f32* out, size_t n) noexcept;
+/**
+ * @brief Fast approximate inverse square root of an array (see fln::bithack::rsqrt_quake).
+ * @param in The input array.
+ * @param out The output array.
+ * @param n The number of elements.
+ */
+void rsqrt(const f32* in, f32* out, size_t n) noexcept;
+
+}// namespace fln::bithack::simd
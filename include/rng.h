@@ -4,6 +4,12 @@
 */
 #pragma once
 #include "baseType.h"
+#include "bithack_Functions.h"
+#include <array>
+#include <bit>
+#include <ctime>
+#include <span>
+#include <vector>
 
 /**
  * @namespace fln::rand
@@ -11,25 +17,167 @@
  */
 namespace fln::rand {
 
+namespace detail {
+/**
+ * @brief Full 64 x 64 bits product.
+ * @param a The first factor.
+ * @param b The second factor.
+ * @param lo The low 64 bits of the product.
+ * @return The high 64 bits of the product.
+ */
+constexpr u64 mulHigh(const u64& a, const u64& b, u64& lo) noexcept {
+#if defined(__SIZEOF_INT128__)
+    __extension__ using u128= unsigned __int128;
+    const u128 p            = static_cast<u128>(a) * b;
+    lo                      = static_cast<u64>(p);
+    return static_cast<u64>(p >> 64U);
+#else
+    const u64 aL= a & 0xFFFFFFFFU, aH= a >> 32U, bL= b & 0xFFFFFFFFU, bH= b >> 32U;
+    const u64 ll= aL * bL, lh= aL * bH, hl= aH * bL, hh= aH * bH;
+    const u64 mid= (ll >> 32U) + (lh & 0xFFFFFFFFU) + (hl & 0xFFFFFFFFU);
+    lo           = (mid << 32U) | (ll & 0xFFFFFFFFU);
+    return hh + (lh >> 32U) + (hl >> 32U) + (mid >> 32U);
+#endif
+}
+}// namespace detail
+
+/**
+ * @brief Interval of the uniform floats
+ */
+enum struct Interval {
+    ClosedOpen,///< [0, 1)
+    OpenClosed ///< (0, 1]
+};
+
+/**
+ * @brief Uniform float from random bits: the upper 23 bits fill the mantissa of a float in [1, 2).
+ *
+ * Branch free, the results are multiples of 2^-23.
+ *
+ * @tparam I The interval.
+ * @param bits The random bits.
+ * @return The uniform float in [0, 1) or (0, 1].
+ */
+template<Interval I= Interval::ClosedOpen>
+[[nodiscard]] constexpr f32 uniformF32(const u64& bits) noexcept {
+    const f32 x= bithack::asFloat(static_cast<u32>(0x3F800000U | (bits >> 41U)));
+    if constexpr(I == Interval::ClosedOpen) return x - 1.0f;
+    else return 2.0f - x;
+}
+/**
+ * @brief Uniform double from random bits: the upper 52 bits fill the mantissa of a double in [1, 2).
+ *
+ * Branch free, the results are multiples of 2^-52.
+ *
+ * @tparam I The interval.
+ * @param bits The random bits.
+ * @return The uniform double in [0, 1) or (0, 1].
+ */
+template<Interval I= Interval::ClosedOpen>
+[[nodiscard]] constexpr f64 uniformF64(const u64& bits) noexcept {
+    const f64 x= bithack::asFloat(static_cast<u64>(0x3FF0000000000000ULL | (bits >> 12U)));
+    if constexpr(I == Interval::ClosedOpen) return x - 1.0;
+    else return 2.0 - x;
+}
+
+/**
+ * @brief Common helpers of the generators, built on the engine's u64 rand() function.
+ *
+ * The bounded integers use Lemire's multiply-shift method: the random number times the
+ * bound is a fixed point number whose integer part is the result. Draws falling in the
+ * 2^N mod bound values that would bias the result are rejected, which is decided with
+ * a multiplication in the common case (the division only runs when a rejection is
+ * possible, with probability bound / 2^N). The draws take the upper bits of rand(), the
+ * 16 bits version uses 32 bits draws to keep the rejections rare.
+ *
+ * @tparam Engine The generator (CRTP).
+ */
+template<typename Engine>
+struct RandomHelpers {
+    /**
+     * @brief Uniform integer in [0, bound), bound must not be 0.
+     * @param bound The upper bound (excluded).
+     * @return The random number.
+     */
+    inline u64 getRandomU64(const u64& bound) {
+        u64 lo= 0;
+        u64 hi= detail::mulHigh(engine().rand(), bound, lo);
+        if(lo < bound) {
+            const u64 threshold= (0 - bound) % bound;
+            while(lo < threshold) hi= detail::mulHigh(engine().rand(), bound, lo);
+        }
+        return hi;
+    }
+    /**
+     * @brief Uniform integer in [0, bound), bound must not be 0.
+     * @param bound The upper bound (excluded).
+     * @return The random number.
+     */
+    inline u32 getRandomU32(const u32& bound) {
+        u64 m= (engine().rand() >> 32U) * bound;
+        if(static_cast<u32>(m) < bound) {
+            const u32 threshold= (0U - bound) % bound;
+            while(static_cast<u32>(m) < threshold) m= (engine().rand() >> 32U) * bound;
+        }
+        return static_cast<u32>(m >> 32U);
+    }
+    /**
+     * @brief Uniform integer in [0, bound), bound must not be 0.
+     * @param bound The upper bound (excluded).
+     * @return The random number.
+     */
+    inline u16 getRandomU16(const u16& bound) { return static_cast<u16>(getRandomU32(bound)); }
+    inline u64 getRandomU64(const u64& a, const u64& b) { return (a + getRandomU64(b - a + 1ULL)); }
+    inline u32 getRandomU32(const u32& a, const u32& b) { return (a + getRandomU32(b - a + 1UL)); }
+    inline u16 getRandomU16(const u16& a, const u16& b) { return (a + getRandomU16(b - a + 1U)); }
+    /**
+     * @brief Uniform float in [0, 1) or (0, 1], with a 2^-23 resolution.
+     * @tparam I The interval.
+     * @return The random number.
+     */
+    template<Interval I= Interval::ClosedOpen>
+    inline f32 getRandomF32() { return uniformF32<I>(engine().rand()); }
+    /**
+     * @brief Uniform double in [0, 1) or (0, 1], with a 2^-52 resolution.
+     * @tparam I The interval.
+     * @return The random number.
+     */
+    template<Interval I= Interval::ClosedOpen>
+    inline f64 getRandomF64() { return uniformF64<I>(engine().rand()); }
+    /**
+     * @brief Uniform float in [a, b) (b may be reached by the rounding of a + u * (b - a)).
+     * @param a The lower bound.
+     * @param b The upper bound.
+     * @return The random number.
+     */
+    inline f32 getRandomF32(const f32& a, const f32& b) { return a + getRandomF32() * (b - a); }
+    /**
+     * @brief Uniform double in [a, b) (b may be reached by the rounding of a + u * (b - a)).
+     * @param a The lower bound.
+     * @param b The upper bound.
+     * @return The random number.
+     */
+    inline f64 getRandomF64(const f64& a, const f64& b) { return a + getRandomF64() * (b - a); }
+
+private:
+    /**
+     * @brief Access to the engine.
+     * @return The engine.
+     */
+    Engine& engine() { return static_cast<Engine&>(*this); }
+};
+
 /**
  * @brief simple and fast random number generator based of xorshift64 algorithm
  */
-struct RandomGenerator {
+struct RandomGenerator: RandomHelpers<RandomGenerator> {
     RandomGenerator(u64 _seed= 0) {
         if(_seed == 0) {
-            seed= (u64)time(0);
+            seed= static_cast<u64>(std::time(nullptr));
         } else {
             seed= _seed;
         }
     }
-    inline u64 getRandomU64(const u64& bound) { return (rand() % bound); }
-    inline u32 getRandomU32(const u32& bound) { return (rand() % bound); }
-    inline u16 getRandomU16(const u16& bound) { return (rand() % bound); }
-    inline u64 getRandomU64(const u64& a, const u64& b) { return (a + getRandomU64(b - a + 1ULL)); }
-    inline u32 getRandomU32(const u32& a, const u32& b) { return (a + getRandomU32(b - a + 1UL)); }
-    inline u16 getRandomU16(const u16& a, const u16& b) { return (a + getRandomU16(b - a + 1U)); }
-    inline f32 getRandomF32(const f32& a, const f32& b) { return (a + (static_cast<f32>(rand()) / 0x7FFF) * (b - a)); }
-    inline f32 getRandomF64(const f64& a, const f64& b) { return (a + (static_cast<f64>(rand()) / 0x7FFFFFFF) * (b - a)); }
     /**
      * @brief base rand function
      * @return new number
@@ -46,4 +194,351 @@ struct RandomGenerator {
     u64 seed;///< the actual seed of the generator
 };
 
-}// namespace fln::rand
\ No newline at end of file
+/**
+ * @brief splitmix64 step, used to expand a seed into a full state
+ * @param x The splitmix state, updated.
+ * @return The next number.
+ */
+constexpr u64 splitMix64(u64& x) noexcept {
+    u64 z= (x+= 0x9E3779B97F4A7C15ULL);
+    z    = (z ^ (z >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+    z    = (z ^ (z >> 27U)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31U);
+}
+
+/**
+ * @brief Build the state of a generator from a seed with splitmix64.
+ * @tparam N The number of words of the state.
+ * @param seed The seed (0: use the current time).
+ * @return The state.
+ */
+template<size_t N>
+std::array<u64, N> seedState(u64 seed) noexcept {
+    u64 x= seed != 0 ? seed : static_cast<u64>(std::time(nullptr));
+    std::array<u64, N> state{};
+    for(auto& s: state) s= splitMix64(x);
+    return state;
+}
+
+/**
+ * @brief xoshiro256** generator (Blackman & Vigna): 256 bits of state, period 2^256-1
+ *
+ * All the output bits are good, this is the general purpose engine.
+ */
+struct Xoshiro256ss: RandomHelpers<Xoshiro256ss> {
+    /**
+     * @brief Constructor from a seed, expanded with splitmix64.
+     * @param seed The seed (0: use the current time).
+     */
+    explicit Xoshiro256ss(u64 seed= 0) noexcept:
+        state{seedState<4>(seed)} {}
+    /**
+     * @brief Constructor from a full state (must not be all zero).
+     * @param s The state.
+     */
+    explicit Xoshiro256ss(const std::array<u64, 4>& s) noexcept:
+        state{s} {}
+    /**
+     * @brief base rand function
+     * @return new number
+     */
+    u64 rand() noexcept {
+        const u64 result= std::rotl(state[1] * 5U, 7) * 9U;
+        const u64 t     = state[1] << 17U;
+        state[2]^= state[0];
+        state[3]^= state[1];
+        state[1]^= state[2];
+        state[0]^= state[3];
+        state[2]^= t;
+        state[3]= std::rotl(state[3], 45);
+        return result;
+    }
+    /**
+     * @brief Advance the generator by 2^128 numbers: 2^128 non-overlapping streams.
+     */
+    void jump() noexcept { apply({0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL, 0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL}); }
+    /**
+     * @brief Advance the generator by 2^192 numbers: 2^64 starting points, each of them split by jump().
+     */
+    void longJump() noexcept { apply({0x76E15D3EFEFDCBBFULL, 0xC5004E441C522FB3ULL, 0x77710069854EE241ULL, 0x39109BB02ACBE635ULL}); }
+    std::array<u64, 4> state;///< the state of the generator
+
+private:
+    /**
+     * @brief Apply a jump polynomial.
+     * @param poly The polynomial.
+     */
+    void apply(const std::array<u64, 4>& poly) noexcept {
+        std::array<u64, 4> s{};
+        for(const u64 p: poly) {
+            for(u32 b= 0; b < 64; ++b) {
+                if((p >> b) & 1U) {
+                    for(size_t i= 0; i < 4; ++i) s[i]^= state[i];
+                }
+                rand();
+            }
+        }
+        state= s;
+    }
+};
+
+/**
+ * @brief xoroshiro128+ generator (Blackman & Vigna): 128 bits of state, period 2^128-1
+ *
+ * Faster than xoshiro256** but the lowest bits are of lower quality: best used for
+ * floats, which take the upper bits.
+ */
+struct Xoroshiro128p: RandomHelpers<Xoroshiro128p> {
+    /**
+     * @brief Constructor from a seed, expanded with splitmix64.
+     * @param seed The seed (0: use the current time).
+     */
+    explicit Xoroshiro128p(u64 seed= 0) noexcept:
+        state{seedState<2>(seed)} {}
+    /**
+     * @brief Constructor from a full state (must not be all zero).
+     * @param s The state.
+     */
+    explicit Xoroshiro128p(const std::array<u64, 2>& s) noexcept:
+        state{s} {}
+    /**
+     * @brief base rand function
+     * @return new number
+     */
+    u64 rand() noexcept {
+        const u64 s0    = state[0];
+        u64 s1          = state[1];
+        const u64 result= s0 + s1;
+        s1^= s0;
+        state[0]= std::rotl(s0, 24) ^ s1 ^ (s1 << 16U);
+        state[1]= std::rotl(s1, 37);
+        return result;
+    }
+    /**
+     * @brief Advance the generator by 2^64 numbers: 2^64 non-overlapping streams.
+     */
+    void jump() noexcept { apply({0xDF900294D8F554A5ULL, 0x170865DF4B3201FCULL}); }
+    /**
+     * @brief Advance the generator by 2^96 numbers: 2^32 starting points, each of them split by jump().
+     */
+    void longJump() noexcept { apply({0xD2A98B26625EEE7BULL, 0xDDDF9B1090AA7AC1ULL}); }
+    std::array<u64, 2> state;///< the state of the generator
+
+private:
+    /**
+     * @brief Apply a jump polynomial.
+     * @param poly The polynomial.
+     */
+    void apply(const std::array<u64, 2>& poly) noexcept {
+        std::array<u64, 2> s{};
+        for(const u64 p: poly) {
+            for(u32 b= 0; b < 64; ++b) {
+                if((p >> b) & 1U) {
+                    s[0]^= state[0];
+                    s[1]^= state[1];
+                }
+                rand();
+            }
+        }
+        state= s;
+    }
+};
+
+/**
+ * @brief Split a generator into non-overlapping streams, typically one per thread.
+ *
+ * Stream i is the base generator advanced by i jump(). Use longJump() on the base to get
+ * another independent set of streams (per process or per node).
+ *
+ * @tparam Engine A generator with a jump() function.
+ * @param base The first stream.
+ * @param count The number of streams.
+ * @return The streams.
+ */
+template<typename Engine>
+[[nodiscard]] std::vector<Engine> makeStreams(Engine base, size_t count) {
+    std::vector<Engine> streams;
+    streams.reserve(count);
+    for(size_t i= 0; i < count; ++i) {
+        streams.push_back(base);
+        base.jump();
+    }
+    return streams;
+}
+
+/**
+ * @brief Eight interleaved xoshiro256** streams filling arrays of random numbers.
+ *
+ * Lane i is Xoshiro256ss(seed) advanced by i jump(), the outputs are taken in turn from
+ * the lanes: out[8 * k + i] is the k-th number of lane i. The lanes are updated together
+ * in SIMD registers (AVX2 when it is the active instruction set, see
+ * fln::bithack::simd::setActiveIsa), the results do not depend on the instruction set.
+ * A call always consumes whole blocks of 8 numbers: the unused end of the last block is
+ * dropped.
+ */
+struct BulkRandomGenerator {
+    static constexpr size_t lanes= 8;///< number of interleaved streams
+    /**
+     * @brief Constructor from a seed.
+     * @param seed The seed (0: use the current time).
+     */
+    explicit BulkRandomGenerator(u64 seed= 0) noexcept;
+    /**
+     * @brief Constructor from the generator of the first lane.
+     * @param base The first lane.
+     */
+    explicit BulkRandomGenerator(Xoshiro256ss base) noexcept;
+    /**
+     * @brief Fill with random 64 bits integers.
+     * @param out The output.
+     */
+    void fill(std::span<u64> out) noexcept;
+    /**
+     * @brief Fill with random 32 bits integers (two per 64 bits number).
+     * @param out The output.
+     */
+    void fill(std::span<u32> out) noexcept;
+    /**
+     * @brief Fill with uniform floats in [0, 1) (two per 64 bits number).
+     * @param out The output.
+     */
+    void fill(std::span<f32> out) noexcept;
+    /**
+     * @brief Fill with uniform doubles in [0, 1).
+     * @param out The output.
+     */
+    void fill(std::span<f64> out) noexcept;
+    /**
+     * @brief Fill with uniform floats in [a, b) (two per 64 bits number).
+     * @param out The output.
+     * @param a The lower bound.
+     * @param b The upper bound.
+     */
+    void fill(std::span<f32> out, f32 a, f32 b) noexcept;
+    /**
+     * @brief Fill with uniform doubles in [a, b).
+     * @param out The output.
+     * @param a The lower bound.
+     * @param b The upper bound.
+     */
+    void fill(std::span<f64> out, f64 a, f64 b) noexcept;
+    alignas(64) std::array<std::array<u64, lanes>, 4> state;///< the states, word by word
+};
+
+/**
+ * @brief Philox4x32-10 counter based generator (Salmon et al.): the numbers only depend on (key, counter).
+ *
+ * The counter-th number of the stream key is at(key, counter): the work can be split
+ * between threads or nodes in any way and still give the same numbers, without sharing a
+ * state. 2^64 streams of 2^64 numbers. The counter based fill functions generate whole
+ * arrays with SIMD (AVX2 when it is the active instruction set, see
+ * fln::bithack::simd::setActiveIsa), the results do not depend on the instruction set.
+ */
+struct Philox4x32: RandomHelpers<Philox4x32> {
+    using Block= std::array<u32, 4>;///< a counter or an output of the bijection
+    using Key  = std::array<u32, 2>;///< a key of the bijection
+    /**
+     * @brief Constructor, all the keys are valid (0 included).
+     * @param k The key (the stream).
+     * @param c The first counter.
+     */
+    explicit Philox4x32(u64 k= 0, u64 c= 0) noexcept:
+        key{k}, counter{c} {}
+    /**
+     * @brief The keyed bijection: 10 rounds of Philox4x32.
+     * @param ctr The counter.
+     * @param k The key.
+     * @return The random bits.
+     */
+    [[nodiscard]] static constexpr Block block(Block ctr, Key k) noexcept {
+        for(u32 round= 0; round < 10; ++round) {
+            if(round > 0) {
+                k[0]+= 0x9E3779B9U;
+                k[1]+= 0xBB67AE85U;
+            }
+            const u64 p0= u64{0xD2511F53U} * ctr[0];
+            const u64 p1= u64{0xCD9E8D57U} * ctr[2];
+            ctr         = {static_cast<u32>(p1 >> 32U) ^ ctr[1] ^ k[0], static_cast<u32>(p1), static_cast<u32>(p0 >> 32U) ^ ctr[3] ^ k[1], static_cast<u32>(p0)};
+        }
+        return ctr;
+    }
+    /**
+     * @brief The counter-th number of a stream (a block gives the numbers 2n and 2n+1).
+     * @param k The key (the stream).
+     * @param c The counter.
+     * @return The random number.
+     */
+    [[nodiscard]] static constexpr u64 at(u64 k, u64 c) noexcept {
+        const Block b= block({static_cast<u32>(c >> 1U), static_cast<u32>(c >> 33U), 0, 0}, {static_cast<u32>(k), static_cast<u32>(k >> 32U)});
+        const size_t w= (c & 1U) * 2;
+        return b[w] | (u64{b[w + 1]} << 32U);
+    }
+    /**
+     * @brief base rand function: at(key, counter++)
+     * @return new number
+     */
+    u64 rand() noexcept {
+        const u64 c= counter++;
+        if((c >> 1U) != cachedBlock || key != cachedKey) {
+            cachedBlock= c >> 1U;
+            cachedKey  = key;
+            cache      = block({static_cast<u32>(c >> 1U), static_cast<u32>(c >> 33U), 0, 0}, {static_cast<u32>(key), static_cast<u32>(key >> 32U)});
+        }
+        const size_t w= (c & 1U) * 2;
+        return cache[w] | (u64{cache[w + 1]} << 32U);
+    }
+    /**
+     * @brief Fill with the numbers at(k, c), at(k, c + 1), ...
+     * @param k The key (the stream).
+     * @param c The first counter.
+     * @param out The output.
+     */
+    static void fill(u64 k, u64 c, std::span<u64> out) noexcept;
+    /**
+     * @brief Fill with uniform floats in [0, 1), two per number from at(k, c).
+     * @param k The key (the stream).
+     * @param c The first counter.
+     * @param out The output.
+     */
+    static void fill(u64 k, u64 c, std::span<f32> out) noexcept;
+    /**
+     * @brief Fill with uniform doubles in [0, 1), one per number from at(k, c).
+     * @param k The key (the stream).
+     * @param c The first counter.
+     * @param out The output.
+     */
+    static void fill(u64 k, u64 c, std::span<f64> out) noexcept;
+    /**
+     * @brief Fill from the current counter, which is advanced past the used numbers.
+     * @param out The output.
+     */
+    void fill(std::span<u64> out) noexcept {
+        fill(key, counter, out);
+        counter+= out.size();
+    }
+    /**
+     * @brief Fill from the current counter, which is advanced past the used numbers.
+     * @param out The output.
+     */
+    void fill(std::span<f32> out) noexcept {
+        fill(key, counter, out);
+        counter+= (out.size() + 1) / 2;
+    }
+    /**
+     * @brief Fill from the current counter, which is advanced past the used numbers.
+     * @param out The output.
+     */
+    void fill(std::span<f64> out) noexcept {
+        fill(key, counter, out);
+        counter+= out.size();
+    }
+    u64 key;    ///< the stream
+    u64 counter;///< the index of the next number
+
+private:
+    Block cache{};                     ///< the last computed block
+    u64 cachedBlock= ~u64{0};          ///< counter of the cached block
+    u64 cachedKey  = 0;                ///< key of the cached block
+};
+
+}// namespace fln::rand
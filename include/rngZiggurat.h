@@ -0,0 +1,287 @@
+/**
+ * \file rngZiggurat.h
+ *
+ * \date 17/10/2026
+ * \author Silmaen
+ */
+#pragma once
+#include "bithack_Functions.h"
+#include "rng.h"
+#include <array>
+#include <span>
+
+namespace fln::rand {
+
+namespace detail {
+
+/// ln(2) split in a high part with zeros in the low bits and the remainder
+constexpr f64 ln2Hi= 6.93147180369123816490e-01;
+/// low part of ln(2)
+constexpr f64 ln2Lo= 1.90821492927058770002e-10;
+/// 1 / ln(2)
+constexpr f64 invLn2= 1.44269504088896338700e+00;
+
+/**
+ * @brief Exponential with only basic IEEE operations: identical results on every platform.
+ *
+ * Range reduction by ln(2) and a degree 13 Taylor polynomial, error under 2 ULP for
+ * inputs in [-700, 700] (no handling of overflow, underflow or NaN).
+ *
+ * @param x The input.
+ * @return exp(x)
+ */
+[[nodiscard]] constexpr f64 exp(const f64& x) noexcept {
+    constexpr std::array<f64, 14> inverseFactorial{1.0, 1.0, 1.0 / 2, 1.0 / 6, 1.0 / 24, 1.0 / 120, 1.0 / 720, 1.0 / 5040, 1.0 / 40320, 1.0 / 362880,
+                                                   1.0 / 3628800, 1.0 / 39916800, 1.0 / 479001600, 1.0 / 6227020800};
+    const f64 kf= x * invLn2;
+    const s64 k = static_cast<s64>(kf + (kf < 0 ? -0.5 : 0.5));// nearest
+    const f64 r = (x - static_cast<f64>(k) * ln2Hi) - static_cast<f64>(k) * ln2Lo;
+    f64 p       = inverseFactorial[13];
+    for(size_t n= 13; n > 0; --n) p= p * r + inverseFactorial[n - 1];
+    return p * bithack::asFloat(static_cast<u64>(k + 1023) << 52U);
+}
+
+/**
+ * @brief Natural logarithm with only basic IEEE operations: identical results on every platform.
+ *
+ * The mantissa is reduced to [sqrt(1/2), sqrt(2)) and log(m) = 2 atanh((m-1)/(m+1)) is
+ * summed up to the power 25, error under 2 ULP for positive normalized inputs.
+ *
+ * @param x The input.
+ * @return log(x)
+ */
+[[nodiscard]] constexpr f64 log(const f64& x) noexcept {
+    const u64 bits= bithack::asInt(x);
+    s64 e         = static_cast<s64>(bits >> 52U) - 1023;
+    f64 m         = bithack::asFloat(static_cast<u64>((bits & 0x000FFFFFFFFFFFFFULL) | 0x3FF0000000000000ULL));
+    if(m > 1.41421356237309504880) {
+        m*= 0.5;
+        ++e;
+    }
+    const f64 s = (m - 1.0) / (m + 1.0);
+    const f64 s2= s * s;
+    f64 p       = 1.0 / 25;
+    for(s32 n= 23; n > 0; n-= 2) p= p * s2 + 1.0 / n;
+    return static_cast<f64>(e) * ln2Hi + (static_cast<f64>(e) * ln2Lo + 2.0 * s * p);
+}
+
+/**
+ * @brief Square root for the compile time tables (Newton iterations).
+ * @param x The positive input.
+ * @return sqrt(x)
+ */
+[[nodiscard]] constexpr f64 sqrt(const f64& x) noexcept {
+    if(x <= 0) return 0;
+    f64 g= bithack::asFloat(static_cast<u64>((bithack::asInt(x) >> 1U) + (1023ULL << 51U)));// halved exponent
+    for(u32 i= 0; i < 8; ++i) g= 0.5 * (g + x / g);
+    return g;
+}
+
+/**
+ * @brief Tables of a Ziggurat: C layers of equal area V under a decreasing density f.
+ *
+ * x[1] = R is the start of the tail, x[0] = V / f(R) the width of the base layer (the
+ * rectangle under f(R) plus the tail), x[C] = 0. Layer i spans [0, x[i]) in x and
+ * [f(x[i]), f(x[i+1])) in y.
+ *
+ * @tparam C The number of layers.
+ */
+template<size_t C>
+struct ZigguratTable {
+    std::array<f64, C + 1> x{};///< right edges of the layers
+    std::array<f64, C + 1> f{};///< density at the edges
+    std::array<f64, C> ratio{};///< x[i+1] / x[i]: the part of the layer fully under the density
+    f64 r= 0;                  ///< start of the tail
+};
+
+/**
+ * @brief Build the table of a density.
+ * @tparam C The number of layers.
+ * @tparam F The density.
+ * @tparam FInv The inverse of the density.
+ * @param r The start of the tail.
+ * @param v The area of a layer.
+ * @param f The density.
+ * @param fInv The inverse of the density.
+ * @return The table.
+ */
+template<size_t C, typename F, typename FInv>
+constexpr ZigguratTable<C> makeZiggurat(f64 r, f64 v, F f, FInv fInv) noexcept {
+    ZigguratTable<C> t;
+    t.r   = r;
+    t.x[0]= v / f(r);
+    t.x[1]= r;
+    for(size_t i= 2; i < C; ++i) t.x[i]= fInv(v / t.x[i - 1] + f(t.x[i - 1]));
+    t.x[C]= 0;
+    for(size_t i= 0; i <= C; ++i) t.f[i]= f(t.x[i]);
+    for(size_t i= 0; i < C; ++i) t.ratio[i]= t.x[i + 1] / t.x[i];
+    return t;
+}
+
+/// normal density exp(-x^2/2), 128 layers (Marsaglia & Tsang constants)
+inline constexpr auto normalTable= makeZiggurat<128>(
+        3.442619855899, 9.91256303526217e-3, [](f64 x) { return exp(-0.5 * x * x); }, [](f64 y) { return sqrt(-2.0 * log(y)); });
+/// exponential density exp(-x), 256 layers (Marsaglia & Tsang constants)
+inline constexpr auto exponentialTable= makeZiggurat<256>(
+        7.69711747013104972, 3.949659822581557e-3, [](f64 x) { return exp(-x); }, [](f64 y) { return -log(y); });
+
+}// namespace detail
+
+/**
+ * @brief Exact exponential and logarithm for the wedges and tails of the Ziggurat.
+ *
+ * Implemented with basic operations only: a seed gives the same numbers on every platform,
+ * as long as the compiler does not contract the operations into FMA. The library is built
+ * with -ffp-contract=off, code using these functions must be built with it too.
+ */
+struct ExactTails {
+    /**
+     * @brief Exponential.
+     * @param x The input.
+     * @return exp(x)
+     */
+    [[nodiscard]] static constexpr f64 exp(const f64& x) noexcept { return detail::exp(x); }
+    /**
+     * @brief Natural logarithm.
+     * @param x The input.
+     * @return log(x)
+     */
+    [[nodiscard]] static constexpr f64 log(const f64& x) noexcept { return detail::log(x); }
+};
+
+/**
+ * @brief Bit hack exponential and logarithm for the wedges and tails of the Ziggurat.
+ *
+ * Faster on the slow paths, the errors of fln::bithack::exp2 and fln::bithack::log2
+ * slightly distort the accept test of the wedges and the tail shape.
+ *
+ * @tparam P The precision tier of the approximations.
+ */
+template<Precision P= Precision::High>
+struct FastTails {
+    /**
+     * @brief Exponential.
+     * @param x The input.
+     * @return exp(x)
+     */
+    [[nodiscard]] static constexpr f64 exp(const f64& x) noexcept { return bithack::exp2<P>(x * detail::invLn2); }
+    /**
+     * @brief Natural logarithm.
+     * @param x The input.
+     * @return log(x)
+     */
+    [[nodiscard]] static constexpr f64 log(const f64& x) noexcept { return bithack::log2<P>(x) * 0.69314718055994530942; }
+};
+
+/**
+ * @brief Standard normal number with the Ziggurat method.
+ *
+ * One 64 bits draw gives the layer (low 7 bits) and the position (upper 52 bits), about
+ * 98.8% of the numbers need nothing else.
+ *
+ * @tparam Tails The exponential and logarithm of the slow paths.
+ * @tparam Engine The generator.
+ * @param rng The generator.
+ * @return The random number.
+ */
+template<typename Tails= ExactTails, typename Engine>
+[[nodiscard]] f64 normal(Engine& rng) {
+    const auto& t= detail::normalTable;
+    for(;;) {
+        const u64 bits= rng.rand();
+        const size_t i= bits & 0x7FU;
+        const f64 u   = 2.0 * uniformF64(bits) - 1.0;
+        const f64 x   = u * t.x[i];
+        if(bithack::abs(u) < t.ratio[i]) return x;
+        if(i == 0) {
+            // tail beyond r (Marsaglia)
+            f64 a= 0, b= 0;
+            do {
+                a= -Tails::log(uniformF64<Interval::OpenClosed>(rng.rand())) / t.r;
+                b= -Tails::log(uniformF64<Interval::OpenClosed>(rng.rand()));
+            } while(b + b < a * a);
+            return u < 0 ? -(t.r + a) : t.r + a;
+        }
+        if(t.f[i] + uniformF64(rng.rand()) * (t.f[i + 1] - t.f[i]) < Tails::exp(-0.5 * x * x)) return x;
+    }
+}
+
+/**
+ * @brief Exponential number of rate 1 with the Ziggurat method.
+ *
+ * One 64 bits draw gives the layer (low 8 bits) and the position (upper 52 bits), about
+ * 98.9% of the numbers need nothing else.
+ *
+ * @tparam Tails The exponential and logarithm of the slow paths.
+ * @tparam Engine The generator.
+ * @param rng The generator.
+ * @return The random number.
+ */
+template<typename Tails= ExactTails, typename Engine>
+[[nodiscard]] f64 exponential(Engine& rng) {
+    const auto& t= detail::exponentialTable;
+    for(;;) {
+        const u64 bits= rng.rand();
+        const size_t i= bits & 0xFFU;
+        const f64 u   = uniformF64(bits);
+        const f64 x   = u * t.x[i];
+        if(u < t.ratio[i]) return x;
+        if(i == 0) return t.r - Tails::log(uniformF64<Interval::OpenClosed>(rng.rand()));// memoryless tail
+        if(t.f[i] + uniformF64(rng.rand()) * (t.f[i + 1] - t.f[i]) < Tails::exp(-x)) return x;
+    }
+}
+
+/**
+ * @brief Fill with normal numbers.
+ * @tparam Tails The exponential and logarithm of the slow paths.
+ * @tparam Engine The generator.
+ * @param rng The generator.
+ * @param out The output.
+ * @param mean The mean.
+ * @param sigma The standard deviation.
+ */
+template<typename Tails= ExactTails, typename Engine>
+void normal(Engine& rng, std::span<f64> out, f64 mean= 0, f64 sigma= 1) {
+    for(auto& o: out) o= mean + sigma * normal<Tails>(rng);
+}
+/**
+ * @brief Fill with normal numbers.
+ * @tparam Tails The exponential and logarithm of the slow paths.
+ * @tparam Engine The generator.
+ * @param rng The generator.
+ * @param out The output.
+ * @param mean The mean.
+ * @param sigma The standard deviation.
+ */
+template<typename Tails= ExactTails, typename Engine>
+void normal(Engine& rng, std::span<f32> out, f32 mean= 0, f32 sigma= 1) {
+    for(auto& o: out) o= mean + sigma * static_cast<f32>(normal<Tails>(rng));
+}
+/**
+ * @brief Fill with exponential numbers.
+ * @tparam Tails The exponential and logarithm of the slow paths.
+ * @tparam Engine The generator.
+ * @param rng The generator.
+ * @param out The output.
+ * @param rate The rate (inverse of the mean).
+ */
+template<typename Tails= ExactTails, typename Engine>
+void exponential(Engine& rng, std::span<f64> out, f64 rate= 1) {
+    const f64 scale= 1.0 / rate;
+    for(auto& o: out) o= scale * exponential<Tails>(rng);
+}
+/**
+ * @brief Fill with exponential numbers.
+ * @tparam Tails The exponential and logarithm of the slow paths.
+ * @tparam Engine The generator.
+ * @param rng The generator.
+ * @param out The output.
+ * @param rate The rate (inverse of the mean).
+ */
+template<typename Tails= ExactTails, typename Engine>
+void exponential(Engine& rng, std::span<f32> out, f32 rate= 1) {
+    const f32 scale= 1.0f / rate;
+    for(auto& o: out) o= scale * static_cast<f32>(exponential<Tails>(rng));
+}
+
+}// namespace fln::rand
@@ -5,6 +5,14 @@
 #pragma once
 
 #include "baseType.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <vector>
 
 /**
  * @namespace fln::stats
@@ -12,48 +20,453 @@
  */
 namespace fln::stats {
 
+/**
+ * @brief Type of the sums of a data type: 64 bits for the integers, the type itself for the floats
+ * @tparam T The data type.
+ */
+template<class T>
+using sumType= std::conditional_t<std::is_integral_v<T>, std::conditional_t<std::is_signed_v<T>, s64, u64>, T>;
+
 /**
  * @brief Structure holding statistical results
  * @tparam T The baase type of results
  */
 template<class T>
 struct stats {
-    T mean;        ///< the mean of the set of data
-    T sum;         ///< the sum of the set of data
-    T squareSum;   ///< the sum of squared data elements
-    T stdDeviation;///< the standard deviation
-    T min;
-    T max;
+    T mean;              ///< the mean of the set of data
+    sumType<T> sum;      ///< the sum of the set of data
+    sumType<T> squareSum;///< the sum of squared data elements (exact and saturated for the integers)
+    T stdDeviation;      ///< the standard deviation
+    T min;               ///< the smallest element
+    T max;               ///< the largest element
+};
+
+/**
+ * @brief Summation algorithms, from the cheapest to the most accurate for floats.
+ *
+ * All of them keep 32 interleaved partial sums to be vectorized (AVX2 when it is the active
+ * instruction set). Errors are relative to the sum of the magnitudes for n values, with
+ * epsilon the machine precision of the data type. Costs are per f32 in the L1 cache, with
+ * AVX2 (portable kernel in parentheses). The integers are always summed exactly in 64 bits.
+ */
+enum struct Summation {
+    Naive,   ///< running sums in the data type: error in n/32*epsilon, 1 addition per value, 0.04 ns (0.06 ns)
+    Kahan,   ///< compensated running sums: error in 2*epsilon + n*epsilon^2, 4 operations per value, 0.14 ns (0.24 ns)
+    Neumaier,///< Kahan-Babuska: as Kahan, also when a value is larger than the sum, 7 operations per value, 0.19 ns (0.39 ns)
+    Pairwise,///< halves down to blocks of 512: error in (16+log2(n/512))*epsilon, 0.07 ns (0.15 ns)
+    Wide,    ///< running sums in double for f32 (naive for f64): error in epsilon below 10^9 values, 0.11 ns (0.24 ns)
+};
+
+template<class T>
+class StreamingStats;
+
+namespace detail {
+
+/**
+ * @brief Smallest of two values, NaN as soon as one of them is NaN (as all the kernels).
+ * @tparam T The data type.
+ * @param a The current smallest value.
+ * @param b The new value.
+ * @return The smallest value.
+ */
+template<class T>
+constexpr T minOf(const T& a, const T& b) noexcept {
+    if constexpr(std::is_floating_point_v<T>) return (b < a || b != b) ? b : a;
+    else
+        return b < a ? b : a;
+}
+
+/**
+ * @brief Largest of two values, NaN as soon as one of them is NaN (as all the kernels).
+ * @tparam T The data type.
+ * @param a The current largest value.
+ * @param b The new value.
+ * @return The largest value.
+ */
+template<class T>
+constexpr T maxOf(const T& a, const T& b) noexcept {
+    if constexpr(std::is_floating_point_v<T>) return (b > a || b != b) ? b : a;
+    else
+        return b > a ? b : a;
+}
+
+/**
+ * @brief Addition of sums of squares, saturated to the largest 64 bits value.
+ * @param a The first sum.
+ * @param b The second sum.
+ * @return The sum.
+ */
+constexpr u64 addSaturated(u64 a, u64 b) noexcept { return a + b < a ? std::numeric_limits<u64>::max() : a + b; }
+
+/**
+ * @brief Square of an integer, saturated to the largest 64 bits value.
+ * @tparam T The integer type.
+ * @param x The value.
+ * @return The square.
+ */
+template<class T>
+constexpr u64 squareOf(const T& x) noexcept {
+    u64 a= static_cast<u64>(x);
+    if constexpr(std::is_signed_v<T>) {
+        if(x < 0) a= u64{0} - a;
+    }
+    return a > 0xFFFFFFFFU ? std::numeric_limits<u64>::max() : a * a;
+}
+
+/**
+ * @brief Sum of floats with the SIMD kernels (AVX2 when it is the active instruction set).
+ * @param data The values.
+ * @param summation The algorithm.
+ * @return The sum.
+ */
+f32 sum(std::span<const f32> data, Summation summation) noexcept;
+/**
+ * @brief Sum of doubles with the SIMD kernels (AVX2 when it is the active instruction set).
+ * @param data The values.
+ * @param summation The algorithm.
+ * @return The sum.
+ */
+f64 sum(std::span<const f64> data, Summation summation) noexcept;
+
+/**
+ * @brief Statistics of an array with the SIMD kernels (AVX2 when it is the active instruction set).
+ * @param data The values.
+ * @return The statistics.
+ */
+StreamingStats<f32> summarize(std::span<const f32> data) noexcept;
+/**
+ * @brief Statistics of an array with the SIMD kernels (AVX2 when it is the active instruction set).
+ * @param data The values.
+ * @return The statistics.
+ */
+StreamingStats<f64> summarize(std::span<const f64> data) noexcept;
+/**
+ * @brief Statistics of an array with the SIMD kernels (AVX2 when it is the active instruction set).
+ * @param data The values.
+ * @return The statistics.
+ */
+StreamingStats<s32> summarize(std::span<const s32> data) noexcept;
+/**
+ * @brief Statistics of an array with the SIMD kernels (AVX2 when it is the active instruction set).
+ * @param data The values.
+ * @return The statistics.
+ */
+StreamingStats<u32> summarize(std::span<const u32> data) noexcept;
+/**
+ * @brief Statistics of an array of any other type, by blocks that stay in the cache.
+ * @tparam T The data type.
+ * @param data The values.
+ * @return The statistics.
+ */
+template<class T>
+StreamingStats<T> summarize(std::span<const T> data) noexcept;
+
+/**
+ * @brief Run tasks on several threads, each thread takes the next task until all are done.
+ *
+ * The threads are started by each call instead of being kept in a pool: the tasks of
+ * parallelSummarize are chunks of 65536 values, far longer than the start of a thread.
+ * If a thread cannot be started, the tasks are shared by the threads already running.
+ *
+ * @param count The number of tasks.
+ * @param threads The number of threads (0: all the hardware threads).
+ * @param task The task, called with its index.
+ */
+void parallelFor(size_t count, u32 threads, const std::function<void(size_t)>& task);
+
+}// namespace detail
+
+/**
+ * @brief Single pass statistics of a stream of data, numerically stable.
+ *
+ * The mean and the sum of the squared deviations are updated with Welford's method by
+ * push(), batches are summarized by blocks and combined with Chan's formula, as merge()
+ * does for the accumulators of other parts of the stream (other threads or nodes). The
+ * computations are done in double (long double for long double data), the integers never
+ * overflow. The sum of the squares of integers is exact, saturated to the largest value of
+ * sumType. The smallest and the largest values are NaN as soon as one value is NaN.
+ *
+ * @tparam T The data type.
+ */
+template<class T>
+class StreamingStats {
+public:
+    /// type of the computations
+    using real= std::conditional_t<std::is_same_v<T, long double>, long double, f64>;
+    /// type of the running sum: exact for the integers, real for the floats
+    using total= std::conditional_t<std::is_integral_v<T>, sumType<T>, real>;
+    /**
+     * @brief Add a value.
+     * @param x The value.
+     */
+    void push(const T& x) noexcept {
+        const real v    = static_cast<real>(x);
+        const real delta= v - m_mean;
+        ++m_count;
+        m_mean+= delta / static_cast<real>(m_count);
+        m_m2+= delta * (v - m_mean);
+        m_sum+= static_cast<total>(x);
+        if constexpr(std::is_integral_v<T>) m_squares= detail::addSaturated(m_squares, detail::squareOf(x));
+        m_min= detail::minOf(m_min, x);
+        m_max= detail::maxOf(m_max, x);
+    }
+    /**
+     * @brief Add values, summarized by blocks that stay in the cache (SIMD kernels for f32, f64, s32 and u32).
+     * @param data The values.
+     */
+    void pushBatch(std::span<const T> data) noexcept { merge(detail::summarize(data)); }
+    /**
+     * @brief Add the values of another accumulator (Chan et al.).
+     * @param other The other accumulator.
+     */
+    void merge(const StreamingStats& other) noexcept {
+        if(other.m_count == 0) return;
+        if(m_count == 0) {
+            *this= other;
+            return;
+        }
+        const real n    = static_cast<real>(m_count + other.m_count);
+        const real delta= other.m_mean - m_mean;
+        const real nb   = static_cast<real>(other.m_count);
+        m_mean+= delta * nb / n;
+        m_m2+= other.m_m2 + delta * delta * static_cast<real>(m_count) * nb / n;
+        m_count+= other.m_count;
+        m_sum+= other.m_sum;
+        m_squares= detail::addSaturated(m_squares, other.m_squares);
+        m_min= detail::minOf(m_min, other.m_min);
+        m_max= detail::maxOf(m_max, other.m_max);
+    }
+    /**
+     * @brief Build an accumulator from the summary of values.
+     * @param count The number of values.
+     * @param mean The mean.
+     * @param m2 The sum of the squared deviations to the mean.
+     * @param sum The sum.
+     * @param min The smallest value.
+     * @param max The largest value.
+     * @param squares The saturated sum of the squares (integers only).
+     * @return The accumulator.
+     */
+    [[nodiscard]] static StreamingStats fromMoments(u64 count, real mean, real m2, total sum, T min, T max, u64 squares= 0) noexcept {
+        StreamingStats s;
+        if(count == 0) return s;
+        s.m_count= count;
+        s.m_mean = mean;
+        s.m_m2   = m2;
+        s.m_sum  = sum;
+        s.m_min  = min;
+        s.m_max  = max;
+        s.m_squares= squares;
+        return s;
+    }
+    /**
+     * @brief Get the number of values.
+     * @return The number of values.
+     */
+    [[nodiscard]] u64 count() const noexcept { return m_count; }
+    /**
+     * @brief Get the mean.
+     * @return The mean (0 without values).
+     */
+    [[nodiscard]] real mean() const noexcept { return m_mean; }
+    /**
+     * @brief Get the population variance.
+     * @return The variance (0 without values).
+     */
+    [[nodiscard]] real variance() const noexcept { return m_count > 0 ? m_m2 / static_cast<real>(m_count) : real{}; }
+    /**
+     * @brief Get the sample variance (Bessel correction).
+     * @return The variance (0 with less than 2 values).
+     */
+    [[nodiscard]] real sampleVariance() const noexcept { return m_count > 1 ? m_m2 / static_cast<real>(m_count - 1) : real{}; }
+    /**
+     * @brief Get the smallest value.
+     * @return The smallest value (largest value of the type without values).
+     */
+    [[nodiscard]] T min() const noexcept { return m_min; }
+    /**
+     * @brief Get the largest value.
+     * @return The largest value (lowest value of the type without values).
+     */
+    [[nodiscard]] T max() const noexcept { return m_max; }
+    /**
+     * @brief Get the results in the format of getStats.
+     * @return The statistics.
+     */
+    [[nodiscard]] stats<T> result() const noexcept {
+        const bool empty= m_count == 0;
+        return {
+                static_cast<T>(m_mean),
+                static_cast<sumType<T>>(m_sum),
+                squareSum(),
+                static_cast<T>(std::sqrt(variance())),
+                empty ? T{} : m_min,
+                empty ? T{} : m_max,
+        };
+    }
+
+private:
+    /**
+     * @brief Get the sum of the squared values.
+     * @return The sum: exact for the integers (saturated), from the moments for the floats.
+     */
+    [[nodiscard]] sumType<T> squareSum() const noexcept {
+        if constexpr(std::is_integral_v<T>) return static_cast<sumType<T>>(std::min<u64>(m_squares, static_cast<u64>(std::numeric_limits<sumType<T>>::max())));
+        else
+            return static_cast<sumType<T>>(m_m2 + static_cast<real>(m_count) * m_mean * m_mean);
+    }
+    u64 m_count= 0;                               ///< number of values
+    real m_mean{};                                ///< running mean
+    real m_m2{};                                  ///< sum of the squared deviations to the mean
+    total m_sum{};                                ///< sum of the values
+    u64 m_squares= 0;                             ///< saturated sum of the squares of the integers
+    T m_min= std::numeric_limits<T>::max();       ///< smallest value
+    T m_max= std::numeric_limits<T>::lowest();    ///< largest value
 };
 
+template<class T>
+StreamingStats<T> detail::summarize(std::span<const T> data) noexcept {
+    // number of values summarized at once
+    constexpr size_t blockSize= 1024;
+    using real                = typename StreamingStats<T>::real;
+    StreamingStats<T> res;
+    for(size_t start= 0; start < data.size(); start+= blockSize) {
+        const auto block= data.subspan(start, std::min(blockSize, data.size() - start));
+        typename StreamingStats<T>::total sum{};
+        real total{};
+        u64 squares= 0;
+        T mi= block[0];
+        T ma= block[0];
+        for(const T& x: block) {
+            sum+= static_cast<typename StreamingStats<T>::total>(x);
+            total+= static_cast<real>(x);
+            if constexpr(std::is_integral_v<T>) squares= addSaturated(squares, squareOf(x));
+            mi= minOf(mi, x);
+            ma= maxOf(ma, x);
+        }
+        const real mean= total / static_cast<real>(block.size());
+        real m2{};
+        for(const T& x: block) {
+            const real d= static_cast<real>(x) - mean;
+            m2+= d * d;
+        }
+        res.merge(StreamingStats<T>::fromMoments(block.size(), mean, m2, sum, mi, ma, squares));
+    }
+    return res;
+}
+
+/**
+ * @brief Statistics of a large array with several threads.
+ *
+ * The array is cut in chunks of fixed size summarized by the SIMD kernels, the partial
+ * results are merged pairwise: the result does not depend on the number of threads.
+ *
+ * @tparam T The data type.
+ * @param data The values.
+ * @param threads The number of threads (0: all the hardware threads).
+ * @return The statistics.
+ */
+template<class T>
+StreamingStats<T> parallelSummarize(std::span<const T> data, u32 threads= 0) {
+    // number of values of a task: large enough to hide the scheduling, fits in the L2 cache
+    constexpr size_t chunkSize= size_t{1} << 16U;
+    const size_t chunks       = (data.size() + chunkSize - 1) / chunkSize;
+    std::vector<StreamingStats<T>> parts(chunks);
+    detail::parallelFor(chunks, threads, [&](size_t c) {
+        parts[c]= detail::summarize(data.subspan(c * chunkSize, std::min(chunkSize, data.size() - c * chunkSize)));
+    });
+    // pairwise merge: balanced tree, independent of the scheduling
+    for(size_t step= 1; step < parts.size(); step*= 2) {
+        for(size_t i= 0; i + step < parts.size(); i+= 2 * step) parts[i].merge(parts[i + step]);
+    }
+    return parts.empty() ? StreamingStats<T>{} : parts.front();
+}
+
+/**
+ * @brief Print the results
+ * @tparam data the base type of data
+ * @param res the results
+ */
+template<class data>
+void printStats(const stats<data>& res) {
+    std::cout << "sum         : " << res.sum << std::endl;
+    std::cout << "squareSum   : " << res.squareSum << std::endl;
+    std::cout << "mean        : " << res.mean << std::endl;
+    std::cout << "stdDeviation: " << res.stdDeviation << std::endl;
+    std::cout << "min         : " << res.min << std::endl;
+    std::cout << "max         : " << res.max << std::endl;
+}
+
+/**
+ * @brief Sum of values.
+ * @tparam S The summation algorithm for floats (integers are summed exactly).
+ * @tparam T The data type.
+ * @param data The values.
+ * @return The sum.
+ */
+template<Summation S= Summation::Wide, class T>
+[[nodiscard]] sumType<T> sum(std::span<const T> data) noexcept {
+    if constexpr(std::is_same_v<T, f32> || std::is_same_v<T, f64>) {
+        return detail::sum(data, S);
+    } else {
+        sumType<T> res{};
+        for(const T& x: data) res+= static_cast<sumType<T>>(x);
+        return res;
+    }
+}
+
+/**
+ * @brief Sum of values.
+ * @tparam S The summation algorithm for floats (integers are summed exactly).
+ * @tparam T The data type.
+ * @param data The values.
+ * @return The sum.
+ */
+template<Summation S= Summation::Wide, class T>
+[[nodiscard]] sumType<T> sum(const std::vector<T>& data) noexcept {
+    return sum<S, T>(std::span<const T>(data));
+}
+
 /**
  * @brief Compute the stats for the given set of data
+ *
+ * The sum and the mean are computed with the summation algorithm, the standard deviation
+ * is always the stable one of StreamingStats. Summation::Wide (the default) comes with
+ * the single pass kernels, the other algorithms need a second pass for the sum.
+ *
  * @tparam data the base type of dta
- * @tparam result the base type of result
- * @param data the set of data
+ * @tparam S the summation algorithm of the sum and the mean
+ * @param dataset the set of data
+ * @param print if the results should be printed
  * @return structure holding the results
  */
-template<class data>
+template<class data, Summation S= Summation::Wide>
 stats<data> getStats(const std::vector<data>& dataset, bool print=false) {
-    stats<data> res;
-    res.sum      = data{};
-    res.squareSum= data{};
-    for(auto i: dataset) {
-        res.sum+= i;
-        res.squareSum+= i * i;
-    }
-    res.mean        = static_cast<data>(res.sum) / static_cast<data>(dataset.size());
-    res.stdDeviation= std::sqrt(res.squareSum / static_cast<data>(dataset.size()) - res.mean * res.mean);
-    res.min         = static_cast<data>(*std::min_element(dataset.begin(), dataset.end()));
-    res.max         = static_cast<data>(*std::max_element(dataset.begin(), dataset.end()));
-    if (print) {
-        std::cout << "sum         : " << res.sum << std::endl;
-        std::cout << "squareSum   : " << res.squareSum << std::endl;
-        std::cout << "mean        : " << res.mean << std::endl;
-        std::cout << "stdDeviation: " << res.stdDeviation << std::endl;
-        std::cout << "min         : " << res.min << std::endl;
-        std::cout << "max         : " << res.max << std::endl;
+    StreamingStats<data> acc;
+    acc.pushBatch(dataset);
+    stats<data> res= acc.result();
+    if constexpr(S != Summation::Wide && std::is_floating_point_v<data>) {
+        if(!dataset.empty()) {
+            res.sum = sum<S>(dataset);
+            res.mean= res.sum / static_cast<data>(dataset.size());
+        }
     }
+    if (print) printStats(res);
+    return res;
+}
+
+/**
+ * @brief Compute the stats for the given set of data with several threads
+ * @tparam data the base type of dta
+ * @param dataset the set of data
+ * @param threads the number of threads (0: all the hardware threads)
+ * @param print if the results should be printed
+ * @return structure holding the results
+ */
+template<class data>
+stats<data> getParallelStats(const std::vector<data>& dataset, u32 threads= 0, bool print=false) {
+    const stats<data> res= parallelSummarize<data>(dataset, threads).result();
+    if (print) printStats(res);
     return res;
 }
 
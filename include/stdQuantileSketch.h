@@ -0,0 +1,180 @@
+/**
+ * \file stdQuantileSketch.h
+ *
+ * \date 17/10/2026
+ * \author Silmaen
+ */
+#pragma once
+
+#include "baseType.h"
+#include <cmath>
+#include <iostream>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace fln::stats {
+
+/**
+ * @brief Mergeable streaming quantiles with bounded memory (merging t-digest of Dunning).
+ *
+ * The distribution is summarized by weighted centroids, small at the tails and large at the
+ * median: with the arcsine scale function, the centroid around the quantile q holds about
+ * 2π/compression * sqrt(q(1-q)) of the values. There are at most compression centroids and
+ * a buffer of 8*compression pending values, whatever the number of values.
+ *
+ * The values are buffered by push() and pushBatch(), radix sorted and merged into the
+ * centroids in one pass when the buffer is full or before a query (about 35 ns per value).
+ * merge() combines the sketches of other parts of the stream (threads, nodes) in a time
+ * linear in the compression (about 6 µs at 200). With the default compression, the rank
+ * error is about 1e-3 at the median and 1e-4 beyond p99. The minimum and the maximum are
+ * exact. NaN and infinities are ignored.
+ *
+ * The queries are const but flush the buffer: a sketch must not be read from several threads
+ * while it has pending values.
+ */
+class QuantileSketch {
+public:
+    /**
+     * @brief A cluster of values.
+     */
+    struct Centroid {
+        f64 mean;  ///< mean of the values
+        f64 weight;///< number of values
+    };
+    /**
+     * @brief Constructor.
+     * @param compression The accuracy parameter: the maximum number of centroids (clamped to [10, 100000]).
+     */
+    explicit QuantileSketch(f64 compression= 200);
+    /**
+     * @brief Add a value.
+     * @param x The value (NaN and infinities are ignored).
+     */
+    void push(f64 x) {
+        if(!std::isfinite(x)) return;
+        m_pending.push_back(x);
+        if(m_pending.size() >= m_bufferSize) flush();
+    }
+    /**
+     * @brief Add values.
+     * @tparam T The data type.
+     * @param data The values (NaN and infinities are ignored).
+     */
+    template<class T>
+    void pushBatch(std::span<const T> data) {
+        static_assert(std::is_arithmetic_v<T>, "the values must be numbers");
+        for(const T& x: data) {
+            const f64 v= static_cast<f64>(x);
+            if(!std::isfinite(v)) continue;
+            m_pending.push_back(v);
+            if(m_pending.size() >= m_bufferSize) flush();
+        }
+    }
+    /**
+     * @brief Add values.
+     * @tparam T The data type.
+     * @param data The values.
+     */
+    template<class T>
+    void pushBatch(const std::vector<T>& data) { pushBatch(std::span<const T>(data)); }
+    /**
+     * @brief Add the values of another sketch.
+     * @param other The other sketch.
+     */
+    void merge(const QuantileSketch& other);
+    /**
+     * @brief Value at a quantile, interpolated between the centroids.
+     * @param q The quantile, in [0, 1].
+     * @return The value (0 for an empty sketch).
+     */
+    [[nodiscard]] f64 quantile(f64 q) const;
+    /**
+     * @brief Fraction of the values below a value, interpolated between the centroids.
+     * @param x The value.
+     * @return The fraction in [0, 1] (0 for an empty sketch).
+     */
+    [[nodiscard]] f64 cdf(f64 x) const;
+    /**
+     * @brief Number of values.
+     * @return The number of values.
+     */
+    [[nodiscard]] u64 count() const noexcept { return m_count + m_pending.size(); }
+    /**
+     * @brief Smallest value.
+     * @return The smallest value (0 for an empty sketch).
+     */
+    [[nodiscard]] f64 min() const;
+    /**
+     * @brief Largest value.
+     * @return The largest value (0 for an empty sketch).
+     */
+    [[nodiscard]] f64 max() const;
+    /**
+     * @brief Accuracy parameter.
+     * @return The compression.
+     */
+    [[nodiscard]] f64 compression() const noexcept { return m_compression; }
+    /**
+     * @brief The summary of the distribution.
+     * @return The centroids, by increasing mean.
+     */
+    [[nodiscard]] const std::vector<Centroid>& centroids() const;
+    /**
+     * @brief Binary image of the sketch, in the byte order of the machine.
+     * @return The bytes.
+     */
+    [[nodiscard]] std::vector<u8> serialize() const;
+    /**
+     * @brief Rebuild a sketch from its binary image.
+     * @param bytes The output of serialize().
+     * @return The sketch.
+     * @throw std::invalid_argument if the bytes are not a sketch, or not a consistent one.
+     */
+    [[nodiscard]] static QuantileSketch deserialize(std::span<const u8> bytes);
+
+private:
+    /**
+     * @brief Merge the pending values into the centroids.
+     */
+    void flush() const;
+    /**
+     * @brief Rebuild the centroids from all the clusters.
+     * @param sorted The clusters, by increasing mean.
+     */
+    void compress(const std::vector<Centroid>& sorted) const;
+
+    f64 m_compression;                        ///< accuracy parameter
+    size_t m_bufferSize;                      ///< number of pending values that triggers a flush
+    mutable u64 m_count= 0;                   ///< number of values in the centroids
+    mutable f64 m_min  = 0;                   ///< smallest value
+    mutable f64 m_max  = 0;                   ///< largest value
+    mutable std::vector<Centroid> m_centroids;///< summary, by increasing mean
+    mutable std::vector<f64> m_pending;       ///< values not yet merged
+    mutable std::vector<Centroid> m_scratch;  ///< merge buffer
+    mutable std::vector<u64> m_keys;          ///< sort buffer
+};
+
+/**
+ * @brief Compute quantiles of the given set of data
+ * @tparam data the base type of data
+ * @param dataset the set of data
+ * @param quantiles the quantiles to compute, in [0, 1]
+ * @param print if the results should be printed
+ * @param compression the accuracy parameter of the sketch
+ * @return the values at the quantiles
+ */
+template<class data>
+std::vector<f64> getQuantiles(const std::vector<data>& dataset, const std::vector<f64>& quantiles= {0.5, 0.99, 0.999}, bool print= false, f64 compression= 200) {
+    QuantileSketch sketch(compression);
+    sketch.pushBatch(dataset);
+    std::vector<f64> res;
+    res.reserve(quantiles.size());
+    for(const f64 q: quantiles) res.push_back(sketch.quantile(q));
+    if(print) {
+        for(size_t i= 0; i < res.size(); ++i) std::cout << "p" << quantiles[i] * 100 << " : " << res[i] << std::endl;
+    }
+    return res;
+}
+
+}// namespace fln::stats
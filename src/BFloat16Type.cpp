@@ -0,0 +1,142 @@
+/**
+ * \file BFloat16Type.cpp
+ *
+ * \date 17/10/2026
+ * \author Silmaen
+ */
+#include "BFloat16Type.h"
+#include "simdTarget.h"
+#include <array>
+
+namespace fln::object {
+
+namespace {
+
+/// number of interleaved partial sums of the reductions
+constexpr size_t lanes= 16;
+
+/**
+ * @brief Sum the partial sums in a fixed order.
+ * @param acc The partial sums.
+ * @return The total.
+ */
+f32 reduce(const std::array<f32, lanes>& acc) noexcept {
+    f32 r= 0;
+    for(const f32 v: acc) r+= v;
+    return r;
+}
+
+#ifdef FLN_SIMD_X86
+/**
+ * @brief Round 8 floats (as bits) to bfloat16 in the low half of the 32 bits lanes.
+ * @param x The float bits.
+ * @return The rounded bfloat16.
+ */
+FLN_TARGET("avx2") inline __m256i roundAvx2(__m256i x) noexcept {
+    const __m256i lsb  = _mm256_and_si256(_mm256_srli_epi32(x, 16), _mm256_set1_epi32(1));
+    const __m256i r    = _mm256_add_epi32(x, _mm256_add_epi32(lsb, _mm256_set1_epi32(0x7FFF)));
+    const __m256i isNaN= _mm256_cmpgt_epi32(_mm256_and_si256(x, _mm256_set1_epi32(0x7FFFFFFF)), _mm256_set1_epi32(0x7F800000));
+    const __m256i quiet= _mm256_or_si256(x, _mm256_set1_epi32(0x00400000));
+    return _mm256_srli_epi32(_mm256_blendv_epi8(r, quiet, isNaN), 16);
+}
+/**
+ * @brief Load 8 bfloat16 as floats.
+ * @param p The bfloat16 bits.
+ * @return The floats.
+ */
+FLN_TARGET("avx2") inline __m256 loadAvx2(const u16* p) noexcept {
+    return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))), 16));
+}
+
+FLN_TARGET("avx2") void toBFloat16Avx2(const f32* in, u16* out, size_t n) noexcept {
+    size_t i= 0;
+    for(; i + 16 <= n; i+= 16) {
+        const __m256i lo= roundAvx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i)));
+        const __m256i hi= roundAvx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i + 8)));
+        // pack works on 128 bits lanes, restore the order
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_permute4x64_epi64(_mm256_packus_epi32(lo, hi), 0xD8));
+    }
+    for(; i < n; ++i) out[i]= toBFloat16(in[i]);
+}
+FLN_TARGET("avx2") void fromBFloat16Avx2(const u16* in, f32* out, size_t n) noexcept {
+    size_t i= 0;
+    for(; i + 8 <= n; i+= 8) _mm256_storeu_ps(out + i, loadAvx2(in + i));
+    for(; i < n; ++i) out[i]= fromBFloat16(in[i]);
+}
+FLN_TARGET("avx2") f32 dotBFloat16Avx2(const u16* a, const u16* b, size_t n) noexcept {
+    __m256 acc0= _mm256_setzero_ps();
+    __m256 acc1= _mm256_setzero_ps();
+    size_t i   = 0;
+    for(; i + lanes <= n; i+= lanes) {
+        acc0= _mm256_add_ps(acc0, _mm256_mul_ps(loadAvx2(a + i), loadAvx2(b + i)));
+        acc1= _mm256_add_ps(acc1, _mm256_mul_ps(loadAvx2(a + i + 8), loadAvx2(b + i + 8)));
+    }
+    std::array<f32, lanes> acc{};
+    _mm256_storeu_ps(acc.data(), acc0);
+    _mm256_storeu_ps(acc.data() + 8, acc1);
+    for(size_t j= 0; i < n; ++i, ++j) acc[j]+= fromBFloat16(a[i]) * fromBFloat16(b[i]);
+    return reduce(acc);
+}
+FLN_TARGET("avx2") f32 sumBFloat16Avx2(const u16* in, size_t n) noexcept {
+    __m256 acc0= _mm256_setzero_ps();
+    __m256 acc1= _mm256_setzero_ps();
+    size_t i   = 0;
+    for(; i + lanes <= n; i+= lanes) {
+        acc0= _mm256_add_ps(acc0, loadAvx2(in + i));
+        acc1= _mm256_add_ps(acc1, loadAvx2(in + i + 8));
+    }
+    std::array<f32, lanes> acc{};
+    _mm256_storeu_ps(acc.data(), acc0);
+    _mm256_storeu_ps(acc.data() + 8, acc1);
+    for(size_t j= 0; i < n; ++i, ++j) acc[j]+= fromBFloat16(in[i]);
+    return reduce(acc);
+}
+#endif
+
+}// namespace
+
+void toBFloat16(const f32* in, u16* out, size_t n) noexcept {
+#ifdef FLN_SIMD_X86
+    if(bithack::simd::useAvx2()) {
+        toBFloat16Avx2(in, out, n);
+        return;
+    }
+#endif
+    for(size_t i= 0; i < n; ++i) out[i]= toBFloat16(in[i]);
+}
+
+void fromBFloat16(const u16* in, f32* out, size_t n) noexcept {
+#ifdef FLN_SIMD_X86
+    if(bithack::simd::useAvx2()) {
+        fromBFloat16Avx2(in, out, n);
+        return;
+    }
+#endif
+    for(size_t i= 0; i < n; ++i) out[i]= fromBFloat16(in[i]);
+}
+
+f32 dotBFloat16(const u16* a, const u16* b, size_t n) noexcept {
+#ifdef FLN_SIMD_X86
+    if(bithack::simd::useAvx2()) return dotBFloat16Avx2(a, b, n);
+#endif
+    std::array<f32, lanes> acc{};
+    size_t i= 0;
+    for(; i + lanes <= n; i+= lanes)
+        for(size_t j= 0; j < lanes; ++j) acc[j]+= fromBFloat16(a[i + j]) * fromBFloat16(b[i + j]);
+    for(size_t j= 0; i < n; ++i, ++j) acc[j]+= fromBFloat16(a[i]) * fromBFloat16(b[i]);
+    return reduce(acc);
+}
+
+f32 sumBFloat16(const u16* in, size_t n) noexcept {
+#ifdef FLN_SIMD_X86
+    if(bithack::simd::useAvx2()) return sumBFloat16Avx2(in, n);
+#endif
+    std::array<f32, lanes> acc{};
+    size_t i= 0;
+    for(; i + lanes <= n; i+= lanes)
+        for(size_t j= 0; j < lanes; ++j) acc[j]+= fromBFloat16(in[i + j]);
+    for(size_t j= 0; i < n; ++i, ++j) acc[j]+= fromBFloat16(in[i]);
+    return reduce(acc);
+}
+
+}// namespace fln::object
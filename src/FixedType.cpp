@@ -0,0 +1,86 @@
+/**
+ * \file FixedType.cpp
+ *
+ * \date 17/10/2026
+ * \author Silmaen
+ */
+#include "FixedType.h"
+#include "simdTarget.h"
+
+namespace fln::object::detail {
+
+namespace {
+
+#ifdef FLN_SIMD_X86
+/**
+ * @brief Rounded products of 16 values in 32 bits, scaled back, plus an accumulator.
+ *
+ * The products are unpacked in two halves per 128 bits lane, so that packs_epi32 restores
+ * the order while saturating.
+ */
+FLN_TARGET("avx2") __m256i mulAdd16(__m256i a, __m256i b, __m256i accLo, __m256i accHi, __m128i shift, __m256i round) noexcept {
+    const __m256i lo= _mm256_mullo_epi16(a, b);
+    const __m256i hi= _mm256_mulhi_epi16(a, b);
+    __m256i p0      = _mm256_sra_epi32(_mm256_add_epi32(_mm256_unpacklo_epi16(lo, hi), round), shift);
+    __m256i p1      = _mm256_sra_epi32(_mm256_add_epi32(_mm256_unpackhi_epi16(lo, hi), round), shift);
+    p0              = _mm256_add_epi32(p0, accLo);
+    p1              = _mm256_add_epi32(p1, accHi);
+    return _mm256_packs_epi32(p0, p1);
+}
+
+FLN_TARGET("avx2") size_t addAvx2(const s16* a, const s16* b, s16* out, size_t n) noexcept {
+    size_t i= 0;
+    for(; i + 16 <= n; i+= 16) {
+        const __m256i va= _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        const __m256i vb= _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_adds_epi16(va, vb));
+    }
+    return i;
+}
+
+FLN_TARGET("avx2") size_t macAvx2(const s16* a, const s16* b, s16* acc, s16* out, size_t n, u32 fracBits) noexcept {
+    const __m128i shift= _mm_cvtsi32_si128(static_cast<int>(fracBits));
+    const __m256i round= _mm256_set1_epi32(fracBits > 0 ? 1 << (fracBits - 1) : 0);
+    const __m256i zero = _mm256_setzero_si256();
+    size_t i           = 0;
+    for(; i + 16 <= n; i+= 16) {
+        const __m256i va= _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        const __m256i vb= _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        __m256i accLo   = zero;
+        __m256i accHi   = zero;
+        if(acc != nullptr) {
+            // sign extension of the accumulators, in the same order as the products
+            const __m256i vc= _mm256_loadu_si256(reinterpret_cast<const __m256i*>(acc + i));
+            accLo           = _mm256_srai_epi32(_mm256_unpacklo_epi16(vc, vc), 16);
+            accHi           = _mm256_srai_epi32(_mm256_unpackhi_epi16(vc, vc), 16);
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), mulAdd16(va, vb, accLo, accHi, shift, round));
+    }
+    return i;
+}
+#endif
+
+}// namespace
+
+size_t saturatingAdd16(const s16* a, const s16* b, s16* out, size_t n) noexcept {
+#ifdef FLN_SIMD_X86
+    if(bithack::simd::useAvx2()) return addAvx2(a, b, out, n);
+#endif
+    return 0;
+}
+
+size_t saturatingMul16(const s16* a, const s16* b, s16* out, size_t n, u32 fracBits) noexcept {
+#ifdef FLN_SIMD_X86
+    if(bithack::simd::useAvx2()) return macAvx2(a, b, nullptr, out, n, fracBits);
+#endif
+    return 0;
+}
+
+size_t saturatingMac16(const s16* a, const s16* b, s16* acc, size_t n, u32 fracBits) noexcept {
+#ifdef FLN_SIMD_X86
+    if(bithack::simd::useAvx2()) return macAvx2(a, b, acc, acc, n, fracBits);
+#endif
+    return 0;
+}
+
+}// namespace fln::object::detail
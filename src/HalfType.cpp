@@ -0,0 +1,73 @@
+/**
+ * \file HalfType.cpp
+ *
+ * \date 17/10/2026
+ * \author Silmaen
+ */
+#include "HalfType.h"
+#include "simdTarget.h"
+
+namespace fln::object {
+
+namespace {
+
+#ifdef FLN_SIMD_X86
+FLN_TARGET("avx,f16c") void toHalfF16C(const f32* in, u16* out, size_t n) noexcept {
+    size_t i= 0;
+    for(; i + 8 <= n; i+= 8)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm256_cvtps_ph(_mm256_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+    for(; i < n; ++i) out[i]= packFloat<HalfTraits>(in[i]);
+}
+FLN_TARGET("avx,f16c") void fromHalfF16C(const u16* in, f32* out, size_t n) noexcept {
+    size_t i= 0;
+    for(; i + 8 <= n; i+= 8)
+        _mm256_storeu_ps(out + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i))));
+    for(; i < n; ++i) out[i]= unpackFloat<HalfTraits>(in[i]);
+}
+
+/**
+ * @brief Check the cpuid bit of the F16C instructions.
+ * @return True if supported.
+ */
+bool cpuHasF16C() noexcept {
+#if defined(_MSC_VER)
+    int regs[4];
+    __cpuid(regs, 1);
+    return (regs[2] & (1 << 29)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("f16c");
+#endif
+}
+#else
+bool cpuHasF16C() noexcept { return false; }
+#endif
+
+}// namespace
+
+bool halfUsesF16C() noexcept {
+    static const bool hasF16C= cpuHasF16C();
+    return hasF16C && bithack::simd::activeIsa() >= bithack::simd::Isa::AVX2;
+}
+
+void toHalf(const f32* in, u16* out, size_t n) noexcept {
+#ifdef FLN_SIMD_X86
+    if(halfUsesF16C()) {
+        toHalfF16C(in, out, n);
+        return;
+    }
+#endif
+    for(size_t i= 0; i < n; ++i) out[i]= packFloat<HalfTraits>(in[i]);
+}
+
+void fromHalf(const u16* in, f32* out, size_t n) noexcept {
+#ifdef FLN_SIMD_X86
+    if(halfUsesF16C()) {
+        fromHalfF16C(in, out, n);
+        return;
+    }
+#endif
+    for(size_t i= 0; i < n; ++i) out[i]= unpackFloat<HalfTraits>(in[i]);
+}
+
+}// namespace fln::object
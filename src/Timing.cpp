@@ -0,0 +1,52 @@
+/**
+ * \file Timing.cpp
+ *
+ * \date 17/10/2026
+ * \author Silmaen
+ */
+#include "Timing.h"
+
+namespace fln::time {
+
+namespace {
+
+/**
+ * @brief Measure the frequency of the cycle counter.
+ * @return The number of ticks per nanosecond.
+ */
+f64 calibrate() {
+#if defined(FLN_TIME_TSC)
+    // spin for 10ms and compare the counter with the steady clock
+    const auto startTime = std::chrono::steady_clock::now();
+    const u64 startCycles= cycleStart();
+    auto now             = startTime;
+    while(now - startTime < std::chrono::milliseconds(10)) now= std::chrono::steady_clock::now();
+    const u64 stopCycles= cycleStop();
+    const auto elapsed  = std::chrono::duration_cast<std::chrono::nanoseconds>(now - startTime).count();
+    return static_cast<f64>(stopCycles - startCycles) / static_cast<f64>(elapsed);
+#elif defined(FLN_TIME_CNTVCT)
+    u64 frequency;
+    asm volatile("mrs %0, cntfrq_el0"
+                 : "=r"(frequency));
+    return static_cast<f64>(frequency) * 1e-9;
+#else
+    return 1.0;
+#endif
+}
+
+}// namespace
+
+f64 cycleFrequency() {
+    static const f64 frequency= calibrate();
+    return frequency;
+}
+
+bool hasCycleCounter() noexcept {
+#if defined(FLN_TIME_TSC) || defined(FLN_TIME_CNTVCT)
+    return true;
+#else
+    return false;
+#endif
+}
+
+}// namespace fln::time
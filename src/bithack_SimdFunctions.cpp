@@ -0,0 +1,332 @@
+/**
+ * \file bithack_SimdFunctions.cpp
+ *
+ * \date 17/10/2026
+ * \author Silmaen
+ */
+#include "bithack_SimdFunctions.h"
+#include "bithack_BatchFunctions.h"
+#include "simdTarget.h"
+#include <atomic>
+
+namespace fln::bithack::simd {
+
+namespace {
+
+/**
+ * @brief Table of kernels for one instruction set
+ */
+struct Kernels {
+    Isa isa;                                                 ///< the instruction set of this table
+    void (*log2)(const f32*, f32*, size_t) noexcept;         ///< log2 kernel
+    void (*exp2)(const f32*, f32*, size_t) noexcept;         ///< exp2 kernel
+    void (*pow)(const f32*, f32*, size_t, f32) noexcept;     ///< pow kernel
+    void (*sqrt)(const f32*, f32*, size_t) noexcept;         ///< sqrt kernel
+    void (*rsqrt)(const f32*, f32*, size_t) noexcept;        ///< rsqrt kernel
+};
+
+// ---=== Scalar ===---
+constexpr Kernels scalarKernels{
+        Isa::Scalar,
+        [](const f32* in, f32* out, size_t n) noexcept { batch::log2(in, out, n); },
+        [](const f32* in, f32* out, size_t n) noexcept { batch::exp2(in, out, n); },
+        [](const f32* in, f32* out, size_t n, f32 p) noexcept { batch::pow(in, out, n, p); },
+        [](const f32* in, f32* out, size_t n) noexcept { batch::sqrt(in, out, n); },
+        [](const f32* in, f32* out, size_t n) noexcept { batch::rsqrt_quake(in, out, n); }};
+
+#ifdef FLN_SIMD_X86
+constexpr int oneAsInt  = static_cast<int>(oneAsInt32);///< float(1) as int for the intrinsics
+constexpr int rsqrtMagic= 0x5f3759df;                  ///< magic number of rsqrt_quake
+
+// ---=== SSE 4.1 ===---
+FLN_TARGET("sse4.1") void log2_sse41(const f32* in, f32* out, size_t n) noexcept {
+    const __m128i one  = _mm_set1_epi32(oneAsInt);
+    const __m128 scale = _mm_set1_ps(ScaleDown32);
+    size_t i= 0;
+    for(; i + 4 <= n; i+= 4) {
+        const __m128i b= _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        _mm_storeu_ps(out + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_sub_epi32(b, one)), scale));
+    }
+    for(; i < n; ++i) out[i]= bithack::log2(in[i]);
+}
+FLN_TARGET("sse4.1") void exp2_sse41(const f32* in, f32* out, size_t n) noexcept {
+    const __m128i one  = _mm_set1_epi32(oneAsInt);
+    const __m128 scale = _mm_set1_ps(ScaleUp32);
+    size_t i= 0;
+    for(; i + 4 <= n; i+= 4) {
+        const __m128 x= _mm_loadu_ps(in + i);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_add_epi32(_mm_cvttps_epi32(_mm_mul_ps(x, scale)), one));
+    }
+    for(; i < n; ++i) out[i]= bithack::exp2(in[i]);
+}
+FLN_TARGET("sse4.1") void pow_sse41(const f32* in, f32* out, size_t n, f32 p) noexcept {
+    const __m128i one= _mm_set1_epi32(oneAsInt);
+    const __m128 pv  = _mm_set1_ps(p);
+    size_t i= 0;
+    for(; i + 4 <= n; i+= 4) {
+        const __m128i b= _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        const __m128i r= _mm_cvttps_epi32(_mm_mul_ps(pv, _mm_cvtepi32_ps(_mm_sub_epi32(b, one))));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_add_epi32(r, one));
+    }
+    for(; i < n; ++i) out[i]= bithack::pow(in[i], p);
+}
+FLN_TARGET("sse4.1") void sqrt_sse41(const f32* in, f32* out, size_t n) noexcept {
+    const __m128i one= _mm_set1_epi32(oneAsInt);
+    size_t i= 0;
+    for(; i + 4 <= n; i+= 4) {
+        const __m128i b= _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_srli_epi32(_mm_add_epi32(b, one), 1));
+    }
+    for(; i < n; ++i) out[i]= bithack::sqrt(in[i]);
+}
+FLN_TARGET("sse4.1") void rsqrt_sse41(const f32* in, f32* out, size_t n) noexcept {
+    const __m128i magic= _mm_set1_epi32(rsqrtMagic);
+    const __m128 half  = _mm_set1_ps(0.5f);
+    const __m128 th    = _mm_set1_ps(1.5f);
+    size_t i= 0;
+    for(; i + 4 <= n; i+= 4) {
+        const __m128 x = _mm_loadu_ps(in + i);
+        const __m128 x2= _mm_mul_ps(x, half);
+        const __m128 y = _mm_castsi128_ps(_mm_sub_epi32(magic, _mm_srli_epi32(_mm_castps_si128(x), 1)));
+        _mm_storeu_ps(out + i, _mm_mul_ps(y, _mm_sub_ps(th, _mm_mul_ps(_mm_mul_ps(x2, y), y))));
+    }
+    for(; i < n; ++i) out[i]= bithack::rsqrt_quake(in[i]);
+}
+constexpr Kernels sse41Kernels{Isa::SSE41, log2_sse41, exp2_sse41, pow_sse41, sqrt_sse41, rsqrt_sse41};
+
+// ---=== AVX2 ===---
+FLN_TARGET("avx2") void log2_avx2(const f32* in, f32* out, size_t n) noexcept {
+    const __m256i one  = _mm256_set1_epi32(oneAsInt);
+    const __m256 scale = _mm256_set1_ps(ScaleDown32);
+    size_t i= 0;
+    for(; i + 8 <= n; i+= 8) {
+        const __m256i b= _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+        _mm256_storeu_ps(out + i, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_sub_epi32(b, one)), scale));
+    }
+    for(; i < n; ++i) out[i]= bithack::log2(in[i]);
+}
+FLN_TARGET("avx2") void exp2_avx2(const f32* in, f32* out, size_t n) noexcept {
+    const __m256i one  = _mm256_set1_epi32(oneAsInt);
+    const __m256 scale = _mm256_set1_ps(ScaleUp32);
+    size_t i= 0;
+    for(; i + 8 <= n; i+= 8) {
+        const __m256 x= _mm256_loadu_ps(in + i);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_add_epi32(_mm256_cvttps_epi32(_mm256_mul_ps(x, scale)), one));
+    }
+    for(; i < n; ++i) out[i]= bithack::exp2(in[i]);
+}
+FLN_TARGET("avx2") void pow_avx2(const f32* in, f32* out, size_t n, f32 p) noexcept {
+    const __m256i one= _mm256_set1_epi32(oneAsInt);
+    const __m256 pv  = _mm256_set1_ps(p);
+    size_t i= 0;
+    for(; i + 8 <= n; i+= 8) {
+        const __m256i b= _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+        const __m256i r= _mm256_cvttps_epi32(_mm256_mul_ps(pv, _mm256_cvtepi32_ps(_mm256_sub_epi32(b, one))));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_add_epi32(r, one));
+    }
+    for(; i < n; ++i) out[i]= bithack::pow(in[i], p);
+}
+FLN_TARGET("avx2") void sqrt_avx2(const f32* in, f32* out, size_t n) noexcept {
+    const __m256i one= _mm256_set1_epi32(oneAsInt);
+    size_t i= 0;
+    for(; i + 8 <= n; i+= 8) {
+        const __m256i b= _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_srli_epi32(_mm256_add_epi32(b, one), 1));
+    }
+    for(; i < n; ++i) out[i]= bithack::sqrt(in[i]);
+}
+FLN_TARGET("avx2") void rsqrt_avx2(const f32* in, f32* out, size_t n) noexcept {
+    const __m256i magic= _mm256_set1_epi32(rsqrtMagic);
+    const __m256 half  = _mm256_set1_ps(0.5f);
+    const __m256 th    = _mm256_set1_ps(1.5f);
+    size_t i= 0;
+    for(; i + 8 <= n; i+= 8) {
+        const __m256 x = _mm256_loadu_ps(in + i);
+        const __m256 x2= _mm256_mul_ps(x, half);
+        const __m256 y = _mm256_castsi256_ps(_mm256_sub_epi32(magic, _mm256_srli_epi32(_mm256_castps_si256(x), 1)));
+        _mm256_storeu_ps(out + i, _mm256_mul_ps(y, _mm256_sub_ps(th, _mm256_mul_ps(_mm256_mul_ps(x2, y), y))));
+    }
+    for(; i < n; ++i) out[i]= bithack::rsqrt_quake(in[i]);
+}
+constexpr Kernels avx2Kernels{Isa::AVX2, log2_avx2, exp2_avx2, pow_avx2, sqrt_avx2, rsqrt_avx2};
+
+// ---=== AVX-512 ===---
+#if defined(__GNUC__) && !defined(__clang__)
+// gcc intrinsic headers build the broadcast vectors from an undefined register
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+// the tail is handled with masked loads and stores instead of a scalar loop
+FLN_TARGET("avx512f") inline __mmask16 tailMask(size_t remaining) noexcept {
+    return remaining >= 16 ? __mmask16(0xFFFF) : __mmask16((1U << remaining) - 1U);
+}
+FLN_TARGET("avx512f") void log2_avx512(const f32* in, f32* out, size_t n) noexcept {
+    const __m512i one  = _mm512_set1_epi32(oneAsInt);
+    const __m512 scale = _mm512_set1_ps(ScaleDown32);
+    for(size_t i= 0; i < n; i+= 16) {
+        const __mmask16 m= tailMask(n - i);
+        const __m512i b  = _mm512_maskz_loadu_epi32(m, in + i);
+        _mm512_mask_storeu_ps(out + i, m, _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_sub_epi32(b, one)), scale));
+    }
+}
+FLN_TARGET("avx512f") void exp2_avx512(const f32* in, f32* out, size_t n) noexcept {
+    const __m512i one  = _mm512_set1_epi32(oneAsInt);
+    const __m512 scale = _mm512_set1_ps(ScaleUp32);
+    for(size_t i= 0; i < n; i+= 16) {
+        const __mmask16 m= tailMask(n - i);
+        const __m512 x   = _mm512_maskz_loadu_ps(m, in + i);
+        _mm512_mask_storeu_epi32(out + i, m, _mm512_add_epi32(_mm512_cvttps_epi32(_mm512_mul_ps(x, scale)), one));
+    }
+}
+FLN_TARGET("avx512f") void pow_avx512(const f32* in, f32* out, size_t n, f32 p) noexcept {
+    const __m512i one= _mm512_set1_epi32(oneAsInt);
+    const __m512 pv  = _mm512_set1_ps(p);
+    for(size_t i= 0; i < n; i+= 16) {
+        const __mmask16 m= tailMask(n - i);
+        const __m512i b  = _mm512_maskz_loadu_epi32(m, in + i);
+        const __m512i r  = _mm512_cvttps_epi32(_mm512_mul_ps(pv, _mm512_cvtepi32_ps(_mm512_sub_epi32(b, one))));
+        _mm512_mask_storeu_epi32(out + i, m, _mm512_add_epi32(r, one));
+    }
+}
+FLN_TARGET("avx512f") void sqrt_avx512(const f32* in, f32* out, size_t n) noexcept {
+    const __m512i one= _mm512_set1_epi32(oneAsInt);
+    for(size_t i= 0; i < n; i+= 16) {
+        const __mmask16 m= tailMask(n - i);
+        const __m512i b  = _mm512_maskz_loadu_epi32(m, in + i);
+        _mm512_mask_storeu_epi32(out + i, m, _mm512_srli_epi32(_mm512_add_epi32(b, one), 1));
+    }
+}
+FLN_TARGET("avx512f") void rsqrt_avx512(const f32* in, f32* out, size_t n) noexcept {
+    const __m512i magic= _mm512_set1_epi32(rsqrtMagic);
+    const __m512 half  = _mm512_set1_ps(0.5f);
+    const __m512 th    = _mm512_set1_ps(1.5f);
+    for(size_t i= 0; i < n; i+= 16) {
+        const __mmask16 m= tailMask(n - i);
+        const __m512 x   = _mm512_maskz_loadu_ps(m, in + i);
+        const __m512 x2  = _mm512_mul_ps(x, half);
+        const __m512 y   = _mm512_castsi512_ps(_mm512_sub_epi32(magic, _mm512_srli_epi32(_mm512_castps_si512(x), 1)));
+        _mm512_mask_storeu_ps(out + i, m, _mm512_mul_ps(y, _mm512_sub_ps(th, _mm512_mul_ps(_mm512_mul_ps(x2, y), y))));
+    }
+}
+constexpr Kernels avx512Kernels{Isa::AVX512, log2_avx512, exp2_avx512, pow_avx512, sqrt_avx512, rsqrt_avx512};
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+// ---=== CPU detection ===---
+#if defined(_MSC_VER)
+/**
+ * @brief Check the cpuid bits and the OS support of the extended registers.
+ * @param isa The instruction set to check.
+ * @return True if supported.
+ */
+bool cpuSupports(Isa isa) noexcept {
+    int regs[4];
+    __cpuid(regs, 0);
+    const int maxLeaf= regs[0];
+    __cpuid(regs, 1);
+    const bool sse41  = (regs[2] & (1 << 19)) != 0;
+    const bool osxsave= (regs[2] & (1 << 27)) != 0;
+    const u64 xcr0    = osxsave ? _xgetbv(0) : 0;
+    bool avx2= false, avx512= false;
+    if(maxLeaf >= 7) {
+        __cpuidex(regs, 7, 0);
+        avx2  = (regs[1] & (1 << 5)) != 0 && (xcr0 & 0x6) == 0x6;
+        avx512= (regs[1] & (1 << 16)) != 0 && (xcr0 & 0xE6) == 0xE6;
+    }
+    switch(isa) {
+    case Isa::Scalar: return true;
+    case Isa::SSE41: return sse41;
+    case Isa::AVX2: return avx2;
+    case Isa::AVX512: return avx512;
+    }
+    return false;
+}
+#else
+/**
+ * @brief Check the cpuid bits and the OS support of the extended registers.
+ * @param isa The instruction set to check.
+ * @return True if supported.
+ */
+bool cpuSupports(Isa isa) noexcept {
+    __builtin_cpu_init();
+    switch(isa) {
+    case Isa::Scalar: return true;
+    case Isa::SSE41: return __builtin_cpu_supports("sse4.1");
+    case Isa::AVX2: return __builtin_cpu_supports("avx2");
+    case Isa::AVX512: return __builtin_cpu_supports("avx512f");
+    }
+    return false;
+}
+#endif
+#else
+bool cpuSupports(Isa isa) noexcept { return isa == Isa::Scalar; }
+#endif
+
+/**
+ * @brief Get the kernel table of an instruction set.
+ * @param isa The instruction set.
+ * @return The kernel table.
+ */
+const Kernels* kernelsFor(Isa isa) noexcept {
+#ifdef FLN_SIMD_X86
+    switch(isa) {
+    case Isa::Scalar: return &scalarKernels;
+    case Isa::SSE41: return &sse41Kernels;
+    case Isa::AVX2: return &avx2Kernels;
+    case Isa::AVX512: return &avx512Kernels;
+    }
+#else
+    (void)isa;
+#endif
+    return &scalarKernels;
+}
+
+/**
+ * @brief The active kernel table, selected once at the first call.
+ * @return Reference to the active table pointer.
+ */
+std::atomic<const Kernels*>& active() noexcept {
+    static std::atomic<const Kernels*> kernels{kernelsFor(bestIsa())};
+    return kernels;
+}
+
+}// namespace
+
+const char* isaName(Isa isa) noexcept {
+    switch(isa) {
+    case Isa::Scalar: return "Scalar";
+    case Isa::SSE41: return "SSE4.1";
+    case Isa::AVX2: return "AVX2";
+    case Isa::AVX512: return "AVX-512";
+    }
+    return "Unknown";
+}
+
+bool isSupported(Isa isa) noexcept {
+    static const bool supported[]= {cpuSupports(Isa::Scalar), cpuSupports(Isa::SSE41), cpuSupports(Isa::AVX2), cpuSupports(Isa::AVX512)};
+    return supported[static_cast<int>(isa)];
+}
+
+Isa bestIsa() noexcept {
+    if(isSupported(Isa::AVX512)) return Isa::AVX512;
+    if(isSupported(Isa::AVX2)) return Isa::AVX2;
+    if(isSupported(Isa::SSE41)) return Isa::SSE41;
+    return Isa::Scalar;
+}
+
+Isa activeIsa() noexcept { return active().load(std::memory_order_relaxed)->isa; }
+
+bool setActiveIsa(Isa isa) noexcept {
+    if(!isSupported(isa)) return false;
+    active().store(kernelsFor(isa), std::memory_order_relaxed);
+    return true;
+}
+
+void log2(const f32* in, f32* out, size_t n) noexcept { active().load(std::memory_order_relaxed)->log2(in, out, n); }
+void exp2(const f32* in, f32* out, size_t n) noexcept { active().load(std::memory_order_relaxed)->exp2(in, out, n); }
+void pow(const f32* in, f32* out, size_t n, f32 p) noexcept { active().load(std::memory_order_relaxed)->pow(in, out, n, p); }
+void sqrt(const f32* in, f32* out, size_t n) noexcept { active().load(std::memory_order_relaxed)->sqrt(in, out, n); }
+void rsqrt(const f32* in, f32* out, size_t n) noexcept { active().load(std::memory_order_relaxed)->rsqrt(in, out, n); }
+
+}// namespace fln::bithack::simd
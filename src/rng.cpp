@@ -0,0 +1,349 @@
+/**
+ * \file rng.cpp
+ *
+ * \date 17/10/2026
+ * \author Silmaen
+ */
+#include "rng.h"
+#include "simdTarget.h"
+
+namespace fln::rand {
+
+namespace {
+
+/// state of the lanes
+using LaneState= std::array<std::array<u64, BulkRandomGenerator::lanes>, 4>;
+/// number of numbers generated at once before conversion
+constexpr size_t chunkSize= 256;
+
+/**
+ * @brief Generate blocks of numbers, one per lane (the independent lanes keep the pipeline busy).
+ * @param state The states.
+ * @param out The output.
+ * @param blocks The number of blocks.
+ */
+void generateScalar(LaneState& state, u64* out, size_t blocks) noexcept {
+    constexpr size_t L= BulkRandomGenerator::lanes;
+    LaneState s       = state;// local copy: cannot alias the output
+    for(size_t b= 0; b < blocks; ++b, out+= L) {
+        for(size_t l= 0; l < L; ++l) {
+            out[l]     = std::rotl(s[1][l] * 5U, 7) * 9U;
+            const u64 t= s[1][l] << 17U;
+            s[2][l]^= s[0][l];
+            s[3][l]^= s[1][l];
+            s[1][l]^= s[2][l];
+            s[0][l]^= s[3][l];
+            s[2][l]^= t;
+            s[3][l]= std::rotl(s[3][l], 45);
+        }
+    }
+    state= s;
+}
+
+#ifdef FLN_SIMD_X86
+FLN_TARGET("avx2") inline __m256i rotl(__m256i x, int k) noexcept {
+    return _mm256_or_si256(_mm256_slli_epi64(x, k), _mm256_srli_epi64(x, 64 - k));
+}
+
+FLN_TARGET("avx2") void generateAvx2(LaneState& s, u64* out, size_t blocks) noexcept {
+    __m256i s0[2], s1[2], s2[2], s3[2];
+    for(size_t h= 0; h < 2; ++h) {
+        s0[h]= _mm256_load_si256(reinterpret_cast<const __m256i*>(s[0].data() + 4 * h));
+        s1[h]= _mm256_load_si256(reinterpret_cast<const __m256i*>(s[1].data() + 4 * h));
+        s2[h]= _mm256_load_si256(reinterpret_cast<const __m256i*>(s[2].data() + 4 * h));
+        s3[h]= _mm256_load_si256(reinterpret_cast<const __m256i*>(s[3].data() + 4 * h));
+    }
+    for(size_t b= 0; b < blocks; ++b, out+= BulkRandomGenerator::lanes) {
+        for(size_t h= 0; h < 2; ++h) {
+            // rotl(s1 * 5, 7) * 9 with shifts and adds (no 64 bits multiply in AVX2)
+            const __m256i x5= _mm256_add_epi64(s1[h], _mm256_slli_epi64(s1[h], 2));
+            const __m256i r = rotl(x5, 7);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 4 * h), _mm256_add_epi64(r, _mm256_slli_epi64(r, 3)));
+            const __m256i t= _mm256_slli_epi64(s1[h], 17);
+            s2[h]          = _mm256_xor_si256(s2[h], s0[h]);
+            s3[h]          = _mm256_xor_si256(s3[h], s1[h]);
+            s1[h]          = _mm256_xor_si256(s1[h], s2[h]);
+            s0[h]          = _mm256_xor_si256(s0[h], s3[h]);
+            s2[h]          = _mm256_xor_si256(s2[h], t);
+            s3[h]          = rotl(s3[h], 45);
+        }
+    }
+    for(size_t h= 0; h < 2; ++h) {
+        _mm256_store_si256(reinterpret_cast<__m256i*>(s[0].data() + 4 * h), s0[h]);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(s[1].data() + 4 * h), s1[h]);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(s[2].data() + 4 * h), s2[h]);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(s[3].data() + 4 * h), s3[h]);
+    }
+}
+#endif
+
+/**
+ * @brief Generate blocks of numbers with the best instruction set.
+ * @param s The states.
+ * @param out The output.
+ * @param blocks The number of blocks.
+ */
+void generate(LaneState& s, u64* out, size_t blocks) noexcept {
+#ifdef FLN_SIMD_X86
+    if(bithack::simd::useAvx2()) {
+        generateAvx2(s, out, blocks);
+        return;
+    }
+#endif
+    generateScalar(s, out, blocks);
+}
+
+/**
+ * @brief Conversion of 64 bits numbers into two 32 bits integers each.
+ * @param in The numbers.
+ * @param out The output.
+ * @param n The number of outputs.
+ */
+FLN_FORCE_INLINE void toU32(const u64* in, u32* out, size_t n) noexcept {
+    for(size_t k= 0; 2 * k + 1 < n; ++k) {
+        out[2 * k]    = static_cast<u32>(in[k] >> 32U);
+        out[2 * k + 1]= static_cast<u32>(in[k]);
+    }
+    if(n & 1U) out[n - 1]= static_cast<u32>(in[n / 2] >> 32U);
+}
+/**
+ * @brief Conversion of 64 bits numbers into two uniform floats in [a, a + range) each.
+ * @param in The numbers.
+ * @param out The output.
+ * @param n The number of outputs.
+ * @param a The lower bound.
+ * @param range The size of the interval.
+ */
+FLN_FORCE_INLINE void toF32(const u64* in, f32* out, size_t n, f32 a, f32 range) noexcept {
+    for(size_t k= 0; 2 * k + 1 < n; ++k) {
+        out[2 * k]    = a + uniformF32(in[k]) * range;
+        out[2 * k + 1]= a + uniformF32(in[k] << 32U) * range;
+    }
+    if(n & 1U) out[n - 1]= a + uniformF32(in[n / 2]) * range;
+}
+/**
+ * @brief Conversion of 64 bits numbers into uniform doubles in [a, a + range).
+ * @param in The numbers.
+ * @param out The output.
+ * @param n The number of outputs.
+ * @param a The lower bound.
+ * @param range The size of the interval.
+ */
+FLN_FORCE_INLINE void toF64(const u64* in, f64* out, size_t n, f64 a, f64 range) noexcept {
+    for(size_t i= 0; i < n; ++i) out[i]= a + uniformF64(in[i]) * range;
+}
+
+#ifdef FLN_SIMD_X86
+FLN_TARGET("avx2") void toU32Avx2(const u64* in, u32* out, size_t n) noexcept { toU32(in, out, n); }
+FLN_TARGET("avx2") void toF32Avx2(const u64* in, f32* out, size_t n, f32 a, f32 range) noexcept { toF32(in, out, n, a, range); }
+FLN_TARGET("avx2") void toF64Avx2(const u64* in, f64* out, size_t n, f64 a, f64 range) noexcept { toF64(in, out, n, a, range); }
+#endif
+
+/**
+ * @brief Philox blocks, two numbers each.
+ * @param key The key.
+ * @param block The counter of the first block.
+ * @param out The output.
+ * @param blocks The number of blocks.
+ */
+void philoxScalar(u64 key, u64 block, u64* out, size_t blocks) noexcept {
+    const Philox4x32::Key k{static_cast<u32>(key), static_cast<u32>(key >> 32U)};
+    for(size_t b= 0; b < blocks; ++b, ++block) {
+        const auto r= Philox4x32::block({static_cast<u32>(block), static_cast<u32>(block >> 32U), 0, 0}, k);
+        out[2 * b]    = r[0] | (u64{r[1]} << 32U);
+        out[2 * b + 1]= r[2] | (u64{r[3]} << 32U);
+    }
+}
+
+#ifdef FLN_SIMD_X86
+FLN_TARGET("avx2") void philoxAvx2(u64 key, u64 block, u64* out, size_t blocks) noexcept {
+    // one 32 bits word per 64 bits lane: _mm256_mul_epu32 gives the full products
+    const __m256i m0  = _mm256_set1_epi64x(0xD2511F53);
+    const __m256i m1  = _mm256_set1_epi64x(0xCD9E8D57);
+    const __m256i low = _mm256_set1_epi64x(0xFFFFFFFF);
+    const __m256i step= _mm256_setr_epi64x(0, 1, 2, 3);
+    size_t b          = 0;
+    for(; b + 8 <= blocks; b+= 8) {
+        __m256i x0[2], x1[2], x2[2], x3[2];
+        for(size_t h= 0; h < 2; ++h) {
+            const __m256i n= _mm256_add_epi64(_mm256_set1_epi64x(static_cast<s64>(block + b + 4 * h)), step);
+            x0[h]          = _mm256_and_si256(n, low);
+            x1[h]          = _mm256_srli_epi64(n, 32);
+            x2[h]          = _mm256_setzero_si256();
+            x3[h]          = _mm256_setzero_si256();
+        }
+        u32 k0= static_cast<u32>(key);
+        u32 k1= static_cast<u32>(key >> 32U);
+        for(u32 round= 0; round < 10; ++round) {
+            if(round > 0) {
+                k0+= 0x9E3779B9U;
+                k1+= 0xBB67AE85U;
+            }
+            const __m256i kk0= _mm256_set1_epi64x(k0);
+            const __m256i kk1= _mm256_set1_epi64x(k1);
+            for(size_t h= 0; h < 2; ++h) {
+                const __m256i p0= _mm256_mul_epu32(x0[h], m0);
+                const __m256i p1= _mm256_mul_epu32(x2[h], m1);
+                x0[h]           = _mm256_xor_si256(_mm256_xor_si256(_mm256_srli_epi64(p1, 32), x1[h]), kk0);
+                x1[h]           = _mm256_and_si256(p1, low);
+                x2[h]           = _mm256_xor_si256(_mm256_xor_si256(_mm256_srli_epi64(p0, 32), x3[h]), kk1);
+                x3[h]           = _mm256_and_si256(p0, low);
+            }
+        }
+        for(size_t h= 0; h < 2; ++h) {
+            const __m256i first = _mm256_or_si256(x0[h], _mm256_slli_epi64(x1[h], 32));
+            const __m256i second= _mm256_or_si256(x2[h], _mm256_slli_epi64(x3[h], 32));
+            const __m256i lo    = _mm256_unpacklo_epi64(first, second);
+            const __m256i hi    = _mm256_unpackhi_epi64(first, second);
+            u64* o              = out + 2 * (b + 4 * h);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(o), _mm256_permute2x128_si256(lo, hi, 0x20));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(o + 4), _mm256_permute2x128_si256(lo, hi, 0x31));
+        }
+    }
+    philoxScalar(key, block + b, out + 2 * b, blocks - b);
+}
+#endif
+
+/**
+ * @brief The numbers at(key, counter) to at(key, counter + n - 1) with the best instruction set.
+ * @param key The key.
+ * @param counter The first counter.
+ * @param out The output.
+ * @param n The number of numbers.
+ */
+void philox(u64 key, u64 counter, u64* out, size_t n) noexcept {
+    if(n == 0) return;
+    if(counter & 1U) {
+        *out++= Philox4x32::at(key, counter++);
+        --n;
+    }
+    const size_t blocks= n / 2;
+#ifdef FLN_SIMD_X86
+    if(bithack::simd::useAvx2()) philoxAvx2(key, counter >> 1U, out, blocks);
+    else
+#endif
+        philoxScalar(key, counter >> 1U, out, blocks);
+    if(n & 1U) out[n - 1]= Philox4x32::at(key, counter + n - 1);
+}
+
+/**
+ * @brief Fill an array by chunks of 64 bits numbers converted while they are in the cache.
+ * @tparam PerDraw Number of outputs built from one 64 bits number.
+ * @tparam T The output type.
+ * @tparam Generate The generation function type.
+ * @tparam Convert The conversion function type.
+ * @param out The output.
+ * @param generate The generation of a number of 64 bits numbers (at least) into a buffer.
+ * @param convert The conversion of a chunk of numbers into outputs.
+ */
+template<size_t PerDraw, typename T, typename Generate, typename Convert>
+void fillChunks(std::span<T> out, Generate generate, Convert convert) noexcept {
+    alignas(64) std::array<u64, chunkSize> buffer;
+    for(size_t i= 0; i < out.size(); i+= chunkSize * PerDraw) {
+        const size_t count= std::min(chunkSize * PerDraw, out.size() - i);
+        generate(buffer.data(), (count + PerDraw - 1) / PerDraw);
+        convert(buffer.data(), out.data() + i, count);
+    }
+}
+
+/**
+ * @brief Conversion into uniform floats with the best instruction set.
+ * @param in The numbers.
+ * @param out The output.
+ * @param n The number of outputs.
+ * @param a The lower bound.
+ * @param range The size of the interval.
+ */
+void convertF32(const u64* in, f32* out, size_t n, f32 a, f32 range) noexcept {
+#ifdef FLN_SIMD_X86
+    if(bithack::simd::useAvx2()) return toF32Avx2(in, out, n, a, range);
+#endif
+    toF32(in, out, n, a, range);
+}
+
+/**
+ * @brief Conversion into uniform doubles with the best instruction set.
+ * @param in The numbers.
+ * @param out The output.
+ * @param n The number of outputs.
+ * @param a The lower bound.
+ * @param range The size of the interval.
+ */
+void convertF64(const u64* in, f64* out, size_t n, f64 a, f64 range) noexcept {
+#ifdef FLN_SIMD_X86
+    if(bithack::simd::useAvx2()) return toF64Avx2(in, out, n, a, range);
+#endif
+    toF64(in, out, n, a, range);
+}
+
+/**
+ * @brief Generator of chunks for the bulk generator.
+ * @param s The states.
+ * @return The generation function.
+ */
+auto laneSource(LaneState& s) noexcept {
+    return [&s](u64* buffer, size_t draws) { generate(s, buffer, (draws + BulkRandomGenerator::lanes - 1) / BulkRandomGenerator::lanes); };
+}
+
+}// namespace
+
+BulkRandomGenerator::BulkRandomGenerator(u64 seed) noexcept:
+    BulkRandomGenerator(Xoshiro256ss(seed)) {}
+
+BulkRandomGenerator::BulkRandomGenerator(Xoshiro256ss base) noexcept {
+    for(size_t l= 0; l < lanes; ++l) {
+        for(size_t w= 0; w < 4; ++w) state[w][l]= base.state[w];
+        base.jump();
+    }
+}
+
+void BulkRandomGenerator::fill(std::span<u64> out) noexcept {
+    const size_t full= out.size() / lanes;
+    generate(state, out.data(), full);
+    if(full * lanes < out.size()) {
+        std::array<u64, lanes> tail;
+        generate(state, tail.data(), 1);
+        std::copy_n(tail.begin(), out.size() - full * lanes, out.begin() + static_cast<std::ptrdiff_t>(full * lanes));
+    }
+}
+
+void BulkRandomGenerator::fill(std::span<u32> out) noexcept {
+    fillChunks<2>(out, laneSource(state), [](const u64* in, u32* o, size_t n) {
+#ifdef FLN_SIMD_X86
+        if(bithack::simd::useAvx2()) return toU32Avx2(in, o, n);
+#endif
+        toU32(in, o, n);
+    });
+}
+
+void BulkRandomGenerator::fill(std::span<f32> out) noexcept { fill(out, 0.0f, 1.0f); }
+
+void BulkRandomGenerator::fill(std::span<f64> out) noexcept { fill(out, 0.0, 1.0); }
+
+void BulkRandomGenerator::fill(std::span<f32> out, f32 a, f32 b) noexcept {
+    fillChunks<2>(out, laneSource(state), [a, range= b - a](const u64* in, f32* o, size_t n) { convertF32(in, o, n, a, range); });
+}
+
+void BulkRandomGenerator::fill(std::span<f64> out, f64 a, f64 b) noexcept {
+    fillChunks<1>(out, laneSource(state), [a, range= b - a](const u64* in, f64* o, size_t n) { convertF64(in, o, n, a, range); });
+}
+
+void Philox4x32::fill(u64 k, u64 c, std::span<u64> out) noexcept { philox(k, c, out.data(), out.size()); }
+
+void Philox4x32::fill(u64 k, u64 c, std::span<f32> out) noexcept {
+    const auto source= [k, c](u64* buffer, size_t draws) mutable {
+        philox(k, c, buffer, draws);
+        c+= draws;
+    };
+    fillChunks<2>(out, source, [](const u64* in, f32* o, size_t n) { convertF32(in, o, n, 0.0f, 1.0f); });
+}
+
+void Philox4x32::fill(u64 k, u64 c, std::span<f64> out) noexcept {
+    const auto source= [k, c](u64* buffer, size_t draws) mutable {
+        philox(k, c, buffer, draws);
+        c+= draws;
+    };
+    fillChunks<1>(out, source, [](const u64* in, f64* o, size_t n) { convertF64(in, o, n, 0.0, 1.0); });
+}
+
+}// namespace fln::rand
@@ -0,0 +1,47 @@
+/**
+ * \file simdTarget.h
+ *
+ * \date 17/10/2026
+ * \author Silmaen
+ */
+
+#pragma once
+#include "bithack_SimdFunctions.h"
+
+/**
+ * Private helpers of the SIMD kernels of the library: detection of the x86 targets
+ * (FLN_SIMD_X86), per function instruction sets (FLN_TARGET) and forced inlining of the
+ * kernel building blocks (FLN_FORCE_INLINE). The instruction set is chosen at runtime
+ * by fln::bithack::simd::activeIsa().
+ */
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define FLN_SIMD_X86
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define FLN_TARGET(x)
+#else
+#define FLN_TARGET(x) __attribute__((target(x)))
+#endif
+#endif
+#if defined(_MSC_VER)
+#define FLN_FORCE_INLINE __forceinline
+#else
+#define FLN_FORCE_INLINE __attribute__((always_inline)) inline
+#endif
+
+namespace fln::bithack::simd {
+
+/**
+ * @brief Check if the AVX2 kernels can be used.
+ * @return True if AVX2 is the active instruction set (or better).
+ */
+inline bool useAvx2() noexcept {
+#ifdef FLN_SIMD_X86
+    return activeIsa() >= Isa::AVX2;
+#else
+    return false;
+#endif
+}
+
+}// namespace fln::bithack::simd
@@ -3,7 +3,607 @@
 * \author Silmaen
 */
 #include "stdComputeStats.h"
+#include "simdTarget.h"
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <system_error>
+#include <thread>
 
 namespace fln::stats {
 
+namespace {
+
+/// number of values summarized at once: the second pass reads them from the L1 cache
+constexpr size_t blockSize= 1024;
+/// number of independent accumulators of the portable kernel
+constexpr size_t lanes= 8;
+
+/**
+ * @brief Statistics of a block: sums and min/max in a first pass, squared deviations in a second.
+ *
+ * Each lane has its own accumulators, so the compiler can vectorize without reordering
+ * the floating point operations. Integers are summed exactly in 64 bits, floats in double.
+ *
+ * @tparam T The data type.
+ * @param x The values.
+ * @param n The number of values (not 0).
+ * @return The statistics.
+ */
+template<typename T>
+FLN_FORCE_INLINE StreamingStats<T> summarizeBlock(const T* x, size_t n) noexcept {
+    using acc= std::conditional_t<std::is_integral_v<T>, sumType<T>, f64>;
+    std::array<acc, lanes> sum{};
+    std::array<u64, lanes> sq{};
+    std::array<T, lanes> mi;
+    std::array<T, lanes> ma;
+    mi.fill(x[0]);
+    ma.fill(x[0]);
+    const size_t full= n - n % lanes;
+    for(size_t i= 0; i < full; i+= lanes) {
+        for(size_t l= 0; l < lanes; ++l) {
+            const T v= x[i + l];
+            sum[l]+= static_cast<acc>(v);
+            if constexpr(std::is_integral_v<T>) sq[l]= detail::addSaturated(sq[l], detail::squareOf(v));
+            mi[l]= detail::minOf(mi[l], v);
+            ma[l]= detail::maxOf(ma[l], v);
+        }
+    }
+    for(size_t i= full; i < n; ++i) {
+        sum[0]+= static_cast<acc>(x[i]);
+        if constexpr(std::is_integral_v<T>) sq[0]= detail::addSaturated(sq[0], detail::squareOf(x[i]));
+        mi[0]= detail::minOf(mi[0], x[i]);
+        ma[0]= detail::maxOf(ma[0], x[i]);
+    }
+    acc total  = sum[0];
+    u64 squares= sq[0];
+    T mn       = mi[0];
+    T mx       = ma[0];
+    for(size_t l= 1; l < lanes; ++l) {
+        total+= sum[l];
+        squares= detail::addSaturated(squares, sq[l]);
+        mn= detail::minOf(mn, mi[l]);
+        mx= detail::maxOf(mx, ma[l]);
+    }
+    const f64 mean= static_cast<f64>(total) / static_cast<f64>(n);
+    std::array<f64, lanes> m2{};
+    for(size_t i= 0; i < full; i+= lanes) {
+        for(size_t l= 0; l < lanes; ++l) {
+            const f64 d= static_cast<f64>(x[i + l]) - mean;
+            m2[l]+= d * d;
+        }
+    }
+    for(size_t i= full; i < n; ++i) {
+        const f64 d= static_cast<f64>(x[i]) - mean;
+        m2[0]+= d * d;
+    }
+    f64 dev= 0;
+    for(const f64 m: m2) dev+= m;
+    return StreamingStats<T>::fromMoments(n, mean, dev, total, mn, mx, squares);
+}
+
+StreamingStats<f32> blockScalar(const f32* x, size_t n) noexcept { return summarizeBlock(x, n); }
+StreamingStats<f64> blockScalar(const f64* x, size_t n) noexcept { return summarizeBlock(x, n); }
+StreamingStats<s32> blockScalar(const s32* x, size_t n) noexcept { return summarizeBlock(x, n); }
+StreamingStats<u32> blockScalar(const u32* x, size_t n) noexcept { return summarizeBlock(x, n); }
+
+#ifdef FLN_SIMD_X86
+/**
+ * @brief Load 4 values converted to double.
+ * @param p The values.
+ * @return The doubles.
+ */
+FLN_TARGET("avx2") FLN_FORCE_INLINE __m256d toDouble(const f32* p) noexcept { return _mm256_cvtps_pd(_mm_loadu_ps(p)); }
+FLN_TARGET("avx2") FLN_FORCE_INLINE __m256d toDouble(const f64* p) noexcept { return _mm256_loadu_pd(p); }
+FLN_TARGET("avx2") FLN_FORCE_INLINE __m256d toDouble(const s32* p) noexcept { return _mm256_cvtepi32_pd(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))); }
+FLN_TARGET("avx2") FLN_FORCE_INLINE __m256d toDouble(const u32* p) noexcept {
+    // flip the sign bit to use the signed conversion, then add the offset back
+    const __m128i v= _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), _mm_set1_epi32(static_cast<s32>(0x80000000U)));
+    return _mm256_add_pd(_mm256_cvtepi32_pd(v), _mm256_set1_pd(2147483648.0));
+}
+
+/**
+ * @brief Sum of the 4 doubles of a register.
+ * @param v The register.
+ * @return The sum.
+ */
+FLN_TARGET("avx2") FLN_FORCE_INLINE f64 horizontalSum(__m256d v) noexcept {
+    const __m128d h= _mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(h, _mm_unpackhi_pd(h, h)));
+}
+
+/**
+ * @brief Sum of the squared deviations to the mean.
+ * @tparam T The data type.
+ * @param x The values.
+ * @param n The number of values.
+ * @param mean The mean.
+ * @return The sum.
+ */
+template<typename T>
+FLN_TARGET("avx2") FLN_FORCE_INLINE f64 squaredDeviations(const T* x, size_t n, f64 mean) noexcept {
+    const __m256d m= _mm256_set1_pd(mean);
+    // four independent chains hide the latency of the additions
+    __m256d q[4]= {_mm256_setzero_pd(), _mm256_setzero_pd(), _mm256_setzero_pd(), _mm256_setzero_pd()};
+    size_t i= 0;
+    for(; i + 16 <= n; i+= 16) {
+        for(size_t k= 0; k < 4; ++k) {
+            const __m256d d= _mm256_sub_pd(toDouble(x + i + 4 * k), m);
+            q[k]           = _mm256_add_pd(q[k], _mm256_mul_pd(d, d));
+        }
+    }
+    f64 res= horizontalSum(_mm256_add_pd(_mm256_add_pd(q[0], q[1]), _mm256_add_pd(q[2], q[3])));
+    for(; i < n; ++i) {
+        const f64 d= static_cast<f64>(x[i]) - mean;
+        res+= d * d;
+    }
+    return res;
+}
+
+/// AVX2 operations on floats
+struct F32Ops {
+    using Vec= __m256;///< register
+    FLN_TARGET("avx2") static FLN_FORCE_INLINE Vec load(const f32* p) noexcept { return _mm256_loadu_ps(p); }
+    FLN_TARGET("avx2") static FLN_FORCE_INLINE Vec set1(f32 a) noexcept { return _mm256_set1_ps(a); }
+    FLN_TARGET("avx2") static FLN_FORCE_INLINE Vec isNan(Vec a) noexcept { return _mm256_cmp_ps(a, a, _CMP_UNORD_Q); }
+    FLN_TARGET("avx2") static FLN_FORCE_INLINE Vec bitOr(Vec a, Vec b) noexcept { return _mm256_or_ps(a, b); }
+    FLN_TARGET("avx2") static FLN_FORCE_INLINE bool any(Vec a) noexcept { return _mm256_movemask_ps(a) != 0; }
+    FLN_TARGET("avx2") static FLN_FORCE_INLINE Vec min(Vec a, Vec b) noexcept { return _mm256_min_ps(a, b); }
+    FLN_TARGET("avx2") static FLN_FORCE_INLINE Vec max(Vec a, Vec b) noexcept { return _mm256_max_ps(a, b); }
+    static constexpr size_t width= 8;///< values per register
+    FLN_TARGET("avx2") static FLN_FORCE_INLINE Vec zero() noexcept { return _mm256_setzero_ps(); }
+    FLN_TARGET("avx2") static FLN_FORCE_INLINE void store(f32* p, Vec a) noexcept { _mm256_storeu_ps(p, a); }
+    FLN_TARGET("avx2") static FLN_FORCE_INLINE Vec add(Vec a, Vec b) noexcept { return _mm256_add_ps(a, b); }
+    FLN_TARGET("avx2") static FLN_FORCE_INLINE Vec sub(Vec a, Vec b) noexcept { return _mm256_sub_ps(a, b); }
+};
+/// AVX2 operations on doubles
+struct F64Ops {
+    using Vec= __m256d;///< register
+    FLN_TARGET("avx2") static FLN_FORCE_INLINE Vec load(const f64* p) noexcept { return _mm256_loadu_pd(p); }
+    FLN_TARGET("avx2") static FLN_FORCE_INLINE Vec set1(f64 a) noexcept { return _mm256_set1_pd(a); }
+    FLN_TARGET("avx2") static FLN_FORCE_INLINE Vec isNan(Vec a) noexcept { return _mm256_cmp_pd(a, a, _CMP_UNORD_Q); }
+    FLN_TARGET("avx2") static FLN_FORCE_INLINE Vec bitOr(Vec a, Vec b) noexcept { return _mm256_or_pd(a, b); }
+    FLN_TARGET("avx2") static FLN_FORCE_INLINE bool any(Vec a) noexcept { return _mm256_movemask_pd(a) != 0; }
+    FLN_TARGET("avx2") static FLN_FORCE_INLINE Vec min(Vec a, Vec b) noexcept { return _mm256_min_pd(a, b); }
+    FLN_TARGET("avx2") static FLN_FORCE_INLINE Vec max(Vec a, Vec b) noexcept { return _mm256_max_pd(a, b); }
+    static constexpr size_t width= 4;///< values per register
+    FLN_TARGET("avx2") static FLN_FORCE_INLINE Vec zero() noexcept { return _mm256_setzero_pd(); }
+    FLN_TARGET("avx2") static FLN_FORCE_INLINE void store(f64* p, Vec a) noexcept { _mm256_storeu_pd(p, a); }
+    FLN_TARGET("avx2") static FLN_FORCE_INLINE Vec add(Vec a, Vec b) noexcept { return _mm256_add_pd(a, b); }
+    FLN_TARGET("avx2") static FLN_FORCE_INLINE Vec sub(Vec a, Vec b) noexcept { return _mm256_sub_pd(a, b); }
+};
+/**
+ * @brief Saturated addition of unsigned 64 bits values.
+ * @param a The first values.
+ * @param b The second values.
+ * @return The sums, all bits set on overflow.
+ */
+FLN_TARGET("avx2") FLN_FORCE_INLINE __m256i addSaturated(__m256i a, __m256i b) noexcept {
+    const __m256i s   = _mm256_add_epi64(a, b);
+    const __m256i sign= _mm256_set1_epi64x(std::numeric_limits<s64>::min());
+    // unsigned overflow when the sum is below the first term
+    return _mm256_or_si256(s, _mm256_cmpgt_epi64(_mm256_xor_si256(a, sign), _mm256_xor_si256(s, sign)));
+}
+
+/// AVX2 operations on signed integers
+struct S32Ops {
+    FLN_TARGET("avx2") static FLN_FORCE_INLINE __m256i magnitude(__m256i v) noexcept { return _mm256_abs_epi32(v); }
+    FLN_TARGET("avx2") static FLN_FORCE_INLINE __m256i widen(__m128i v) noexcept { return _mm256_cvtepi32_epi64(v); }
+    FLN_TARGET("avx2") static FLN_FORCE_INLINE __m256i min(__m256i a, __m256i b) noexcept { return _mm256_min_epi32(a, b); }
+    FLN_TARGET("avx2") static FLN_FORCE_INLINE __m256i max(__m256i a, __m256i b) noexcept { return _mm256_max_epi32(a, b); }
+};
+/// AVX2 operations on unsigned integers
+struct U32Ops {
+    FLN_TARGET("avx2") static FLN_FORCE_INLINE __m256i magnitude(__m256i v) noexcept { return v; }
+    FLN_TARGET("avx2") static FLN_FORCE_INLINE __m256i widen(__m128i v) noexcept { return _mm256_cvtepu32_epi64(v); }
+    FLN_TARGET("avx2") static FLN_FORCE_INLINE __m256i min(__m256i a, __m256i b) noexcept { return _mm256_min_epu32(a, b); }
+    FLN_TARGET("avx2") static FLN_FORCE_INLINE __m256i max(__m256i a, __m256i b) noexcept { return _mm256_max_epu32(a, b); }
+};
+
+/**
+ * @brief Statistics of a block of floats: sums in double, min/max in the data type.
+ *
+ * The min/max instructions skip the NaN of their first operand: the NaN are tracked in a
+ * mask, to give NaN as the scalar kernel.
+ * @tparam T The data type.
+ * @tparam Ops The operations on the registers of the data type.
+ * @param x The values.
+ * @param n The number of values (not 0).
+ * @return The statistics.
+ */
+template<typename T, typename Ops>
+FLN_TARGET("avx2") FLN_FORCE_INLINE StreamingStats<T> floatBlock(const T* x, size_t n) noexcept {
+    using Vec= typename Ops::Vec;
+    constexpr size_t width= sizeof(Vec) / sizeof(T);
+    __m256d s[4]= {_mm256_setzero_pd(), _mm256_setzero_pd(), _mm256_setzero_pd(), _mm256_setzero_pd()};
+    // blocks may be shorter than a register: no load before the main loop
+    Vec mi  = Ops::set1(x[0]);
+    Vec ma  = mi;
+    Vec nan = Ops::zero();
+    size_t i= 0;
+    for(; i + 16 <= n; i+= 16) {
+        for(size_t k= 0; k < 4; ++k) s[k]= _mm256_add_pd(s[k], toDouble(x + i + 4 * k));
+        for(size_t k= 0; k < 16; k+= width) {
+            const Vec v= Ops::load(x + i + k);
+            mi         = Ops::min(v, mi);
+            ma         = Ops::max(v, ma);
+            nan        = Ops::bitOr(nan, Ops::isNan(v));
+        }
+    }
+    alignas(32) std::array<T, width> lo;
+    alignas(32) std::array<T, width> hi;
+    std::memcpy(lo.data(), &mi, sizeof(Vec));
+    std::memcpy(hi.data(), &ma, sizeof(Vec));
+    f64 total= horizontalSum(_mm256_add_pd(_mm256_add_pd(s[0], s[1]), _mm256_add_pd(s[2], s[3])));
+    T mn     = lo[0];
+    T mx     = hi[0];
+    for(size_t l= 1; l < width; ++l) {
+        mn= detail::minOf(mn, lo[l]);
+        mx= detail::maxOf(mx, hi[l]);
+    }
+    if(Ops::any(nan)) mn= mx= std::numeric_limits<T>::quiet_NaN();
+    for(; i < n; ++i) {
+        total+= static_cast<f64>(x[i]);
+        mn= detail::minOf(mn, x[i]);
+        mx= detail::maxOf(mx, x[i]);
+    }
+    const f64 mean= total / static_cast<f64>(n);
+    return StreamingStats<T>::fromMoments(n, mean, squaredDeviations(x, n, mean), total, mn, mx);
+}
+
+/**
+ * @brief Statistics of a block of 32 bits integers: exact sums and sums of squares in 64 bits.
+ *
+ * The squares of the magnitudes are computed as unsigned 32 x 32 bits products, the sums of
+ * squares saturate.
+ * @tparam T The data type.
+ * @tparam Ops The operations on the registers of the data type.
+ * @param x The values.
+ * @param n The number of values (not 0).
+ * @return The statistics.
+ */
+template<typename T, typename Ops>
+FLN_TARGET("avx2") FLN_FORCE_INLINE StreamingStats<T> integerBlock(const T* x, size_t n) noexcept {
+    __m256i s0= _mm256_setzero_si256();
+    __m256i s1= _mm256_setzero_si256();
+    __m256i q = _mm256_setzero_si256();
+    __m256i mi= _mm256_set1_epi32(static_cast<s32>(x[0]));
+    __m256i ma= mi;
+    size_t i  = 0;
+    for(; i + 8 <= n; i+= 8) {
+        const __m256i v= _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + i));
+        s0             = _mm256_add_epi64(s0, Ops::widen(_mm256_castsi256_si128(v)));
+        s1             = _mm256_add_epi64(s1, Ops::widen(_mm256_extracti128_si256(v, 1)));
+        const __m256i m= Ops::magnitude(v);
+        const __m256i h= _mm256_srli_epi64(m, 32);
+        q              = addSaturated(addSaturated(q, _mm256_mul_epu32(m, m)), _mm256_mul_epu32(h, h));
+        mi             = Ops::min(mi, v);
+        ma             = Ops::max(ma, v);
+    }
+    alignas(32) std::array<sumType<T>, 4> sums;
+    alignas(32) std::array<u64, 4> sq;
+    alignas(32) std::array<T, 8> lo;
+    alignas(32) std::array<T, 8> hi;
+    _mm256_store_si256(reinterpret_cast<__m256i*>(sums.data()), _mm256_add_epi64(s0, s1));
+    _mm256_store_si256(reinterpret_cast<__m256i*>(sq.data()), q);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lo.data()), mi);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(hi.data()), ma);
+    sumType<T> total= sums[0] + sums[1] + sums[2] + sums[3];
+    u64 squares     = detail::addSaturated(detail::addSaturated(sq[0], sq[1]), detail::addSaturated(sq[2], sq[3]));
+    T mn            = *std::min_element(lo.begin(), lo.end());
+    T mx            = *std::max_element(hi.begin(), hi.end());
+    for(; i < n; ++i) {
+        total+= x[i];
+        squares= detail::addSaturated(squares, detail::squareOf(x[i]));
+        mn= std::min(mn, x[i]);
+        mx= std::max(mx, x[i]);
+    }
+    const f64 mean= static_cast<f64>(total) / static_cast<f64>(n);
+    return StreamingStats<T>::fromMoments(n, mean, squaredDeviations(x, n, mean), total, mn, mx, squares);
+}
+
+FLN_TARGET("avx2") StreamingStats<f32> blockAvx2(const f32* x, size_t n) noexcept { return floatBlock<f32, F32Ops>(x, n); }
+FLN_TARGET("avx2") StreamingStats<f64> blockAvx2(const f64* x, size_t n) noexcept { return floatBlock<f64, F64Ops>(x, n); }
+FLN_TARGET("avx2") StreamingStats<s32> blockAvx2(const s32* x, size_t n) noexcept { return integerBlock<s32, S32Ops>(x, n); }
+FLN_TARGET("avx2") StreamingStats<u32> blockAvx2(const u32* x, size_t n) noexcept { return integerBlock<u32, U32Ops>(x, n); }
+#endif
+
+/**
+ * @brief Statistics of an array by blocks with the best instruction set.
+ * @tparam T The data type.
+ * @param data The values.
+ * @return The statistics.
+ */
+template<typename T>
+StreamingStats<T> summarizeBlocks(std::span<const T> data) noexcept {
+    const bool avx2= bithack::simd::useAvx2();
+    StreamingStats<T> res;
+    for(size_t start= 0; start < data.size(); start+= blockSize) {
+        const size_t n= std::min(blockSize, data.size() - start);
+#ifdef FLN_SIMD_X86
+        if(avx2) {
+            res.merge(blockAvx2(data.data() + start, n));
+            continue;
+        }
+#endif
+        res.merge(blockScalar(data.data() + start, n));
+    }
+    return res;
+}
+
+/// number of values below which the pairwise summation stops splitting
+constexpr size_t pairwiseBase= 512;
+/// number of partial sums of the summation kernels
+constexpr size_t sumLanes= 32;
+
+/**
+ * @brief Running sums in the type A.
+ * @tparam A The type of the partial sums.
+ * @tparam T The data type.
+ * @param x The values.
+ * @param n The number of values.
+ * @return The sum.
+ */
+template<typename A, typename T>
+FLN_FORCE_INLINE A naiveSum(const T* x, size_t n) noexcept {
+    std::array<A, sumLanes> s{};
+    const size_t full= n - n % sumLanes;
+    for(size_t i= 0; i < full; i+= sumLanes) {
+        for(size_t l= 0; l < sumLanes; ++l) s[l]+= static_cast<A>(x[i + l]);
+    }
+    for(size_t i= full; i < n; ++i) s[0]+= static_cast<A>(x[i]);
+    // tree of the partial sums
+    for(size_t w= sumLanes / 2; w > 0; w/= 2) {
+        for(size_t l= 0; l < w; ++l) s[l]+= s[l + w];
+    }
+    return s[0];
+}
+
+/**
+ * @brief Add a value to a compensated sum (Neumaier).
+ * @tparam T The float type.
+ * @param s The sum.
+ * @param c The compensation.
+ * @param x The value.
+ */
+template<typename T>
+FLN_FORCE_INLINE void neumaierAdd(T& s, T& c, T x) noexcept {
+    const T t= s + x;
+    c+= std::abs(s) >= std::abs(x) ? (s - t) + x : (x - t) + s;
+    s= t;
+}
+
+/**
+ * @brief Compensated running sums (Kahan).
+ * @tparam T The float type.
+ * @param x The values.
+ * @param n The number of values.
+ * @return The sum.
+ */
+template<typename T>
+FLN_FORCE_INLINE T kahanSum(const T* x, size_t n) noexcept {
+    std::array<T, sumLanes> s{};
+    std::array<T, sumLanes> c{};
+    const size_t full= n - n % sumLanes;
+    for(size_t i= 0; i < full; i+= sumLanes) {
+        for(size_t l= 0; l < sumLanes; ++l) {
+            const T y= x[i + l] - c[l];
+            const T t= s[l] + y;
+            c[l]     = (t - s[l]) - y;
+            s[l]     = t;
+        }
+    }
+    // the partial sums and the tail are combined with the exact corrections
+    T sum= 0;
+    T cor= 0;
+    for(size_t l= 0; l < sumLanes; ++l) {
+        neumaierAdd(sum, cor, s[l]);
+        cor-= c[l];
+    }
+    for(size_t i= full; i < n; ++i) neumaierAdd(sum, cor, x[i]);
+    return sum + cor;
+}
+
+/**
+ * @brief Compensated running sums (Neumaier).
+ *
+ * The lanes get the exact error of each addition with Knuth's branch free two sum, the
+ * same correction as the comparison of the magnitudes of Neumaier.
+ * @tparam T The float type.
+ * @param x The values.
+ * @param n The number of values.
+ * @return The sum.
+ */
+template<typename T>
+FLN_FORCE_INLINE T neumaierSum(const T* x, size_t n) noexcept {
+    std::array<T, sumLanes> s{};
+    std::array<T, sumLanes> c{};
+    const size_t full= n - n % sumLanes;
+    for(size_t i= 0; i < full; i+= sumLanes) {
+        for(size_t l= 0; l < sumLanes; ++l) {
+            // exact rounding error of the addition (Knuth two sum)
+            const T t  = s[l] + x[i + l];
+            const T bp = t - s[l];
+            c[l]+= (s[l] - (t - bp)) + (x[i + l] - bp);
+            s[l]= t;
+        }
+    }
+    T sum= 0;
+    T cor= 0;
+    for(size_t l= 0; l < sumLanes; ++l) {
+        neumaierAdd(sum, cor, s[l]);
+        cor+= c[l];
+    }
+    for(size_t i= full; i < n; ++i) neumaierAdd(sum, cor, x[i]);
+    return sum + cor;
+}
+
+/**
+ * @brief Pairwise summation of blocks, without recursion.
+ *
+ * The sums of the blocks are merged like a binary counter: block k merges as many
+ * times as k has trailing ones, which gives the balanced tree of the recursive halves.
+ *
+ * @tparam T The float type.
+ * @param x The values.
+ * @param n The number of values.
+ * @return The sum.
+ */
+template<typename T>
+FLN_FORCE_INLINE T pairwiseSum(const T* x, size_t n) noexcept {
+    std::array<T, 64> pending{};
+    size_t depth= 0;
+    size_t block= 0;
+    for(size_t i= 0; i < n; i+= pairwiseBase, ++block) {
+        T v= naiveSum<T>(x + i, std::min(pairwiseBase, n - i));
+        for(size_t k= block; (k & 1U) != 0; k>>= 1U) v= pending[--depth] + v;
+        pending[depth++]= v;
+    }
+    T sum= 0;
+    while(depth > 0) sum= pending[--depth] + sum;
+    return sum;
+}
+
+/**
+ * @brief Sum with an algorithm.
+ * @tparam T The float type.
+ * @param x The values.
+ * @param n The number of values.
+ * @param summation The algorithm.
+ * @return The sum.
+ */
+template<typename T>
+FLN_FORCE_INLINE T sumKernel(const T* x, size_t n, Summation summation) noexcept {
+    switch(summation) {
+    case Summation::Naive:
+        return naiveSum<T>(x, n);
+    case Summation::Kahan:
+        return kahanSum(x, n);
+    case Summation::Neumaier:
+        return neumaierSum(x, n);
+    case Summation::Pairwise:
+        return pairwiseSum(x, n);
+    case Summation::Wide:
+        break;
+    }
+    return static_cast<T>(naiveSum<f64>(x, n));
+}
+
+f32 sumScalar(const f32* x, size_t n, Summation summation) noexcept { return sumKernel(x, n, summation); }
+f64 sumScalar(const f64* x, size_t n, Summation summation) noexcept { return sumKernel(x, n, summation); }
+
+#ifdef FLN_SIMD_X86
+/**
+ * @brief Compensated sums in AVX2 registers, four independent chains.
+ * @tparam Neumaier Neumaier correction if true, Kahan otherwise.
+ * @tparam T The float type.
+ * @tparam Ops The operations on the registers of the data type.
+ * @param x The values.
+ * @param n The number of values.
+ * @return The sum.
+ */
+template<bool Neumaier, typename T, typename Ops>
+FLN_TARGET("avx2") FLN_FORCE_INLINE T compensatedAvx2(const T* x, size_t n) noexcept {
+    using Vec              = typename Ops::Vec;
+    constexpr size_t chains= 4;
+    constexpr size_t stride= chains * Ops::width;
+    Vec s[chains];
+    Vec c[chains];
+    for(size_t k= 0; k < chains; ++k) s[k]= c[k]= Ops::zero();
+    const size_t full= n - n % stride;
+    for(size_t i= 0; i < full; i+= stride) {
+        for(size_t k= 0; k < chains; ++k) {
+            const Vec v= Ops::load(x + i + k * Ops::width);
+            if constexpr(Neumaier) {
+                const Vec t = Ops::add(s[k], v);
+                const Vec bp= Ops::sub(t, s[k]);
+                c[k]        = Ops::add(c[k], Ops::add(Ops::sub(s[k], Ops::sub(t, bp)), Ops::sub(v, bp)));
+                s[k]= t;
+            } else {
+                const Vec y= Ops::sub(v, c[k]);
+                const Vec t= Ops::add(s[k], y);
+                c[k]       = Ops::sub(Ops::sub(t, s[k]), y);
+                s[k]       = t;
+            }
+        }
+    }
+    alignas(32) T sums[stride];
+    alignas(32) T cors[stride];
+    for(size_t k= 0; k < chains; ++k) {
+        Ops::store(sums + k * Ops::width, s[k]);
+        Ops::store(cors + k * Ops::width, c[k]);
+    }
+    T sum= 0;
+    T cor= 0;
+    for(size_t l= 0; l < stride; ++l) {
+        neumaierAdd(sum, cor, sums[l]);
+        cor+= Neumaier ? cors[l] : -cors[l];
+    }
+    for(size_t i= full; i < n; ++i) neumaierAdd(sum, cor, x[i]);
+    return sum + cor;
+}
+
+/**
+ * @brief Sum with an algorithm, AVX2 registers for the compensated ones.
+ * @tparam T The float type.
+ * @tparam Ops The operations on the registers of the data type.
+ * @param x The values.
+ * @param n The number of values.
+ * @param summation The algorithm.
+ * @return The sum.
+ */
+template<typename T, typename Ops>
+FLN_TARGET("avx2") FLN_FORCE_INLINE T sumAvx2(const T* x, size_t n, Summation summation) noexcept {
+    if(summation == Summation::Kahan) return compensatedAvx2<false, T, Ops>(x, n);
+    if(summation == Summation::Neumaier) return compensatedAvx2<true, T, Ops>(x, n);
+    return sumKernel(x, n, summation);
+}
+
+FLN_TARGET("avx2") f32 sumAvx2(const f32* x, size_t n, Summation summation) noexcept { return sumAvx2<f32, F32Ops>(x, n, summation); }
+FLN_TARGET("avx2") f64 sumAvx2(const f64* x, size_t n, Summation summation) noexcept { return sumAvx2<f64, F64Ops>(x, n, summation); }
+#endif
+
+/**
+ * @brief Sum with the best instruction set.
+ * @tparam T The float type.
+ * @param data The values.
+ * @param summation The algorithm.
+ * @return The sum.
+ */
+template<typename T>
+T sumDispatch(std::span<const T> data, Summation summation) noexcept {
+#ifdef FLN_SIMD_X86
+    if(bithack::simd::useAvx2()) return sumAvx2(data.data(), data.size(), summation);
+#endif
+    return sumScalar(data.data(), data.size(), summation);
+}
+
+}// namespace
+
+StreamingStats<f32> detail::summarize(std::span<const f32> data) noexcept { return summarizeBlocks(data); }
+StreamingStats<f64> detail::summarize(std::span<const f64> data) noexcept { return summarizeBlocks(data); }
+StreamingStats<s32> detail::summarize(std::span<const s32> data) noexcept { return summarizeBlocks(data); }
+StreamingStats<u32> detail::summarize(std::span<const u32> data) noexcept { return summarizeBlocks(data); }
+
+f32 detail::sum(std::span<const f32> data, Summation summation) noexcept { return sumDispatch(data, summation); }
+f64 detail::sum(std::span<const f64> data, Summation summation) noexcept { return sumDispatch(data, summation); }
+
+void detail::parallelFor(size_t count, u32 threads, const std::function<void(size_t)>& task) {
+    const u32 wanted = threads > 0 ? threads : std::max(1U, std::thread::hardware_concurrency());
+    const u32 workers= static_cast<u32>(std::min<size_t>(wanted, count));
+    std::atomic<size_t> next= 0;
+    const auto worker       = [&]() {
+        for(size_t i= next++; i < count; i= next++) task(i);
+    };
+    // joined on destruction, also when starting a thread fails
+    std::vector<std::jthread> pool;
+    pool.reserve(workers);
+    try {
+        for(u32 t= 1; t < workers; ++t) pool.emplace_back(worker);
+    } catch(const std::system_error&) {
+        // no more threads available: the started ones and this one do all the tasks
+    }
+    worker();
+}
+
 }// namespace fln::stats
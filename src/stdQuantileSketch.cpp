@@ -0,0 +1,295 @@
+/**
+ * \file stdQuantileSketch.cpp
+ *
+ * \date 17/10/2026
+ * \author Silmaen
+ */
+#include "stdQuantileSketch.h"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <numbers>
+#include <stdexcept>
+
+namespace fln::stats {
+
+namespace {
+
+/// number of pending values per unit of compression
+constexpr size_t bufferFactor= 8;
+/// smallest compression
+constexpr f64 minCompression= 10;
+/// largest compression: the buffer of pending values stays below 8 MB
+constexpr f64 maxCompression= 100000;
+/// tag of the binary images: "FLQS"
+constexpr u32 magic= 0x53514C46;
+/// version of the binary images
+constexpr u32 version= 1;
+
+/**
+ * @brief Largest quantile that a centroid starting at q0 may reach (arcsine scale function).
+ *
+ * The scale k(q) = compression/(2π) asin(2q-1) grows by at most 1 over a centroid.
+ *
+ * @param q0 The quantile of the left edge of the centroid.
+ * @param compression The accuracy parameter.
+ * @return The quantile of the right edge.
+ */
+f64 quantileLimit(f64 q0, f64 compression) noexcept {
+    const f64 k= std::asin(2.0 * q0 - 1.0) + 2.0 * std::numbers::pi / compression;
+    if(k >= 0.5 * std::numbers::pi) return 1.0;
+    return 0.5 * (std::sin(k) + 1.0);
+}
+
+/// bit of the sign of a double
+constexpr u64 signBit= 0x8000000000000000ULL;
+
+/**
+ * @brief Sort doubles with a radix sort of their bits, in the order of the values.
+ *
+ * The bits are flipped to sort as unsigned integers (all of them for the negative values,
+ * the sign for the others), the bytes where all the values are equal are skipped.
+ *
+ * @param values The values.
+ * @param keys The buffer of the keys, twice the number of values.
+ */
+void radixSort(std::vector<f64>& values, std::vector<u64>& keys) {
+    const size_t n= values.size();
+    keys.resize(2 * n);
+    u64* src= keys.data();
+    u64* dst= keys.data() + n;
+    std::array<std::array<u32, 256>, 8> counts{};
+    for(size_t i= 0; i < n; ++i) {
+        const u64 b= std::bit_cast<u64>(values[i]);
+        const u64 k= (b & signBit) != 0 ? ~b : b | signBit;
+        src[i]     = k;
+        for(size_t d= 0; d < 8; ++d) ++counts[d][(k >> (8 * d)) & 0xFFU];
+    }
+    for(size_t d= 0; d < 8; ++d) {
+        auto& count= counts[d];
+        if(count[(src[0] >> (8 * d)) & 0xFFU] == n) continue;
+        u32 offset= 0;
+        for(u32& c: count) {
+            const u32 size= c;
+            c             = offset;
+            offset+= size;
+        }
+        for(size_t i= 0; i < n; ++i) dst[count[(src[i] >> (8 * d)) & 0xFFU]++]= src[i];
+        std::swap(src, dst);
+    }
+    for(size_t i= 0; i < n; ++i) values[i]= std::bit_cast<f64>((src[i] & signBit) != 0 ? src[i] & ~signBit : ~src[i]);
+}
+
+/**
+ * @brief Linear interpolation between two points.
+ * @param x0 The abscissa of the first point.
+ * @param y0 The ordinate of the first point.
+ * @param x1 The abscissa of the second point.
+ * @param y1 The ordinate of the second point.
+ * @param x The abscissa.
+ * @return The ordinate at x (y1 if the points have the same abscissa).
+ */
+f64 interpolate(f64 x0, f64 y0, f64 x1, f64 y1, f64 x) noexcept {
+    if(x1 <= x0) return y1;
+    return y0 + (y1 - y0) * (x - x0) / (x1 - x0);
+}
+
+/**
+ * @brief Write a value at the end of a binary image.
+ * @tparam T The type of the value.
+ * @param out The image.
+ * @param v The value.
+ */
+template<class T>
+void write(std::vector<u8>& out, const T& v) {
+    const size_t at= out.size();
+    out.resize(at + sizeof(T));
+    std::memcpy(out.data() + at, &v, sizeof(T));
+}
+
+/**
+ * @brief Read a value of a binary image.
+ * @tparam T The type of the value.
+ * @param in The image, the value is removed from its front.
+ * @return The value.
+ */
+template<class T>
+T read(std::span<const u8>& in) {
+    if(in.size() < sizeof(T)) throw std::invalid_argument("QuantileSketch: truncated image");
+    T v;
+    std::memcpy(&v, in.data(), sizeof(T));
+    in= in.subspan(sizeof(T));
+    return v;
+}
+
+}// namespace
+
+QuantileSketch::QuantileSketch(f64 compression):
+    m_compression{compression >= minCompression ? std::min(compression, maxCompression) : minCompression}, m_bufferSize{static_cast<size_t>(m_compression) * bufferFactor} {
+    m_pending.reserve(m_bufferSize);
+}
+
+void QuantileSketch::flush() const {
+    if(m_pending.empty()) return;
+    radixSort(m_pending, m_keys);
+    if(m_count == 0) {
+        m_min= m_pending.front();
+        m_max= m_pending.back();
+    } else {
+        m_min= std::min(m_min, m_pending.front());
+        m_max= std::max(m_max, m_pending.back());
+    }
+    m_count+= m_pending.size();
+    // merge of the sorted values and the centroids
+    m_scratch.clear();
+    m_scratch.reserve(m_centroids.size() + m_pending.size());
+    auto c= m_centroids.begin();
+    for(const f64 v: m_pending) {
+        for(; c != m_centroids.end() && c->mean < v; ++c) m_scratch.push_back(*c);
+        m_scratch.push_back({v, 1.0});
+    }
+    m_scratch.insert(m_scratch.end(), c, m_centroids.end());
+    m_pending.clear();
+    compress(m_scratch);
+}
+
+void QuantileSketch::compress(const std::vector<Centroid>& sorted) const {
+    m_centroids.clear();
+    if(sorted.empty()) return;
+    const f64 total= static_cast<f64>(m_count);
+    f64 done       = 0;// weight of the closed centroids
+    f64 limit      = total * quantileLimit(0, m_compression);
+    f64 sum        = sorted.front().mean * sorted.front().weight;// weighted sum of the open centroid
+    f64 weight     = sorted.front().weight;
+    for(size_t i= 1; i < sorted.size(); ++i) {
+        const Centroid& next= sorted[i];
+        if(done + weight + next.weight <= limit) {
+            sum+= next.mean * next.weight;
+            weight+= next.weight;
+        } else {
+            m_centroids.push_back({sum / weight, weight});
+            done+= weight;
+            limit = total * quantileLimit(done / total, m_compression);
+            sum   = next.mean * next.weight;
+            weight= next.weight;
+        }
+    }
+    m_centroids.push_back({sum / weight, weight});
+}
+
+void QuantileSketch::merge(const QuantileSketch& other) {
+    other.flush();
+    if(other.m_count == 0) return;
+    flush();
+    if(m_count == 0) {
+        m_min= other.m_min;
+        m_max= other.m_max;
+    } else {
+        m_min= std::min(m_min, other.m_min);
+        m_max= std::max(m_max, other.m_max);
+    }
+    m_count+= other.m_count;
+    m_scratch.resize(m_centroids.size() + other.m_centroids.size());
+    std::merge(m_centroids.begin(), m_centroids.end(), other.m_centroids.begin(), other.m_centroids.end(), m_scratch.begin(),
+               [](const Centroid& a, const Centroid& b) { return a.mean < b.mean; });
+    compress(m_scratch);
+}
+
+f64 QuantileSketch::quantile(f64 q) const {
+    flush();
+    if(m_count == 0) return 0;
+    const f64 n   = static_cast<f64>(m_count);
+    const f64 rank= std::clamp(q * n, 0.5, n - 0.5);
+    f64 prevRank  = 0.5;
+    f64 prevValue = m_min;
+    f64 done      = 0;
+    for(const Centroid& c: m_centroids) {
+        const f64 center= done + 0.5 * c.weight;
+        if(rank <= center) return interpolate(prevRank, prevValue, center, c.mean, rank);
+        prevRank = center;
+        prevValue= c.mean;
+        done+= c.weight;
+    }
+    return interpolate(prevRank, prevValue, n - 0.5, m_max, rank);
+}
+
+f64 QuantileSketch::cdf(f64 x) const {
+    flush();
+    if(m_count == 0 || x < m_min) return 0;
+    if(x >= m_max) return 1;
+    const f64 n  = static_cast<f64>(m_count);
+    f64 prevRank = 0.5;
+    f64 prevValue= m_min;
+    f64 done     = 0;
+    for(const Centroid& c: m_centroids) {
+        const f64 center= done + 0.5 * c.weight;
+        if(x < c.mean) return interpolate(prevValue, prevRank, c.mean, center, x) / n;
+        prevRank = center;
+        prevValue= c.mean;
+        done+= c.weight;
+    }
+    return interpolate(prevValue, prevRank, m_max, n - 0.5, x) / n;
+}
+
+f64 QuantileSketch::min() const {
+    flush();
+    return m_min;
+}
+
+f64 QuantileSketch::max() const {
+    flush();
+    return m_max;
+}
+
+const std::vector<QuantileSketch::Centroid>& QuantileSketch::centroids() const {
+    flush();
+    return m_centroids;
+}
+
+std::vector<u8> QuantileSketch::serialize() const {
+    flush();
+    std::vector<u8> out;
+    out.reserve(48 + m_centroids.size() * sizeof(Centroid));
+    write(out, magic);
+    write(out, version);
+    write(out, m_compression);
+    write(out, m_count);
+    write(out, m_min);
+    write(out, m_max);
+    write(out, static_cast<u64>(m_centroids.size()));
+    for(const Centroid& c: m_centroids) {
+        write(out, c.mean);
+        write(out, c.weight);
+    }
+    return out;
+}
+
+QuantileSketch QuantileSketch::deserialize(std::span<const u8> bytes) {
+    if(read<u32>(bytes) != magic) throw std::invalid_argument("QuantileSketch: not a sketch image");
+    if(read<u32>(bytes) != version) throw std::invalid_argument("QuantileSketch: unknown image version");
+    const f64 compression= read<f64>(bytes);
+    // also false for NaN
+    if(!(compression >= minCompression && compression <= maxCompression)) throw std::invalid_argument("QuantileSketch: wrong compression");
+    QuantileSketch res(compression);
+    res.m_count   = read<u64>(bytes);
+    res.m_min     = read<f64>(bytes);
+    res.m_max     = read<f64>(bytes);
+    if(!std::isfinite(res.m_min) || !std::isfinite(res.m_max) || res.m_min > res.m_max) throw std::invalid_argument("QuantileSketch: wrong min or max");
+    const u64 size= read<u64>(bytes);
+    // compare before the multiplication, that may wrap
+    if(size > bytes.size() / (2 * sizeof(f64)) || bytes.size() != size * 2 * sizeof(f64)) throw std::invalid_argument("QuantileSketch: wrong image size");
+    res.m_centroids.resize(size);
+    f64 weights= 0;
+    for(Centroid& c: res.m_centroids) {
+        c.mean  = read<f64>(bytes);
+        c.weight= read<f64>(bytes);
+        if(!(c.weight > 0)) throw std::invalid_argument("QuantileSketch: wrong centroid weight");
+        if(!std::isfinite(c.mean)) throw std::invalid_argument("QuantileSketch: wrong centroid mean");
+        weights+= c.weight;
+    }
+    if(weights != static_cast<f64>(res.m_count)) throw std::invalid_argument("QuantileSketch: weights do not match the count");
+    return res;
+}
+
+}// namespace fln::stats
@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+
+#define IDEBUG
+#include "accuracy.h"
+#include "bithack_Functions.h"
+
+using namespace fln::accuracy;
+
+TEST(accuracy, ulp) {
+    EXPECT_EQ(ulpSize(1.0f), std::ldexp(1.0L, -23));
+    EXPECT_EQ(ulpSize(-3.0f), std::ldexp(1.0L, -22));
+    EXPECT_EQ(ulpSize(0.0f), std::ldexp(1.0L, -149));
+    EXPECT_EQ(ulpError(1.0f, 1.0L), 0.0L);
+    EXPECT_EQ(ulpError(std::nextafter(1.0f, 2.0f), 1.0L), 1.0L);
+    EXPECT_EQ(ulpError(1.0f, 1.0L + std::ldexp(1.0L, -25)), 0.25L);
+}
+
+TEST(accuracy, histogram) {
+    EXPECT_EQ(histogramBin(0.0L), 0U);
+    EXPECT_EQ(histogramBin(0.5L), 0U);
+    EXPECT_EQ(histogramBin(0.75L), 1U);
+    EXPECT_EQ(histogramBin(1.0L), 1U);
+    EXPECT_EQ(histogramBin(1.5L), 2U);
+    EXPECT_EQ(histogramBin(2.0L), 2U);
+    EXPECT_EQ(histogramBin(3.0L), 3U);
+    EXPECT_EQ(histogramBin(1e30L), histogramBins - 1);
+    for(size_t bin= 1; bin + 1 < histogramBins; ++bin) {
+        EXPECT_EQ(histogramBin(histogramBound(bin)), bin);
+        EXPECT_EQ(histogramBin(histogramBound(bin) * 1.01L), bin + 1);
+    }
+}
+
+TEST(accuracy, stats) {
+    ErrorStats a, b;
+    a.add(1, 1.0f, 1.0L, 2);
+    a.add(2, 2.0f, 2.0L + std::ldexp(1.0L, -21), 2);// 2 ulp
+    b.add(3, 4.0f, 4.0L + std::ldexp(1.0L, -19), 2);// 4 ulp
+    b.add(4, std::numeric_limits<fln::f32>::infinity(), 4.0L, 2);
+    a.merge(b, 2);
+    EXPECT_EQ(a.tested, 4U);
+    EXPECT_EQ(a.failures, 1U);
+    ASSERT_EQ(a.worst.size(), 2U);
+    EXPECT_EQ(a.worst[0].input, 4U);
+    EXPECT_EQ(a.worst[1].input, 3U);
+    EXPECT_EQ(a.histogram[0], 1U);
+    EXPECT_EQ(a.histogram[2], 1U);
+    EXPECT_EQ(a.histogram[3], 1U);
+    EXPECT_EQ(a.histogram[histogramBins - 1], 1U);
+}
+
+TEST(accuracy, sweep) {
+    const auto& all= functions();
+    ASSERT_FALSE(all.empty());
+    const auto find= [&](const std::string& name) {
+        return *std::find_if(all.begin(), all.end(), [&](const Function& f) { return f.name == name; });
+    };
+    SweepOptions options;
+    options.first  = 0x3F800000;// [1, 4)
+    options.last   = 0x407FFFFF;
+    options.stride = 97;
+    options.threads= 3;
+    options.worst  = 3;
+    // abs is exact
+    const auto abs= sweep(find("bithack::abs"), options);
+    EXPECT_EQ(abs.tested, (options.last - options.first) / options.stride + 1);
+    EXPECT_EQ(abs.maxUlp, 0.0L);
+    EXPECT_EQ(abs.histogram[0], abs.tested);
+    // the refinement steps decrease the error
+    const auto r1= sweep(find("bithack::rsqrt_quake"), options);
+    const auto r3= sweep(find("bithack::rsqrt<3>"), options);
+    EXPECT_LT(r3.maxRel, r1.maxRel);
+    EXPECT_LT(r1.maxRel, 2e-3L);
+    ASSERT_EQ(r1.worst.size(), 3U);
+    EXPECT_EQ(r1.worst[0].ulp, r1.maxUlp);
+    EXPECT_GE(r1.worst[0].ulp, r1.worst[1].ulp);
+    // the same, whatever the number of threads
+    options.threads= 1;
+    const auto r1s= sweep(find("bithack::rsqrt_quake"), options);
+    EXPECT_EQ(r1s.tested, r1.tested);
+    EXPECT_EQ(r1s.maxUlp, r1.maxUlp);
+    EXPECT_EQ(r1s.histogram, r1.histogram);
+    // negative inputs are out of the sqrt domain
+    options.first= 0xBF800000;
+    options.last = 0xBF8FFFFF;
+    const auto sq= sweep(find("bithack::sqrt"), options);
+    EXPECT_EQ(sq.tested, 0U);
+    EXPECT_GT(sq.skipped, 0U);
+}
@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+
+#define IDEBUG
+#include "report.h"
+
+TEST(benchmark, percentile) {
+    std::vector<fln::f64> a{1.0, 2.0, 3.0, 4.0, 5.0};
+    EXPECT_DOUBLE_EQ(fln::bench::percentile(a, 0.0), 1.0);
+    EXPECT_DOUBLE_EQ(fln::bench::percentile(a, 0.5), 3.0);
+    EXPECT_DOUBLE_EQ(fln::bench::percentile(a, 1.0), 5.0);
+    EXPECT_DOUBLE_EQ(fln::bench::percentile(a, 0.125), 1.5);
+    EXPECT_DOUBLE_EQ(fln::bench::percentile({}, 0.5), 0.0);
+}
+
+TEST(benchmark, summarize) {
+    std::vector<fln::f64> a{10.0, 11.0, 9.0, 10.0, 10.5, 9.5, 10.0, 250.0};
+    auto res= fln::bench::summarize(a, 3.5);
+    EXPECT_EQ(res.rejected, 1U);
+    EXPECT_EQ(res.samples, 7U);
+    EXPECT_DOUBLE_EQ(res.median, 10.0);
+    EXPECT_DOUBLE_EQ(res.min, 9.0);
+    EXPECT_DOUBLE_EQ(res.max, 11.0);
+    EXPECT_DOUBLE_EQ(res.mean, 10.0);
+    EXPECT_NEAR(res.mad, 1.4826 * 0.5, 1e-12);
+    // all the same: nothing rejected
+    res= fln::bench::summarize({5.0, 5.0, 5.0}, 3.5);
+    EXPECT_EQ(res.rejected, 0U);
+    EXPECT_DOUBLE_EQ(res.median, 5.0);
+    EXPECT_DOUBLE_EQ(res.stdDeviation, 0.0);
+}
+
+TEST(benchmark, runner) {
+    fln::bench::Options options;
+    options.samples      = 5;
+    options.minSampleTime= 0.05;
+    options.warmupTime   = 0.1;
+    options.verbose      = false;
+    options.filter       = "keep";
+    fln::bench::Runner runner(options);
+    runner.setGroup("group");
+    std::vector<fln::f32> in(16, 2.0f);
+    runner.measure("keep", in, [](fln::f32 x) { return x * 1.5f; });
+    runner.throughput("skip", in, [](fln::f32 x) { return x * 1.5f; });
+    ASSERT_EQ(runner.results().size(), 2U);
+    EXPECT_EQ(runner.results()[0].name, "group/keep");
+    EXPECT_EQ(runner.results()[0].mode, fln::bench::Mode::Latency);
+    EXPECT_EQ(runner.results()[1].mode, fln::bench::Mode::Throughput);
+    for(const auto& result: runner.results()) {
+        EXPECT_GE(result.iterations, 1U);
+        EXPECT_GT(result.time.median, 0.0);
+        EXPECT_EQ(result.time.samples + result.time.rejected, 5U);
+    }
+    // the chaining keeps the input value
+    fln::u64 zero= 0;
+    EXPECT_EQ(fln::bench::detail::chain(3.5f, 12.0f, zero), 3.5f);
+    EXPECT_EQ(fln::bench::detail::chain(3.5, 12.0f, zero), 3.5);
+}
+
+static fln::bench::Report sampleReport() {
+    fln::bench::Report report{fln::bench::hostContext(), {}};
+    fln::bench::Result a;
+    a.name       = "group/fln::bithack::log2, \"quoted\"";
+    a.mode       = fln::bench::Mode::Throughput;
+    a.type       = "f32";
+    a.iterations = 1000;
+    a.time.median= 1.25;
+    a.time.mad   = 0.01;
+    a.time.p99   = 1.5;
+    a.cycles     = 3.5;
+    a.counters.valid[static_cast<size_t>(fln::bench::Event::Instructions)] = true;
+    a.counters.values[static_cast<size_t>(fln::bench::Event::Instructions)]= 12.5;
+    fln::bench::Result b= a;
+    b.name              = "group/std::log2";
+    b.mode              = fln::bench::Mode::Batch;
+    b.itemsPerIteration = 4096;
+    b.time.median       = 0.5;
+    report.results      = {a, b};
+    return report;
+}
+
+TEST(benchmark, report_roundtrip) {
+    const auto report= sampleReport();
+    EXPECT_FALSE(report.context.cpu.empty());
+    EXPECT_FALSE(report.context.compiler.empty());
+    EXPECT_EQ(report.context.config, configName);
+    for(int format= 0; format < 2; ++format) {
+        std::stringstream stream;
+        if(format == 0) fln::bench::writeJson(stream, report);
+        else fln::bench::writeCsv(stream, report);
+        const auto read= fln::bench::readReport(stream);
+        EXPECT_EQ(read.context.cpu, report.context.cpu);
+        EXPECT_EQ(read.context.compiler, report.context.compiler);
+        EXPECT_EQ(read.context.date, report.context.date);
+        ASSERT_EQ(read.results.size(), 2U);
+        for(size_t i= 0; i < 2; ++i) {
+            EXPECT_EQ(read.results[i].name, report.results[i].name);
+            EXPECT_EQ(read.results[i].mode, report.results[i].mode);
+            EXPECT_EQ(read.results[i].type, report.results[i].type);
+            EXPECT_EQ(read.results[i].iterations, report.results[i].iterations);
+            EXPECT_EQ(read.results[i].itemsPerIteration, report.results[i].itemsPerIteration);
+            EXPECT_DOUBLE_EQ(read.results[i].time.median, report.results[i].time.median);
+            EXPECT_DOUBLE_EQ(read.results[i].time.p99, report.results[i].time.p99);
+            EXPECT_DOUBLE_EQ(read.results[i].cycles, report.results[i].cycles);
+            EXPECT_EQ(read.results[i].counters.valid, report.results[i].counters.valid);
+            EXPECT_EQ(read.results[i].counters.values, report.results[i].counters.values);
+        }
+    }
+    std::stringstream bad("{\"results\": [{\"name\": \"x\"");
+    EXPECT_THROW((void)fln::bench::readReport(bad), std::runtime_error);
+}
+
+TEST(benchmark, compare) {
+    const auto baseline= sampleReport().results;
+    auto current       = baseline;
+    current[0].time.median= 1.5; // +20%, well above the noise
+    current[1].name       = "group/other";
+    const auto comparisons= fln::bench::compare(baseline, current, 0.05, 3.0);
+    ASSERT_EQ(comparisons.size(), 3U);
+    EXPECT_EQ(comparisons[0].verdict, fln::bench::Verdict::Regression);
+    EXPECT_NEAR(comparisons[0].change, 0.2, 1e-12);
+    EXPECT_EQ(comparisons[1].verdict, fln::bench::Verdict::Missing);
+    EXPECT_EQ(comparisons[2].verdict, fln::bench::Verdict::New);
+    // large change but inside the noise
+    current[0].time.mad= 1.0;
+    EXPECT_EQ(fln::bench::compare(baseline, current)[0].verdict, fln::bench::Verdict::Same);
+    current[0].time.mad   = 0.0;
+    current[0].time.median= 1.0;
+    EXPECT_EQ(fln::bench::compare(baseline, current)[0].verdict, fln::bench::Verdict::Improvement);
+}
+
+TEST(benchmark, perf_counters) {
+    fln::bench::PerfCounters counters;
+    EXPECT_EQ(counters.available(), counters.error().empty());
+    counters.start();
+    fln::f64 x= 1.0;
+    for(int i= 0; i < 10000; ++i) {
+        x= x * 1.0001 + 0.5;
+        fln::bench::doNotOptimize(x);
+    }
+    const auto values= counters.stop();
+    EXPECT_EQ(values.any(), counters.available());
+    if(values.has(fln::bench::Event::Instructions)) {
+        EXPECT_GT(values[fln::bench::Event::Instructions], 10000.0);
+    }
+#ifdef FLN_VERBOSE_TEST
+    if(!counters.available()) std::cout << "hardware counters not available: " << counters.error() << std::endl;
+    for(size_t e= 0; e < fln::bench::eventCount; ++e)
+        if(values.valid[e]) std::cout << fln::bench::eventName(static_cast<fln::bench::Event>(e)) << " " << values.values[e] << std::endl;
+#endif
+    // the runner still works when counters are requested, available or not
+    fln::bench::Options options;
+    options.samples      = 3;
+    options.minSampleTime= 0.05;
+    options.warmupTime   = 0.0;
+    options.verbose      = false;
+    options.perfCounters = true;
+    fln::bench::Runner runner(options);
+    ASSERT_NE(runner.counters(), nullptr);
+    runner.throughput("mul", std::vector<fln::f64>(8, 2.0), [](fln::f64 v) { return v * 3.0; });
+    ASSERT_EQ(runner.results().size(), 1U);
+    EXPECT_EQ(runner.results()[0].counters.any(), counters.available());
+}
@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#define IDEBUG
+#include "BFloat16Type.h"
+#include "baseDefines.h"
+#include "bithack_SimdFunctions.h"
+#include <bit>
+#include <cmath>
+#include <limits>
+
+using namespace fln::object;
+using fln::f32;
+using fln::f64;
+using fln::u16;
+using fln::u32;
+
+TEST(BitBFloat16, fields) {
+    const BitBFloat16 b(-3.0f);
+    EXPECT_EQ(b.bits(), 0xC040);
+    EXPECT_TRUE(b.sign());
+    EXPECT_EQ(b.exponentRaw(), 128);
+    EXPECT_EQ(b.exponent(), 1);
+    EXPECT_EQ(b.mantissaRaw(), 0x40);
+    EXPECT_EQ(b.getFloat(), -3.0f);
+    EXPECT_TRUE(BitBFloat16(u16(0x0001)).isDenormalized());
+    EXPECT_TRUE(BitBFloat16(u16(0x7F80)).isInfinite());
+    EXPECT_TRUE(BitBFloat16(u16(0x7FC0)).isNaN());
+}
+
+TEST(BitBFloat16, rounding) {
+    EXPECT_EQ(toBFloat16(1.0f), 0x3F80);
+    EXPECT_EQ(toBFloat16(std::bit_cast<f32>(0x3F808000U)), 0x3F80);// tie to even: down
+    EXPECT_EQ(toBFloat16(std::bit_cast<f32>(0x3F818000U)), 0x3F82);// tie to even: up
+    EXPECT_EQ(toBFloat16(std::bit_cast<f32>(0x3F808001U)), 0x3F81);
+    EXPECT_EQ(toBFloat16(std::numeric_limits<f32>::max()), 0x7F80);// overflow to infinity
+    EXPECT_EQ(toBFloat16(std::bit_cast<f32>(0x00008000U)), 0x0000);// denormal tie to even
+    EXPECT_EQ(toBFloat16(std::bit_cast<f32>(0x7F800001U)), 0x7FC0);// NaN stays NaN
+    EXPECT_EQ(toBFloat16(-std::numeric_limits<f32>::infinity()), 0xFF80);
+    // same result as the generic conversion
+    for(u32 i= 0; i < 0xFFFFFFFFU - 7919U; i+= 7919U) {
+        const f32 f= std::bit_cast<f32>(i);
+        if(std::isnan(f)) continue;
+        EXPECT_EQ(toBFloat16(f), packFloat<BFloat16Traits>(f)) << i;
+    }
+    for(u32 i= 0; i < 0x10000; ++i) {
+        EXPECT_EQ(std::bit_cast<u32>(fromBFloat16(u16(i))), std::bit_cast<u32>(unpackFloat<BFloat16Traits>(u16(i))));
+        if(!std::isnan(fromBFloat16(u16(i)))) {
+            EXPECT_EQ(toBFloat16(fromBFloat16(u16(i))), i);
+        }
+    }
+}
+
+TEST(BitBFloat16, batch) {
+    constexpr size_t n= 1003;// not a multiple of the vector size
+    std::vector<f32> in(n), back(n);
+    std::vector<u16> a(n), b(n);
+    for(size_t i= 0; i < n; ++i) in[i]= 10.f * std::sin(static_cast<f32>(i));
+    in[7]= std::numeric_limits<f32>::quiet_NaN();
+    in[8]= std::bit_cast<f32>(0x3F818000U);
+    std::vector<f32> results;
+    for(auto isa: {fln::bithack::simd::Isa::Scalar, fln::bithack::simd::bestIsa()}) {
+        fln::bithack::simd::setActiveIsa(isa);
+        toBFloat16(in, a);
+        for(size_t i= 0; i < n; ++i) {
+            if(i == 7) {
+                EXPECT_TRUE(BitBFloat16(a[i]).isNaN());
+            } else {
+                EXPECT_EQ(a[i], toBFloat16(in[i])) << i;
+            }
+        }
+        a[7]= 0;
+        fromBFloat16(a, back);
+        for(size_t i= 0; i < n; ++i) EXPECT_EQ(back[i], fromBFloat16(a[i]));
+        for(size_t i= 0; i < n; ++i) b[i]= a[n - 1 - i];
+        f64 dot= 0, sum= 0;
+        for(size_t i= 0; i < n; ++i) {
+            dot+= f64(fromBFloat16(a[i])) * f64(fromBFloat16(b[i]));
+            sum+= f64(fromBFloat16(a[i]));
+        }
+        const f32 d= dotBFloat16(a, b);
+        const f32 s= sumBFloat16(a);
+        EXPECT_NEAR(d, dot, 1e-4 * std::abs(dot) + 1e-3);
+        EXPECT_NEAR(s, sum, 1e-4 * std::abs(sum) + 1e-3);
+        results.push_back(d);
+        results.push_back(s);
+    }
+    // the accumulation order does not depend on the instruction set
+    EXPECT_EQ(results[0], results[2]);
+    EXPECT_EQ(results[1], results[3]);
+    fln::bithack::simd::setActiveIsa(fln::bithack::simd::bestIsa());
+}
@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+
+#define IDEBUG
+#include "bithack_BatchFunctions.h"
+
+using namespace fln::bithack;
+
+// sizes chosen to exercise empty arrays, tails and several vector widths
+static const std::vector<size_t> batchSizes{0, 1, 3, 7, 8, 15, 16, 17, 33, 1000};
+
+template<class T>
+static std::vector<T> makeInput(size_t n, T start, T step) {
+    std::vector<T> res(n);
+    for(size_t i= 0; i < n; ++i) res[i]= start + step * static_cast<T>(i);
+    return res;
+}
+
+TEST(bithack_batch, log2_float) {
+    for(auto n: batchSizes) {
+        auto in= makeInput<fln::f32>(n, 0.5f, 1.75f);
+        std::vector<fln::f32> out(n);
+        batch::log2(in, out);
+        for(size_t i= 0; i < n; ++i) EXPECT_EQ(out[i], fln::bithack::log2(in[i]));
+    }
+}
+
+TEST(bithack_batch, log2_double) {
+    for(auto n: batchSizes) {
+        auto in= makeInput<fln::f64>(n, 0.5, 1.75);
+        std::vector<fln::f64> out(n);
+        batch::log2(in, out);
+        for(size_t i= 0; i < n; ++i) EXPECT_EQ(out[i], fln::bithack::log2(in[i]));
+    }
+}
+
+TEST(bithack_batch, exp2) {
+    for(auto n: batchSizes) {
+        auto in = makeInput<fln::f32>(n, -50.0f, 0.1f);
+        auto ind= makeInput<fln::f64>(n, -50.0, 0.1);
+        std::vector<fln::f32> out(n);
+        std::vector<fln::f64> outd(n);
+        batch::exp2(in, out);
+        batch::exp2(ind, outd);
+        for(size_t i= 0; i < n; ++i) {
+            EXPECT_EQ(out[i], fln::bithack::exp2(in[i]));
+            EXPECT_EQ(outd[i], fln::bithack::exp2(ind[i]));
+        }
+    }
+}
+
+TEST(bithack_batch, pow) {
+    for(auto n: batchSizes) {
+        auto in = makeInput<fln::f32>(n, 1.0f, 0.7f);
+        auto p  = makeInput<fln::f32>(n, -2.0f, 0.01f);
+        auto ind= makeInput<fln::f64>(n, 1.0, 0.7);
+        auto pd = makeInput<fln::f64>(n, -2.0, 0.01);
+        std::vector<fln::f32> out(n), outp(n);
+        std::vector<fln::f64> outd(n), outpd(n);
+        batch::pow(in, out, 1.25f);
+        batch::pow(in, p, outp);
+        batch::pow(ind, outd, 1.25);
+        batch::pow(ind, pd, outpd);
+        for(size_t i= 0; i < n; ++i) {
+            EXPECT_EQ(out[i], fln::bithack::pow(in[i], 1.25f));
+            EXPECT_EQ(outp[i], fln::bithack::pow(in[i], p[i]));
+            EXPECT_EQ(outd[i], fln::bithack::pow(ind[i], 1.25));
+            EXPECT_EQ(outpd[i], fln::bithack::pow(ind[i], pd[i]));
+        }
+    }
+}
+
+TEST(bithack_batch, sqrt) {
+    for(auto n: batchSizes) {
+        auto in = makeInput<fln::f32>(n, 0.0f, 0.3f);
+        auto ind= makeInput<fln::f64>(n, 0.0, 0.3);
+        std::vector<fln::f32> out(n), outp(n), outb(n), outr(n);
+        std::vector<fln::f64> outd(n), outpd(n);
+        batch::sqrt(in, out);
+        batch::sqrt_pow(in, outp);
+        batch::sqrt_b(in, outb);
+        batch::rsqrt_quake(in, outr);
+        batch::sqrt(ind, outd);
+        batch::sqrt_pow(ind, outpd);
+        for(size_t i= 0; i < n; ++i) {
+            EXPECT_EQ(out[i], fln::bithack::sqrt(in[i]));
+            EXPECT_EQ(outp[i], fln::bithack::sqrt_pow(in[i]));
+            EXPECT_EQ(outb[i], fln::bithack::sqrt_b(in[i]));
+            EXPECT_EQ(outr[i], fln::bithack::rsqrt_quake(in[i]));
+            EXPECT_EQ(outd[i], fln::bithack::sqrt(ind[i]));
+            EXPECT_EQ(outpd[i], fln::bithack::sqrt_pow(ind[i]));
+        }
+    }
+}
+
+TEST(bithack_batch, sign) {
+    for(auto n: batchSizes) {
+        auto in = makeInput<fln::f32>(n, -10.0f, 0.9f);
+        auto ind= makeInput<fln::f64>(n, -10.0, 0.9);
+        std::vector<fln::f32> outa(n), outn(n);
+        std::vector<fln::f64> outad(n), outnd(n);
+        batch::abs(in, outa);
+        batch::negate(in, outn);
+        batch::abs(ind, outad);
+        batch::negate(ind, outnd);
+        for(size_t i= 0; i < n; ++i) {
+            EXPECT_EQ(outa[i], std::abs(in[i]));
+            EXPECT_EQ(outn[i], -in[i]);
+            EXPECT_EQ(outad[i], std::abs(ind[i]));
+            EXPECT_EQ(outnd[i], -ind[i]);
+        }
+    }
+}
+
+TEST(bithack_batch, unaligned_inplace) {
+    // offset by one element to break the natural alignment of the vector storage
+    auto buffer  = makeInput<fln::f32>(1001, 1.0f, 0.5f);
+    auto expected= buffer;
+    batch::log2(buffer.data() + 1, buffer.data() + 1, 1000);
+    EXPECT_EQ(buffer[0], expected[0]);
+    for(size_t i= 1; i < buffer.size(); ++i) EXPECT_EQ(buffer[i], fln::bithack::log2(expected[i]));
+}
+
+TEST(bithack_batch, span_size) {
+    // output smaller than input: only the common part is processed
+    auto in= makeInput<fln::f32>(10, 1.0f, 1.0f);
+    std::vector<fln::f32> out(5, -1.0f);
+    batch::sqrt(in, out);
+    for(size_t i= 0; i < out.size(); ++i) EXPECT_EQ(out[i], fln::bithack::sqrt(in[i]));
+}
@@ -294,4 +294,142 @@ TEST(bithack_functions,sqrt_b) {
 #endif
 }
 
+/**
+ * @brief Maximum errors of a precision tier over the whole normal range.
+ *
+ * log2 is checked on 4096 mantissas of every normal exponent, exp2 on a grid of 1/1024
+ * over all the inputs with a normal result.
+ * @tparam T The float type.
+ * @tparam P The precision tier.
+ * @return The maximum absolute error of log2 and the maximum relative error of exp2.
+ */
+template<class T, fln::Precision P>
+static std::pair<fln::f64, fln::f64> maxTierErrors() {
+    using U          = std::conditional_t<sizeof(T) == sizeof(fln::u32), fln::u32, fln::u64>;
+    constexpr int mb = std::numeric_limits<T>::digits - 1;
+    constexpr int low= std::numeric_limits<T>::min_exponent - 1;
+    constexpr int top= std::numeric_limits<T>::max_exponent;
+    constexpr U samples= 4096;
+    constexpr U step   = (U{1} << mb) / samples;
+    fln::f64 maxLog2= 0, maxExp2= 0;
+    for(int e= low; e < top; ++e) {
+        for(U k= 0; k < samples; ++k) {
+            // biased exponent, mantissas spread over the whole interval
+            const T n= fln::bithack::asFloat(static_cast<U>((static_cast<U>(e - low + 1) << mb) | (k * step + (k * 977U) % step)));
+            maxLog2  = std::max(maxLog2, std::abs(fln::bithack::log2<P>(n) - std::log2(static_cast<fln::f64>(n))));
+        }
+    }
+    for(fln::f64 x= low; x < top; x+= 1.0 / 1024) {
+        const T n          = static_cast<T>(x);
+        const fln::f64 ref = std::exp2(static_cast<fln::f64>(n));
+        maxExp2            = std::max(maxExp2, std::abs(fln::bithack::exp2<P>(n) - ref) / ref);
+    }
+    return {maxLog2, maxExp2};
+}
+
+TEST(bithack_functions, precision_tiers) {
+    // documented maximum errors: log2 absolute and exp2 relative, for float and double
+    struct Tier {
+        const char* name;
+        std::pair<fln::f64, fln::f64> (*errors32)();
+        std::pair<fln::f64, fln::f64> (*errors64)();
+        fln::f64 log2Error32, exp2Error32, log2Error64, exp2Error64;
+    };
+    const Tier tiers[]= {
+            {"Fast", maxTierErrors<fln::f32, fln::Precision::Fast>, maxTierErrors<fln::f64, fln::Precision::Fast>, 7.7e-3, 2.7e-3, 7.7e-3, 2.7e-3},
+            {"Medium", maxTierErrors<fln::f32, fln::Precision::Medium>, maxTierErrors<fln::f64, fln::Precision::Medium>, 1.2e-4, 3.5e-6, 1.2e-4, 3.4e-6},
+            {"High", maxTierErrors<fln::f32, fln::Precision::High>, maxTierErrors<fln::f64, fln::Precision::High>, 2.0e-5, 1.9e-7, 1.6e-5, 9.3e-8},
+    };
+    for(const auto& tier: tiers) {
+        const auto [log2Error32, exp2Error32]= tier.errors32();
+        const auto [log2Error64, exp2Error64]= tier.errors64();
+        EXPECT_LT(log2Error32, tier.log2Error32) << tier.name;
+        EXPECT_LT(exp2Error32, tier.exp2Error32) << tier.name;
+        EXPECT_LT(log2Error64, tier.log2Error64) << tier.name;
+        EXPECT_LT(exp2Error64, tier.exp2Error64) << tier.name;
+#ifdef FLN_VERBOSE_TEST
+        std::cout << "max errors of bithack " << tier.name << " log2: " << log2Error32 << " (double " << log2Error64 << ") exp2: "
+                  << exp2Error32 << " (double " << exp2Error64 << ")" << std::endl;
+#endif
+    }
+}
+
+/**
+ * @brief Maximum relative error of the refined square roots, from the smallest to the largest normal value.
+ * @tparam T The float type.
+ * @tparam Steps The number of refinement steps.
+ * @param inverse True for rsqrt, false for sqrt.
+ * @return The maximum relative error over 1024 mantissas of every normal exponent.
+ */
+template<class T, fln::u32 Steps>
+static fln::f64 maxRelativeError(bool inverse) {
+    using U          = std::conditional_t<sizeof(T) == sizeof(fln::u32), fln::u32, fln::u64>;
+    constexpr int mb = std::numeric_limits<T>::digits - 1;
+    constexpr U exps = std::numeric_limits<T>::max_exponent - std::numeric_limits<T>::min_exponent + 2;
+    constexpr U samples= 1024;
+    constexpr U step   = (U{1} << mb) / samples;
+    fln::f64 maxError= 0;
+    for(U e= 1; e < exps; ++e) {
+        for(U k= 0; k < samples; ++k) {
+            // the last mantissa of the last exponent is the largest value
+            const U mant        = e + 1 == exps && k + 1 == samples ? (U{1} << mb) - 1 : k * step + (k * 977U) % step;
+            const T n           = fln::bithack::asFloat(static_cast<U>((e << mb) | mant));
+            const fln::f64 ref  = inverse ? 1.0 / std::sqrt(static_cast<fln::f64>(n)) : std::sqrt(static_cast<fln::f64>(n));
+            const fln::f64 value= inverse ? fln::bithack::rsqrt<Steps>(n) : fln::bithack::sqrt<Steps>(n);
+            maxError            = std::max(maxError, std::abs(value - ref) / ref);
+        }
+    }
+    return maxError;
+}
+
+TEST(bithack_functions, rsqrt_refinement) {
+    EXPECT_LT((maxRelativeError<fln::f32, 0>(true)), fln::bithack::refinement::rsqrtError32[0]);
+    EXPECT_LT((maxRelativeError<fln::f32, 1>(true)), fln::bithack::refinement::rsqrtError32[1]);
+    EXPECT_LT((maxRelativeError<fln::f32, 2>(true)), fln::bithack::refinement::rsqrtError32[2]);
+    EXPECT_LT((maxRelativeError<fln::f32, 3>(true)), fln::bithack::refinement::rsqrtError32[3]);
+    EXPECT_LT((maxRelativeError<fln::f64, 0>(true)), fln::bithack::refinement::rsqrtError64[0]);
+    EXPECT_LT((maxRelativeError<fln::f64, 1>(true)), fln::bithack::refinement::rsqrtError64[1]);
+    EXPECT_LT((maxRelativeError<fln::f64, 2>(true)), fln::bithack::refinement::rsqrtError64[2]);
+    EXPECT_LT((maxRelativeError<fln::f64, 3>(true)), fln::bithack::refinement::rsqrtError64[3]);
+    EXPECT_LT((maxRelativeError<fln::f64, 4>(true)), fln::bithack::refinement::rsqrtError64[4]);
+    EXPECT_EQ(fln::bithack::rsqrt_quake(150.0f), fln::bithack::rsqrt<1>(150.0f));
+    // bounds of the normal range
+    EXPECT_NEAR(fln::bithack::rsqrt<3>(FLT_MIN), 1.0 / std::sqrt(static_cast<fln::f64>(FLT_MIN)), 2.0e-7 / std::sqrt(static_cast<fln::f64>(FLT_MIN)));
+    EXPECT_NEAR(fln::bithack::sqrt<3>(FLT_MAX), std::sqrt(static_cast<fln::f64>(FLT_MAX)), 9.0e-8 * std::sqrt(static_cast<fln::f64>(FLT_MAX)));
+}
+
+TEST(bithack_functions, sqrt_refinement) {
+    EXPECT_LT((maxRelativeError<fln::f32, 0>(false)), fln::bithack::refinement::sqrtError32[0]);
+    EXPECT_LT((maxRelativeError<fln::f32, 1>(false)), fln::bithack::refinement::sqrtError32[1]);
+    EXPECT_LT((maxRelativeError<fln::f32, 2>(false)), fln::bithack::refinement::sqrtError32[2]);
+    EXPECT_LT((maxRelativeError<fln::f32, 3>(false)), fln::bithack::refinement::sqrtError32[3]);
+    EXPECT_LT((maxRelativeError<fln::f64, 0>(false)), fln::bithack::refinement::sqrtError64[0]);
+    EXPECT_LT((maxRelativeError<fln::f64, 1>(false)), fln::bithack::refinement::sqrtError64[1]);
+    EXPECT_LT((maxRelativeError<fln::f64, 2>(false)), fln::bithack::refinement::sqrtError64[2]);
+    EXPECT_LT((maxRelativeError<fln::f64, 3>(false)), fln::bithack::refinement::sqrtError64[3]);
+    EXPECT_LT((maxRelativeError<fln::f64, 4>(false)), fln::bithack::refinement::sqrtError64[4]);
+    EXPECT_NEAR(fln::bithack::sqrt_b<2>(150.0f), std::sqrt(150.0f), 2e-6 * std::sqrt(150.0f));
+}
+
+/// check if the number of rsqrt steps of a tolerance is a constant expression
+template<class T, fln::f64 Tolerance>
+constexpr bool rsqrtReachable= requires { typename std::integral_constant<fln::u32, fln::bithack::rsqrtSteps<T>(Tolerance)>; };
+
+TEST(bithack_functions, refinement_steps) {
+    static_assert(fln::bithack::rsqrtSteps<fln::f32>(0.1) == 0);
+    static_assert(fln::bithack::rsqrtSteps<fln::f32>(1e-3) == 2);
+    static_assert(fln::bithack::rsqrtSteps<fln::f32>(2e-7) == 3);
+    // unreachable tolerance: not a constant expression, an exception at runtime
+    static_assert(rsqrtReachable<fln::f32, 2e-7>);
+    static_assert(!rsqrtReachable<fln::f32, 1e-12>);
+    const fln::f64 tolerance= std::pow(10.0, -12.0);
+    EXPECT_THROW((void)fln::bithack::rsqrtSteps<fln::f32>(tolerance), std::invalid_argument);
+    EXPECT_EQ(fln::bithack::rsqrtSteps<fln::f64>(tolerance), 4U);
+    static_assert(fln::bithack::rsqrtSteps<fln::f64>(1e-10) == 3);
+    static_assert(fln::bithack::sqrtSteps<fln::f32>(1e-2) == 1);
+    static_assert(fln::bithack::sqrtSteps<fln::f64>(1e-15) == 4);
+    constexpr fln::f32 r= fln::bithack::rsqrt<fln::bithack::rsqrtSteps<fln::f32>(1e-5)>(4.0f);
+    EXPECT_NEAR(r, 0.5f, 0.5f * 1e-5f);
+}
+
 #pragma GCC diagnostic pop
@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+
+#define IDEBUG
+#include "bithack_Functions.h"
+#include "bithack_SimdFunctions.h"
+
+using namespace fln::bithack;
+
+static const std::vector<simd::Isa> allIsa{simd::Isa::Scalar, simd::Isa::SSE41, simd::Isa::AVX2, simd::Isa::AVX512};
+
+TEST(bithack_simd, dispatch) {
+    EXPECT_TRUE(simd::isSupported(simd::Isa::Scalar));
+    EXPECT_EQ(simd::activeIsa(), simd::bestIsa());
+    EXPECT_TRUE(simd::isSupported(simd::bestIsa()));
+    for(auto isa: allIsa) {
+        EXPECT_STRNE(simd::isaName(isa), "Unknown");
+        if(simd::isSupported(isa)) {
+            EXPECT_TRUE(simd::setActiveIsa(isa));
+            EXPECT_EQ(simd::activeIsa(), isa);
+        } else {
+            EXPECT_FALSE(simd::setActiveIsa(isa));
+            EXPECT_NE(simd::activeIsa(), isa);
+        }
+    }
+    simd::setActiveIsa(simd::bestIsa());
+#ifdef FLN_VERBOSE_TEST
+    std::cout << "active simd path: " << simd::isaName(simd::activeIsa()) << std::endl;
+#endif
+}
+
+TEST(bithack_simd, kernels) {
+    // odd size with an unaligned start to exercise the tails
+    constexpr size_t n= 1003;
+    std::vector<fln::f32> in(n + 1), ine(n + 1), out(n + 1);
+    for(size_t i= 0; i <= n; ++i) {
+        in[i] = 0.01f + 0.37f * static_cast<fln::f32>(i);
+        ine[i]= -50.0f + 0.1f * static_cast<fln::f32>(i);
+    }
+    const fln::f32* x= in.data() + 1;
+    const fln::f32* e= ine.data() + 1;
+    fln::f32* y      = out.data() + 1;
+    for(auto isa: allIsa) {
+        if(!simd::setActiveIsa(isa)) continue;
+        simd::log2(x, y, n);
+        for(size_t i= 0; i < n; ++i) EXPECT_EQ(y[i], log2(x[i])) << simd::isaName(isa);
+        simd::exp2(e, y, n);
+        for(size_t i= 0; i < n; ++i) EXPECT_EQ(y[i], exp2(e[i])) << simd::isaName(isa);
+        simd::pow(x, y, n, 1.25f);
+        for(size_t i= 0; i < n; ++i) EXPECT_EQ(y[i], pow(x[i], 1.25f)) << simd::isaName(isa);
+        simd::sqrt(x, y, n);
+        for(size_t i= 0; i < n; ++i) EXPECT_EQ(y[i], sqrt(x[i])) << simd::isaName(isa);
+        simd::rsqrt(x, y, n);
+        for(size_t i= 0; i < n; ++i) EXPECT_NEAR(y[i], rsqrt_quake(x[i]), 1e-6f * rsqrt_quake(x[i])) << simd::isaName(isa);
+    }
+    simd::setActiveIsa(simd::bestIsa());
+}
@@ -24,9 +24,9 @@ TEST(BitDouble, Creations_affetation_comparison) {
     EXPECT_FALSE(f>-1789.523);
     EXPECT_TRUE(f<=-1789.523);
     EXPECT_TRUE(f>=-1789.523);
-    f2 = 1024ULL;
+    f2 = BitDouble::baseBits{1024};
     EXPECT_FALSE(f3 == f2);
-    BitDouble f4(1024ULL);
+    BitDouble f4(BitDouble::baseBits{1024});
     EXPECT_TRUE(f4 == f2);
 }
 
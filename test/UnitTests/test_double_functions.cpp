@@ -92,4 +92,40 @@ TEST(double_functions,pow) {
 #endif
 }
 
+TEST(double_functions, log2_precision) {
+    // maximum absolute error for each tier, as documented
+    fln::f64 maxFast= 0, maxMedium= 0, maxHigh= 0;
+    for(fln::f64 i= -25.0; i < 26.0; i+= 0.001) {
+        const fln::f64 n= static_cast<fln::f64>(std::pow(10.0, i));
+        const fln::f64 ref= std::log2(static_cast<fln::f64>(n));
+        maxFast  = std::max(maxFast, std::abs(fln::object::log2<fln::Precision::Fast>(fln::object::BitDouble(n)) - ref));
+        maxMedium= std::max(maxMedium, std::abs(fln::object::log2<fln::Precision::Medium>(fln::object::BitDouble(n)) - ref));
+        maxHigh  = std::max(maxHigh, std::abs(fln::object::log2<fln::Precision::High>(fln::object::BitDouble(n)) - ref));
+    }
+    EXPECT_LT(maxFast, 7.7e-3);
+    EXPECT_LT(maxMedium, 1.2e-4);
+    EXPECT_LT(maxHigh, 2.0e-5);
+#ifdef FLN_VERBOSE_TEST
+    std::cout << "max absolute error of object (double) log2 Fast: " << maxFast << " Medium: " << maxMedium << " High: " << maxHigh << std::endl;
+#endif
+}
+
+TEST(double_functions, exp2_precision) {
+    // maximum relative error for each tier, as documented
+    fln::f64 maxFast= 0, maxMedium= 0, maxHigh= 0;
+    for(fln::f64 i= -80.0; i < 80.0; i+= 0.001) {
+        const fln::f64 n= static_cast<fln::f64>(i);
+        const fln::f64 ref= std::exp2(static_cast<fln::f64>(n));
+        maxFast  = std::max(maxFast, std::abs(fln::object::exp2<fln::Precision::Fast>(fln::object::BitDouble(n)) - ref) / ref);
+        maxMedium= std::max(maxMedium, std::abs(fln::object::exp2<fln::Precision::Medium>(fln::object::BitDouble(n)) - ref) / ref);
+        maxHigh  = std::max(maxHigh, std::abs(fln::object::exp2<fln::Precision::High>(fln::object::BitDouble(n)) - ref) / ref);
+    }
+    EXPECT_LT(maxFast, 2.7e-3);
+    EXPECT_LT(maxMedium, 3.5e-6);
+    EXPECT_LT(maxHigh, 1.9e-7);
+#ifdef FLN_VERBOSE_TEST
+    std::cout << "max relative error of object (double) exp2 Fast: " << maxFast << " Medium: " << maxMedium << " High: " << maxHigh << std::endl;
+#endif
+}
+
 #pragma GCC diagnostic pop
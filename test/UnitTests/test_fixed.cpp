@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+
+#define IDEBUG
+#include "FixedType.h"
+#include "baseDefines.h"
+#include "bithack_SimdFunctions.h"
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace fln::object;
+using fln::f32;
+using fln::f64;
+using fln::s16;
+using fln::s32;
+using fln::s64;
+
+TEST(Fixed, layout) {
+    EXPECT_TRUE((std::is_same_v<Q15::storage, s16>));
+    EXPECT_TRUE((std::is_same_v<Q31::storage, s32>));
+    EXPECT_TRUE((std::is_same_v<Fixed<31, 32>::storage, s64>));
+    EXPECT_TRUE((std::is_same_v<Q15::wide, s32>));
+    EXPECT_EQ(sizeof(Q15), sizeof(s16));
+    EXPECT_EQ(Q15::scaleUp, 32768.0f);
+    EXPECT_EQ(Q31::scaleDown, 0x1p-31f);
+    EXPECT_EQ(Q15::max().raw(), 32767);
+    EXPECT_EQ(Q15::min().getFloat(), -1.0f);
+    EXPECT_EQ((Fixed<16, 15>::epsilon().getFloat()), 0x1p-15f);
+}
+
+TEST(Fixed, conversion) {
+    EXPECT_EQ(Q15(0.5f).raw(), 16384);
+    EXPECT_EQ(Q15(-0.25f).raw(), -8192);
+    EXPECT_EQ(Q15(0x1p-16f).raw(), 1);// tie away from zero
+    EXPECT_EQ(Q15(-0x1p-16f).raw(), -1);
+    EXPECT_EQ(Q15(0x1p-17f).raw(), 0);
+    EXPECT_EQ(Q15(1.0f), Q15::max());// saturation
+    EXPECT_EQ(Q15(-3.0f), Q15::min());
+    EXPECT_EQ(Q15(std::numeric_limits<f32>::infinity()), Q15::max());
+    EXPECT_EQ(Q15(std::numeric_limits<f32>::quiet_NaN()).raw(), 0);
+    EXPECT_EQ(Q31(1.0f), Q31::max());
+    EXPECT_EQ(Q31(-1.0f), Q31::min());
+    EXPECT_EQ(Q31(0.75f).raw(), 0x60000000);
+    EXPECT_EQ(Q31(0x1.fffffep-1f).raw(), 0x7FFFFF80);
+    EXPECT_EQ((Fixed<31, 32>(-0x1p31f)), (Fixed<31, 32>::min()));
+    EXPECT_EQ((Fixed<31, 32>(0x1p31f)), (Fixed<31, 32>::max()));
+    EXPECT_EQ((Fixed<16, 15>(-1234.5f).getFloat()), -1234.5f);
+    // every Q15 value round trips through a float
+    for(s32 r= -32768; r < 32768; ++r) {
+        const Q15 q= Q15::fromRaw(s16(r));
+        EXPECT_EQ(Q15(q.getFloat()), q);
+    }
+    // large values are already integers: no rounding issue
+    using Q= Fixed<31, 0, s32>;
+    EXPECT_EQ(Q(8388609.0f).raw(), 8388609);
+    EXPECT_EQ(Q(-8388609.0f).raw(), -8388609);
+    EXPECT_EQ((Fixed<15, 0>(-32767.7f).raw()), -32768);
+    EXPECT_EQ((Fixed<15, 0>(32767.7f).raw()), 32767);
+    // against a reference in double on a sweep of the floats
+    for(fln::u32 i= 0; i < 0xFFFFFFFFU - 65521U; i+= 65521U) {
+        const f32 f= std::bit_cast<f32>(i);
+        if(std::isnan(f)) continue;
+        const f64 e= std::round(static_cast<f64>(f) * 32768.0);
+        EXPECT_EQ(Q15(f).raw(), static_cast<s16>(std::clamp(e, -32768.0, 32767.0)));
+        const f64 e31= std::round(static_cast<f64>(f) * 0x1p31);
+        EXPECT_EQ(Q31(f).raw(), static_cast<s32>(std::clamp(e31, -0x1p31, 0x1p31 - 1.0)));
+    }
+}
+
+TEST(Fixed, arithmetic) {
+    using Q= Fixed<16, 15>;
+    const Q a(3.25f), b(-1.5f);
+    EXPECT_EQ((a + b).getFloat(), 1.75f);
+    EXPECT_EQ((a - b).getFloat(), 4.75f);
+    EXPECT_EQ((a * b).getFloat(), -4.875f);
+    EXPECT_EQ((a / b).getDouble(), std::trunc(3.25 / -1.5 * 32768.0) / 32768.0);
+    EXPECT_EQ((-a).getFloat(), -3.25f);
+    EXPECT_LT(b, a);
+    EXPECT_GE(a, a);
+    EXPECT_NE(a, b);
+    Q c= a;
+    c+= b;
+    c*= Q(2.0f);
+    c-= Q(0.5f);
+    c/= Q(4.0f);
+    EXPECT_EQ(c.getFloat(), 0.75f);
+    // product rounding
+    EXPECT_EQ((Q15::epsilon() * Q15(0.5f)).raw(), 1);
+    EXPECT_EQ((Q15::epsilon() * Q15(0.25f)).raw(), 0);
+    // wide products in 64 bits
+    using L= Fixed<31, 32>;
+    EXPECT_EQ((L(1000.5f) * L(-2000.25f)).getDouble(), 1000.5 * -2000.25);
+    EXPECT_EQ((L(1.0f) / L(3.0f)).raw(), 0x55555555);
+}
+
+TEST(Fixed, saturation) {
+    // wrapping operators
+    EXPECT_EQ(Q15::max() + Q15::epsilon(), Q15::min());
+    EXPECT_EQ(Q15::min() * Q15::min(), Q15::min());
+    EXPECT_EQ(-Q15::min(), Q15::min());
+    // saturating ones
+    EXPECT_EQ(saturatingAdd(Q15::max(), Q15::epsilon()), Q15::max());
+    EXPECT_EQ(saturatingSub(Q15::min(), Q15::epsilon()), Q15::min());
+    EXPECT_EQ(saturatingMul(Q15::min(), Q15::min()), Q15::max());
+    EXPECT_EQ(saturatingMul(Q31::min(), Q31::min()), Q31::max());
+    EXPECT_EQ(saturatingMul(Q15(0.5f), Q15(-0.5f)), Q15(-0.25f));
+    EXPECT_EQ(saturatingMac(Q15(0.75f), Q15(0.5f), Q15(0.5f)), Q15::max());
+    EXPECT_EQ(saturatingMac(Q15(0.75f), Q15(0.5f), Q15(-0.5f)), Q15(0.5f));
+    EXPECT_EQ(abs(Q15::min()), Q15::max());
+    EXPECT_EQ(abs(Q15(-0.5f)), Q15(0.5f));
+}
+
+template<typename Q>
+static void checkArrays() {
+    constexpr size_t n= 1003;
+    std::vector<Q> a(n), b(n), out(n), acc(n);
+    for(size_t i= 0; i < n; ++i) {
+        a[i]  = Q(-1.0f + 2.0f * static_cast<f32>(i) / static_cast<f32>(n));
+        b[i]  = Q(0.999f - 1.9f * static_cast<f32>(i % 97) / 97.0f);
+        acc[i]= Q(0.9f - 1.8f * static_cast<f32>(i % 13) / 13.0f);
+    }
+    saturatingAdd(std::span<const Q>(a), std::span<const Q>(b), std::span<Q>(out));
+    for(size_t i= 0; i < n; ++i) EXPECT_EQ(out[i], saturatingAdd(a[i], b[i]));
+    saturatingMul(a.data(), b.data(), out.data(), n);
+    for(size_t i= 0; i < n; ++i) EXPECT_EQ(out[i], saturatingMul(a[i], b[i]));
+    out= acc;
+    saturatingMac(a.data(), b.data(), out.data(), n);
+    for(size_t i= 0; i < n; ++i) EXPECT_EQ(out[i], saturatingMac(acc[i], a[i], b[i]));
+    std::vector<f32> f(n);
+    toFloat(a.data(), f.data(), n);
+    toFixed(f.data(), out.data(), n);
+    EXPECT_EQ(out, a);
+    // dot product of small values does not saturate
+    for(size_t i= 0; i < n; ++i) b[i]= Q(0.001f * static_cast<f32>(i % 7));
+    f64 exact= 0;
+    for(size_t i= 0; i < n; ++i) exact+= Q::product(a[i], b[i]);
+    EXPECT_EQ(dot(std::span<const Q>(a), std::span<const Q>(b)).getDouble(), exact * static_cast<f64>(Q::scaleDown));
+    const std::vector<Q> big(n, Q::min());
+    EXPECT_EQ(dot(big.data(), big.data(), n), Q::max());
+}
+
+TEST(Fixed, arrays) {
+    using fln::bithack::simd::Isa;
+    for(auto isa: {Isa::Scalar, fln::bithack::simd::bestIsa()}) {
+        fln::bithack::simd::setActiveIsa(isa);
+        checkArrays<Q15>();
+        checkArrays<Q31>();
+        checkArrays<Fixed<3, 12>>();
+        checkArrays<Fixed<15, 0>>();
+    }
+    fln::bithack::simd::setActiveIsa(fln::bithack::simd::bestIsa());
+}
@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#define IDEBUG
+#include "FP8Type.h"
+#include "baseDefines.h"
+#include <bit>
+#include <cmath>
+#include <limits>
+
+using namespace fln::object;
+using fln::f32;
+using fln::u32;
+using fln::u8;
+
+TEST(BitFP8, E4M3) {
+    EXPECT_EQ(fp8Table<E4M3>[0x7E], 448.0f);
+    EXPECT_EQ(fp8Table<E4M3>[0x78], 256.0f);// full exponent is a normal value
+    EXPECT_EQ(fp8Table<E4M3>[0x01], 0x1p-9f);
+    EXPECT_EQ(fp8Table<E4M3>[0x38], 1.0f);
+    EXPECT_TRUE(std::isnan(fp8Table<E4M3>[0x7F]));
+    EXPECT_TRUE(std::isnan(fp8Table<E4M3>[0xFF]));
+    EXPECT_TRUE(BitFP8<E4M3>(u8(0x7F)).isNaN());
+    EXPECT_FALSE(BitFP8<E4M3>(u8(0x78)).isNaN());
+    EXPECT_FALSE(BitFP8<E4M3>(u8(0x78)).isInfinite());
+    EXPECT_EQ(BitFP8<E4M3>(u8(0x38)).exponent(), 0);
+    // saturation
+    EXPECT_EQ(encodeFP8<E4M3>(464.0f), 0x7E);
+    EXPECT_EQ(encodeFP8<E4M3>(1e10f), 0x7E);
+    EXPECT_EQ(encodeFP8<E4M3>(-std::numeric_limits<f32>::infinity()), 0xFE);
+    EXPECT_EQ(encodeFP8<E4M3>(std::numeric_limits<f32>::quiet_NaN()), 0x7F);
+    // rounding
+    EXPECT_EQ(encodeFP8<E4M3>(1.0625f), 0x38);// tie to even: down
+    EXPECT_EQ(encodeFP8<E4M3>(1.1875f), 0x3A);// tie to even: up
+    EXPECT_EQ(encodeFP8<E4M3>(0x1p-10f), 0x00);
+    EXPECT_EQ(encodeFP8<E4M3>(0x3p-11f), 0x01);
+}
+
+TEST(BitFP8, E5M2) {
+    EXPECT_EQ(fp8Table<E5M2>[0x7B], 57344.0f);
+    EXPECT_EQ(fp8Table<E5M2>[0x3C], 1.0f);
+    EXPECT_EQ(fp8Table<E5M2>[0x01], 0x1p-16f);
+    EXPECT_TRUE(std::isinf(fp8Table<E5M2>[0x7C]));
+    EXPECT_TRUE(std::isnan(fp8Table<E5M2>[0x7E]));
+    EXPECT_TRUE(BitFP8<E5M2>(u8(0x7C)).isInfinite());
+    EXPECT_EQ(encodeFP8<E5M2>(std::numeric_limits<f32>::infinity()), 0x7B);
+    EXPECT_EQ(encodeFP8<E5M2>(-65536.0f), 0xFB);
+    EXPECT_TRUE(BitFP8<E5M2>(encodeFP8<E5M2>(std::numeric_limits<f32>::quiet_NaN())).isNaN());
+}
+
+template<typename Format>
+void checkEncoders() {
+    // all the patterns survive a round trip
+    for(u32 i= 0; i < 256; ++i) {
+        const f32 f= decodeFP8<Format>(u8(i));
+        EXPECT_EQ(std::bit_cast<u32>(f), std::bit_cast<u32>(unpackFloat<Format>(u8(i))));
+        if(!BitFP8<Format>(u8(i)).isNaN() && !BitFP8<Format>(u8(i)).isInfinite()) {
+            EXPECT_EQ(encodeFP8<Format>(f), i);
+        }
+    }
+    // the fast encoder gives the same bits as the generic one
+    for(u32 i= 0; i < 0xFFFFFFFFU - 4999U; i+= 4999U) {
+        const f32 f= std::bit_cast<f32>(i);
+        EXPECT_EQ(encodeFP8<Format>(f), packFloat<Format>(f)) << i;
+    }
+    // batch versions
+    std::vector<f32> in(301), back(301);
+    std::vector<u8> bits(301);
+    for(size_t i= 0; i < in.size(); ++i) in[i]= std::ldexp(static_cast<f32>(i) - 150.0f, static_cast<int>(i % 20) - 12);
+    encodeFP8<Format>(in, bits);
+    decodeFP8<Format>(bits, back);
+    for(size_t i= 0; i < in.size(); ++i) {
+        EXPECT_EQ(bits[i], encodeFP8<Format>(in[i]));
+        EXPECT_EQ(back[i], BitFP8<Format>(in[i]).getFloat());
+    }
+}
+
+TEST(BitFP8, encoders) {
+    checkEncoders<E4M3>();
+    checkEncoders<E5M2>();
+}
@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+
+#define IDEBUG
+#include "HalfType.h"
+#include "baseDefines.h"
+#include "bithack_SimdFunctions.h"
+#include <bit>
+#include <cmath>
+#include <limits>
+
+using namespace fln::object;
+using fln::f32;
+using fln::u16;
+using fln::u32;
+
+TEST(BitHalf, fields) {
+    BitHalf h(1.5f);
+    EXPECT_EQ(h.bits(), 0x3E00);
+    EXPECT_FALSE(h.sign());
+    EXPECT_EQ(h.exponentRaw(), 15);
+    EXPECT_EQ(h.exponent(), 0);
+    EXPECT_EQ(h.mantissaRaw(), 0x200);
+    EXPECT_STREQ(h.rawBits().c_str(), "[0][01111][1000000000]");
+    h.setExponent(3);
+    EXPECT_EQ(h.getFloat(), 12.0f);
+    h.toggleSign();
+    EXPECT_EQ(h.getFloat(), -12.0f);
+    EXPECT_TRUE(h.isNormalized());
+    EXPECT_TRUE(BitHalf(u16(0x0001)).isDenormalized());
+    EXPECT_TRUE(BitHalf(u16(0x7C00)).isInfinite());
+    EXPECT_TRUE(BitHalf(u16(0x7E00)).isNaN());
+    EXPECT_FALSE(BitHalf(u16(0x7C00)).isNaN());
+}
+
+TEST(BitHalf, rounding) {
+    EXPECT_EQ(BitHalf(65504.0f).bits(), 0x7BFF);                   // max
+    EXPECT_EQ(BitHalf(65519.0f).bits(), 0x7BFF);                   // below the half ulp
+    EXPECT_EQ(BitHalf(65520.0f).bits(), 0x7C00);                   // tie to even: infinity
+    EXPECT_EQ(BitHalf(1.0f + 0x1p-11f).bits(), 0x3C00);            // tie to even: down
+    EXPECT_EQ(BitHalf(1.0f + 3 * 0x1p-11f).bits(), 0x3C02);        // tie to even: up
+    EXPECT_EQ(BitHalf(0x1p-24f).bits(), 0x0001);                   // smallest denormal
+    EXPECT_EQ(BitHalf(0x1p-25f).bits(), 0x0000);                   // tie to even: zero
+    EXPECT_EQ(BitHalf(3 * 0x1p-26f).bits(), 0x0001);               // above the tie
+    EXPECT_EQ(BitHalf(-0x1p-14f + 0x1p-25f).bits(), 0x8400);       // denormal rounded up to the smallest normal
+    EXPECT_EQ(BitHalf(std::numeric_limits<f32>::denorm_min()).bits(), 0x0000);
+    EXPECT_EQ(BitHalf(-std::numeric_limits<f32>::infinity()).bits(), 0xFC00);
+    EXPECT_TRUE(BitHalf(std::numeric_limits<f32>::quiet_NaN()).isNaN());
+    EXPECT_TRUE(BitHalf(std::bit_cast<f32>(0x7F800001U)).isNaN());// signaling NaN stays NaN
+}
+
+TEST(BitHalf, exhaustive_roundtrip) {
+    for(u32 i= 0; i < 0x10000; ++i) {
+        const BitHalf h{u16(i)};
+        const f32 f= h.getFloat();
+        if(h.isNaN()) {
+            EXPECT_TRUE(std::isnan(f));
+            continue;
+        }
+        EXPECT_EQ(BitHalf(f).bits(), i);
+    }
+    EXPECT_EQ(BitHalf(u16(0x0001)).getFloat(), 0x1p-24f);
+    EXPECT_EQ(BitHalf(u16(0x03FF)).getFloat(), 0x3FFp-24f);
+    EXPECT_EQ(BitHalf(u16(0xC000)).getFloat(), -2.0f);
+}
+
+TEST(BitHalf, batch) {
+    // half patterns and floats spread over all exponents, compared with the scalar conversion
+    std::vector<u16> halves(0x10000);
+    for(u32 i= 0; i < 0x10000; ++i) halves[i]= u16(i);
+    std::vector<f32> floats;
+    for(u32 i= 0; i < 0xFFFFFFFFU - 9973U; i+= 9973U) floats.push_back(std::bit_cast<f32>(i));
+    std::vector<f32> decoded(halves.size());
+    std::vector<u16> encoded(floats.size());
+    for(auto isa: {fln::bithack::simd::Isa::Scalar, fln::bithack::simd::bestIsa()}) {
+        fln::bithack::simd::setActiveIsa(isa);
+#ifdef FLN_VERBOSE_TEST
+        std::cout << "half conversion with " << fln::bithack::simd::isaName(isa) << (halfUsesF16C() ? " (F16C)" : "") << std::endl;
+#endif
+        fromHalf(halves, decoded);
+        for(u32 i= 0; i < 0x10000; ++i) {
+            const f32 ref= unpackFloat<HalfTraits>(u16(i));
+            if(std::isnan(ref)) {
+                EXPECT_TRUE(std::isnan(decoded[i]));
+            } else {
+                EXPECT_EQ(std::bit_cast<u32>(decoded[i]), std::bit_cast<u32>(ref)) << i;
+            }
+        }
+        toHalf(floats, encoded);
+        for(size_t i= 0; i < floats.size(); ++i) {
+            const BitHalf ref(floats[i]);
+            if(ref.isNaN()) {
+                EXPECT_TRUE(BitHalf(encoded[i]).isNaN());
+            } else {
+                EXPECT_EQ(encoded[i], ref.bits()) << std::bit_cast<u32>(floats[i]);
+            }
+        }
+    }
+    fln::bithack::simd::setActiveIsa(fln::bithack::simd::bestIsa());
+}
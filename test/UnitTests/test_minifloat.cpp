@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+
+#define IDEBUG
+#include "BFloat16Type.h"
+#include "HalfType.h"
+#include "MiniFloat.h"
+#include "baseDefines.h"
+#include <bit>
+#include <cmath>
+
+using namespace fln::object;
+using fln::f32;
+using fln::f64;
+using fln::u16;
+using fln::u32;
+using fln::u64;
+using fln::u8;
+
+TEST(MiniFloat, layout) {
+    using M= MiniFloat<4, 5, 3>;
+    EXPECT_TRUE((std::is_same_v<M::baseBits, u16>));
+    EXPECT_EQ(M::traits::bitNum, 10U);
+    EXPECT_EQ(M::traits::expoBias, 3U);
+    EXPECT_EQ(M::traits::signMask, 0x200U);
+    EXPECT_EQ(M::traits::expoMask, 0x1E0U);
+    EXPECT_EQ(M::traits::notSign, 0x1FFU);
+    EXPECT_EQ(M(1.0f).bits(), 3U << 5U);
+    EXPECT_EQ(M(-1.0f).bits(), 0x200U | (3U << 5U));
+    EXPECT_EQ(M(u16(0x1DF)).getFloat(), 0x3Fp-5f * 0x1p11f);// largest finite value
+    EXPECT_TRUE((std::is_same_v<MiniFloat<11, 40>::baseBits, u64>));
+}
+
+TEST(MiniFloat, same_as_standard_formats) {
+    for(u32 i= 0; i < 0xFFFFFFFFU - 65521U; i+= 65521U) {
+        const f32 f= std::bit_cast<f32>(i);
+        if(std::isnan(f)) continue;
+        EXPECT_EQ((MiniFloat<5, 10>(f).bits()), BitHalf(f).bits());
+        EXPECT_EQ((MiniFloat<8, 7>(f).bits()), BitBFloat16(f).bits());
+    }
+}
+
+template<u32 E, u32 M, u32 B>
+void checkRoundTrip() {
+    using Mini= MiniFloat<E, M, B>;
+    for(u64 i= 0; i < (u64(1) << Mini::traits::bitNum); ++i) {
+        const Mini m{typename Mini::baseBits(i)};
+        if(m.isNaN()) continue;
+        EXPECT_EQ(Mini(m.getFloat()).bits(), i);
+        EXPECT_EQ(Mini(m.getDouble()).bits(), i);
+        EXPECT_EQ(f64(m.getFloat()), m.getDouble());
+    }
+}
+
+TEST(MiniFloat, round_trip) {
+    checkRoundTrip<3, 2, 3>();
+    checkRoundTrip<4, 5, 3>();
+    checkRoundTrip<5, 6, 15>();
+    checkRoundTrip<6, 9, 40>();
+}
+
+TEST(MiniFloat, no_double_rounding) {
+    // just above the half ulp: lost if rounded to f32 first
+    const f64 x= 1.0 + 0x1p-11 + 0x1p-40;
+    EXPECT_EQ((MiniFloat<5, 10>(x).bits()), 0x3C01);
+    EXPECT_EQ((MiniFloat<5, 10>(static_cast<f32>(x)).bits()), 0x3C00);
+    // a format that only fits in a double
+    using Wide= MiniFloat<11, 40>;
+    EXPECT_EQ(Wide(1.0 / 3.0).getDouble(), std::ldexp(std::round(std::ldexp(1.0 / 3.0, 42)), -42));
+    EXPECT_NEAR(Wide(1e300).getDouble(), 1e300, 1e300 * 0x1p-41);
+}
+
+TEST(MiniFloat, bit_packing) {
+    using Mini   = MiniFloat<4, 5>;
+    constexpr size_t n= 1001;
+    std::vector<f32> in(n), out(n);
+    std::vector<f64> outd(n);
+    for(size_t i= 0; i < n; ++i) in[i]= std::ldexp(static_cast<f32>(i) - 500.0f, -4);
+    std::vector<u8> buffer(packedBytes<Mini>(n));
+    EXPECT_EQ(buffer.size(), (n * 10 + 7) / 8);
+    packBits<Mini>(in, buffer);
+    unpackBits<Mini>(buffer, out);
+    unpackBits<Mini>(buffer, outd);
+    for(size_t i= 0; i < n; ++i) {
+        EXPECT_EQ(out[i], Mini(in[i]).getFloat()) << i;
+        EXPECT_EQ(outd[i], f64(out[i]));
+    }
+    // the first values are in the lowest bits
+    EXPECT_EQ(buffer[0], u8(Mini(in[0]).bits()));
+    EXPECT_EQ(buffer[1] & 0x3U, u32(Mini(in[0]).bits() >> 8U));
+}
@@ -1,7 +1,9 @@
 #include <gtest/gtest.h>
 
 #define IDEBUG
+#include "bithack_SimdFunctions.h"
 #include "rng.h"
+#include "rngZiggurat.h"
 #include "stdComputeStats.h"
 
 using namespace fln::rand;
@@ -87,3 +89,361 @@ TEST(random, float64){
     EXPECT_NEAR(res.mean, 0.5*(mi+ma), 0.0005*(mi+ma));
     EXPECT_NEAR(res.stdDeviation, std::sqrt(fln::f64(ma-mi)*fln::f64(ma-mi)/fln::f64(12)),0.0005*(ma-mi));
 }
+
+TEST(random, splitmix){
+    fln::u64 x = 1234;
+    EXPECT_EQ(splitMix64(x), 0xbb0cf61b2f181cdbULL);
+    EXPECT_EQ(splitMix64(x), 0x97c7a1364df06524ULL);
+    Xoshiro256ss rng(1234);
+    EXPECT_EQ(rng.state, (std::array<fln::u64, 4>{0xbb0cf61b2f181cdbULL, 0x97c7a1364df06524ULL, 0x33befae49bc025daULL, 0x4e6241f252d0a033ULL}));
+}
+
+TEST(random, xoshiro256ss){
+    Xoshiro256ss rng(std::array<fln::u64, 4>{1, 2, 3, 4});
+    EXPECT_EQ(rng.rand(), 0x2d00U);
+    EXPECT_EQ(rng.rand(), 0U);
+    EXPECT_EQ(rng.rand(), 0x5a007080U);
+    Xoshiro256ss j(std::array<fln::u64, 4>{1, 2, 3, 4});
+    j.jump();
+    EXPECT_EQ(j.state, (std::array<fln::u64, 4>{0x8c7a153956b5f3d1ULL, 0x701f1a713401d85eULL, 0x6527f66a65469085ULL, 0x8386b786c4408050ULL}));
+    Xoshiro256ss lj(std::array<fln::u64, 4>{1, 2, 3, 4});
+    lj.longJump();
+    EXPECT_EQ(lj.state, (std::array<fln::u64, 4>{0x96a8eb71295a400ULL, 0xdbf84991e50f4516ULL, 0x534ee745810d2a0eULL, 0x31655ca1a2215bf1ULL}));
+}
+
+TEST(random, xoroshiro128p){
+    Xoroshiro128p rng(std::array<fln::u64, 2>{1, 2});
+    EXPECT_EQ(rng.rand(), 0x3U);
+    EXPECT_EQ(rng.rand(), 0x6001030003ULL);
+    EXPECT_EQ(rng.rand(), 0x20c102c302000c03ULL);
+    Xoroshiro128p j(std::array<fln::u64, 2>{1, 2});
+    j.jump();
+    EXPECT_EQ(j.state, (std::array<fln::u64, 2>{0x66fbd4be1df0a7b5ULL, 0x830c3ddbb4aa3172ULL}));
+    Xoroshiro128p lj(std::array<fln::u64, 2>{1, 2});
+    lj.longJump();
+    EXPECT_EQ(lj.state, (std::array<fln::u64, 2>{0x3ce44494d47d323aULL, 0x2aa25ca8d61de643ULL}));
+}
+
+template<typename Engine>
+static void checkStreams(){
+    auto streams = makeStreams(Engine(1234), 4);
+    ASSERT_EQ(streams.size(), 4U);
+    EXPECT_EQ(streams[0].state, Engine(1234).state);
+    Engine jumped(1234);
+    jumped.jump();
+    jumped.jump();
+    EXPECT_EQ(streams[2].state, jumped.state);
+    for(size_t i = 1; i < streams.size(); ++i)
+        EXPECT_NE(streams[i].rand(), streams[i - 1].rand());
+    // the helpers work on every engine
+    for(fln::u32 a=0;a<1000;++a) {
+        const fln::u16 b = streams[3].getRandomU16(10, 20);
+        EXPECT_GE(b, 10);
+        EXPECT_LE(b, 20);
+    }
+}
+
+TEST(random, streams){
+    checkStreams<Xoshiro256ss>();
+    checkStreams<Xoroshiro128p>();
+}
+
+TEST(random, unbiased){
+    // bound close to 3 * 2^30: a modulo reduction would put half of the draws in the first third
+    constexpr fln::u32 bound = (3U << 30U) - 1U;
+    Xoshiro256ss x(1234);
+    fln::u32 first = 0;
+    for(fln::u32 a=0;a<30000;++a)
+        first += x.getRandomU32(bound) < bound / 3U;
+    EXPECT_NEAR(first, 10000, 300);
+    // upper values of the range are reachable
+    bool top64 = false, top32 = false;
+    for(fln::u32 a=0;a<100;++a) {
+        top64 |= x.getRandomU64(0xFFFFFFFFFFFFFFFFULL) > 0xF000000000000000ULL;
+        top32 |= x.getRandomU32(0xFFFFFFFFU) > 0xF0000000U;
+    }
+    EXPECT_TRUE(top64);
+    EXPECT_TRUE(top32);
+    EXPECT_EQ(x.getRandomU64(1), 0U);
+    EXPECT_EQ(x.getRandomU32(1), 0U);
+    EXPECT_EQ(x.getRandomU16(1), 0U);
+}
+
+TEST(random, mulHigh){
+    fln::u64 lo = 0;
+    EXPECT_EQ(detail::mulHigh(0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, lo), 0xFFFFFFFFFFFFFFFEULL);
+    EXPECT_EQ(lo, 1U);
+    EXPECT_EQ(detail::mulHigh(0x123456789ABCDEF0ULL, 0x0FEDCBA987654321ULL, lo), 0x0121FA00AD77D742ULL);
+    EXPECT_EQ(lo, 0x2236D88FE5618CF0ULL);
+}
+
+TEST(random, uniform){
+    EXPECT_EQ(uniformF32(0), 0.0f);
+    EXPECT_EQ(uniformF32(~0ULL), 1.0f - 0x1p-23f);
+    EXPECT_EQ(uniformF32<Interval::OpenClosed>(0), 1.0f);
+    EXPECT_EQ(uniformF32<Interval::OpenClosed>(~0ULL), 0x1p-23f);
+    EXPECT_EQ(uniformF64(0), 0.0);
+    EXPECT_EQ(uniformF64(~0ULL), 1.0 - 0x1p-52);
+    EXPECT_EQ(uniformF64<Interval::OpenClosed>(~0ULL), 0x1p-52);
+    EXPECT_TRUE((std::is_same_v<decltype(RandomGenerator().getRandomF64(0.0, 1.0)), fln::f64>));
+    Xoshiro256ss rng(1234);
+    std::vector<fln::f64> vals;
+    for(fln::u32 a=0;a<1000000;++a) {
+        const fln::f32 u = rng.getRandomF32();
+        const fln::f32 v = rng.getRandomF32<Interval::OpenClosed>();
+        const fln::f64 w = rng.getRandomF64();
+        EXPECT_GE(u, 0.0f);
+        EXPECT_LT(u, 1.0f);
+        EXPECT_GT(v, 0.0f);
+        EXPECT_LE(v, 1.0f);
+        EXPECT_EQ(u * 0x1p23f, std::floor(u * 0x1p23f));// full 23 bits resolution
+        EXPECT_GE(w, 0.0);
+        EXPECT_LT(w, 1.0);
+        vals.push_back(w);
+    }
+    auto res = fln::stats::getStats<fln::f64>(vals, true);
+    EXPECT_NEAR(res.mean, 0.5, 0.001);
+    EXPECT_NEAR(res.stdDeviation, std::sqrt(1.0 / 12.0), 0.001);
+    // fine resolution of the doubles: some values use more than 32 bits
+    bool fine = false;
+    for(fln::f64 w: vals) fine |= w * 0x1p32 != std::floor(w * 0x1p32);
+    EXPECT_TRUE(fine);
+}
+
+TEST(random, uniform_range){
+    RandomGenerator rng(1234);
+    std::vector<fln::f64> vals;
+    const fln::f32 mi = -3.0f, ma = 5.0f;
+    for(fln::u32 a=0;a<1000000;++a) {
+        const fln::f32 b = rng.getRandomF32(mi, ma);
+        vals.push_back(b);
+        EXPECT_GE(b, mi);
+        EXPECT_LT(b, ma);
+    }
+    auto res = fln::stats::getStats<fln::f64>(vals, true);
+    EXPECT_NEAR(res.mean, 0.5*(mi+ma), 0.01);
+    EXPECT_NEAR(res.stdDeviation, (ma-mi)/std::sqrt(12.0), 0.01);
+    const fln::f64 d = rng.getRandomF64(1e13, 2e13);
+    EXPECT_GE(d, 1e13);
+    EXPECT_LT(d, 2e13);
+}
+
+TEST(random, bulk_fill){
+    using fln::bithack::simd::Isa;
+    for(auto isa: {Isa::Scalar, fln::bithack::simd::bestIsa()}) {
+        fln::bithack::simd::setActiveIsa(isa);
+        auto lanes = makeStreams(Xoshiro256ss(1234), BulkRandomGenerator::lanes);
+        BulkRandomGenerator bulk(1234);
+        std::vector<fln::u64> out(1003);
+        bulk.fill(out);
+        for(size_t i = 0; i < out.size(); ++i)
+            EXPECT_EQ(out[i], lanes[i % BulkRandomGenerator::lanes].rand());
+        // the end of the last block is dropped
+        for(size_t l = out.size() % BulkRandomGenerator::lanes; l < BulkRandomGenerator::lanes; ++l) lanes[l].rand();
+        std::vector<fln::u32> out32(1001);
+        bulk.fill(out32);
+        for(size_t i = 0; i + 1 < out32.size(); i += 2) {
+            const fln::u64 r = lanes[(i / 2) % BulkRandomGenerator::lanes].rand();
+            EXPECT_EQ(out32[i], fln::u32(r >> 32U));
+            EXPECT_EQ(out32[i + 1], fln::u32(r));
+        }
+    }
+    fln::bithack::simd::setActiveIsa(fln::bithack::simd::bestIsa());
+}
+
+TEST(random, bulk_fill_float){
+    BulkRandomGenerator bulk(1234);
+    std::vector<fln::f32> f(100001);
+    bulk.fill(std::span<fln::f32>(f));
+    std::vector<fln::f64> vals(f.begin(), f.end());
+    for(fln::f32 x: f) {
+        EXPECT_GE(x, 0.0f);
+        EXPECT_LT(x, 1.0f);
+    }
+    auto res = fln::stats::getStats<fln::f64>(vals, true);
+    EXPECT_NEAR(res.mean, 0.5, 0.005);
+    EXPECT_NEAR(res.stdDeviation, std::sqrt(1.0 / 12.0), 0.005);
+    bulk.fill(std::span<fln::f64>(vals), -2.0, 6.0);
+    for(fln::f64 x: vals) {
+        EXPECT_GE(x, -2.0);
+        EXPECT_LT(x, 6.0);
+    }
+    res = fln::stats::getStats<fln::f64>(vals, true);
+    EXPECT_NEAR(res.mean, 2.0, 0.05);
+    bulk.fill(std::span<fln::f32>(f), 10.0f, 20.0f);
+    for(fln::f32 x: f) {
+        EXPECT_GE(x, 10.0f);
+        EXPECT_LT(x, 20.0f);
+    }
+    bulk.fill(std::span<fln::f64>(vals));
+    res = fln::stats::getStats<fln::f64>(vals, true);
+    EXPECT_NEAR(res.mean, 0.5, 0.005);
+}
+
+TEST(random, ziggurat_math){
+    for(fln::f64 x = -700.0; x < 700.0; x += 0.37) {
+        EXPECT_NEAR(fln::rand::detail::exp(x) / std::exp(x), 1.0, 1e-15);
+    }
+    for(fln::f64 x = 1e-300; x < 1e300; x *= 1.7) {
+        EXPECT_NEAR(fln::rand::detail::log(x), std::log(x), 1e-15 * std::max(1.0, std::abs(std::log(x))));
+    }
+    EXPECT_NEAR(fln::rand::detail::sqrt(2.0), std::sqrt(2.0), 3e-16);
+    // the layers of equal area close the ziggurat at the top
+    const auto& n = fln::rand::detail::normalTable;
+    EXPECT_NEAR(n.x[127] * (1.0 - n.f[127]), 9.91256303526217e-3, 1e-9);
+    EXPECT_DOUBLE_EQ(n.f[128], 1.0);
+    const auto& e = fln::rand::detail::exponentialTable;
+    EXPECT_NEAR(e.x[255] * (1.0 - e.f[255]), 3.949659822581557e-3, 1e-9);
+    static_assert(fln::rand::detail::normalTable.x[1] == 3.442619855899);
+}
+
+TEST(random, ziggurat_normal){
+    Xoshiro256ss rng(1234);
+    std::vector<fln::f64> vals(1000000);
+    normal(rng, std::span<fln::f64>(vals));
+    auto res = fln::stats::getStats<fln::f64>(vals, true);
+    EXPECT_NEAR(res.mean, 0.0, 0.005);
+    EXPECT_NEAR(res.stdDeviation, 1.0, 0.005);
+    fln::f64 m3 = 0, m4 = 0;
+    size_t beyond3 = 0, beyondR = 0;
+    for(fln::f64 x: vals) {
+        m3 += x * x * x;
+        m4 += x * x * x * x;
+        if(std::abs(x) > 3.0) ++beyond3;
+        if(std::abs(x) > 3.442619855899) ++beyondR;
+    }
+    EXPECT_NEAR(m3 / vals.size(), 0.0, 0.02);
+    EXPECT_NEAR(m4 / vals.size(), 3.0, 0.05);
+    // P(|x| > 3) = 2.70e-3, P(|x| > r) = 5.76e-4
+    EXPECT_NEAR(static_cast<fln::f64>(beyond3), 2700.0, 200.0);
+    EXPECT_NEAR(static_cast<fln::f64>(beyondR), 576.0, 80.0);
+    // same seed, same numbers
+    Xoshiro256ss a(42), b(42);
+    for(int i = 0; i < 1000; ++i) EXPECT_EQ(normal(a), normal(b));
+    std::vector<fln::f32> f(100000);
+    normal(rng, std::span<fln::f32>(f), 5.0f, 2.0f);
+    vals.assign(f.begin(), f.end());
+    res = fln::stats::getStats<fln::f64>(vals, true);
+    EXPECT_NEAR(res.mean, 5.0, 0.03);
+    EXPECT_NEAR(res.stdDeviation, 2.0, 0.03);
+    Xoroshiro128p fast(1234);
+    normal<FastTails<fln::Precision::High>>(fast, std::span<fln::f64>(vals));
+    res = fln::stats::getStats<fln::f64>(vals, true);
+    EXPECT_NEAR(res.mean, 0.0, 0.015);
+    EXPECT_NEAR(res.stdDeviation, 1.0, 0.015);
+}
+
+TEST(random, ziggurat_exponential){
+    Xoshiro256ss rng(1234);
+    std::vector<fln::f64> vals(1000000);
+    exponential(rng, std::span<fln::f64>(vals));
+    auto res = fln::stats::getStats<fln::f64>(vals, true);
+    EXPECT_NEAR(res.mean, 1.0, 0.005);
+    EXPECT_NEAR(res.stdDeviation, 1.0, 0.005);
+    size_t beyond4 = 0, beyondR = 0;
+    for(fln::f64 x: vals) {
+        EXPECT_GE(x, 0.0);
+        if(x > 4.0) ++beyond4;
+        if(x > 7.69711747013104972) ++beyondR;
+    }
+    // P(x > 4) = 1.83e-2, P(x > r) = 4.54e-4
+    EXPECT_NEAR(static_cast<fln::f64>(beyond4), 18316.0, 500.0);
+    EXPECT_NEAR(static_cast<fln::f64>(beyondR), 454.0, 70.0);
+    std::vector<fln::f32> f(100000);
+    RandomGenerator old(1234);
+    exponential<FastTails<fln::Precision::Medium>>(old, std::span<fln::f32>(f), 4.0f);
+    vals.assign(f.begin(), f.end());
+    res = fln::stats::getStats<fln::f64>(vals, true);
+    EXPECT_NEAR(res.mean, 0.25, 0.005);
+}
+
+TEST(random, ziggurat_golden){
+    // pinned outputs of seed 42: the tables, wedges and tails must give the same bits everywhere
+    const std::array<fln::f64, 8> normals{-0x1.dc208a21bf2c6p+0, -0x1.67bf9c8618abcp-4, 0x1.71dc1a1b770dcp-1, 0x1.b43826c8bebe4p+0,
+                                          0x1.039117c0663d3p+0, 0x1.c60127a0cad7p-1, 0x1.846ee0b199751p-1, 0x1.eed040ce1897ep+0};
+    const std::array<fln::f64, 8> exponentials{0x1.5eb87f57bf03cp-2, 0x1.48fe7a9431634p-1, 0x1.bf3bda43c0271p-1, 0x1.30107a604385dp+0,
+                                               0x1.0466e91565003p+1, 0x1.1ae7e7bbbf28fp+1, 0x1.94f22b3e042ep-1, 0x1.58b9304ad2f02p+0};
+    Xoshiro256ss a(42), b(42);
+    std::vector<fln::f64> n(100000), e(100000);
+    normal(a, std::span<fln::f64>(n));
+    exponential(b, std::span<fln::f64>(e));
+    for(size_t i = 0; i < 8; ++i) {
+        EXPECT_EQ(n[i], normals[i]) << i;
+        EXPECT_EQ(e[i], exponentials[i]) << i;
+    }
+    // first numbers of the tails
+    EXPECT_EQ(n[991], -0x1.d8e125884a79ap+1);
+    EXPECT_EQ(n[2047], 0x1.e41cc77e68fc8p+1);
+    EXPECT_EQ(e[2046], 0x1.1bb5953dd8f6ap+3);
+    EXPECT_EQ(e[6667], 0x1.13460fdee8619p+3);
+    // all the paths, wedges included
+    fln::f64 sn = 0, se = 0;
+    for(size_t i = 0; i < n.size(); ++i) {
+        sn += n[i];
+        se += e[i];
+    }
+    EXPECT_EQ(sn, 0x1.7dd18d5ef3b41p+8);
+    EXPECT_EQ(se, 0x1.86ce262230a18p+16);
+}
+
+TEST(random, philox){
+    // known answers of Random123
+    using Block = Philox4x32::Block;
+    EXPECT_EQ(Philox4x32::block({0, 0, 0, 0}, {0, 0}), (Block{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}));
+    EXPECT_EQ(Philox4x32::block({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, {0xffffffff, 0xffffffff}),
+              (Block{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}));
+    EXPECT_EQ(Philox4x32::block({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0}),
+              (Block{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}));
+    static_assert(Philox4x32::at(0, 0) == 0xe169c58d6627e8d5ULL);
+    // the sequence is the counter based function
+    Philox4x32 rng(77, 5);
+    for(fln::u64 c = 5; c < 1000; ++c) EXPECT_EQ(rng.rand(), Philox4x32::at(77, c));
+    rng.counter = 3;
+    EXPECT_EQ(rng.rand(), Philox4x32::at(77, 3));
+    rng.key = 78;
+    EXPECT_EQ(rng.rand(), Philox4x32::at(78, 4));
+    EXPECT_NE(Philox4x32::at(77, 4), Philox4x32::at(78, 4));
+    // plugged into the helpers
+    for(int i = 0; i < 1000; ++i) {
+        EXPECT_LT(rng.getRandomU32(17), 17U);
+        const fln::f64 x = rng.getRandomF64();
+        EXPECT_GE(x, 0.0);
+        EXPECT_LT(x, 1.0);
+    }
+}
+
+TEST(random, philox_fill){
+    using namespace fln::bithack::simd;
+    for(auto isa: {Isa::Scalar, bestIsa()}) {
+        setActiveIsa(isa);
+        for(fln::u64 first: {0ULL, 1ULL, 0xFFFFFFFFULL, 0x123456789ULL}) {
+            for(size_t n: {0, 1, 2, 15, 16, 17, 33, 1000}) {
+                std::vector<fln::u64> out(n);
+                Philox4x32::fill(0xC0FFEE, first, out);
+                for(size_t i = 0; i < n; ++i) EXPECT_EQ(out[i], Philox4x32::at(0xC0FFEE, first + i));
+            }
+        }
+        // any split of the work gives the same numbers
+        Philox4x32 rng(9, 1);
+        std::vector<fln::u64> a(301), b(301);
+        rng.fill(std::span<fln::u64>(a).first(100));
+        rng.fill(std::span<fln::u64>(a).subspan(100));
+        Philox4x32::fill(9, 1, b);
+        EXPECT_EQ(a, b);
+        EXPECT_EQ(rng.counter, 302U);
+        EXPECT_EQ(rng.rand(), Philox4x32::at(9, 302));
+        std::vector<fln::f64> d(1001);
+        Philox4x32::fill(9, 1, d);
+        for(size_t i = 0; i < d.size(); ++i) EXPECT_EQ(d[i], uniformF64(Philox4x32::at(9, 1 + i)));
+        std::vector<fln::f32> f(100001);
+        rng.fill(std::span<fln::f32>(f));
+        EXPECT_EQ(f[0], uniformF32(Philox4x32::at(9, 303)));
+        EXPECT_EQ(f[1], uniformF32(Philox4x32::at(9, 303) << 32U));
+        EXPECT_EQ(rng.counter, 303U + 50001U);
+        std::vector<fln::f64> vals(f.begin(), f.end());
+        auto res = fln::stats::getStats<fln::f64>(vals, true);
+        EXPECT_NEAR(res.mean, 0.5, 0.005);
+        EXPECT_NEAR(res.stdDeviation, std::sqrt(1.0 / 12.0), 0.005);
+    }
+    setActiveIsa(bestIsa());
+}
@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+
+#define IDEBUG
+#include "DoubleFunctions.h"
+#include "FloatFunctions.h"
+#include "baseDefines.h"
+#include <bit>
+#include <cmath>
+#include <type_traits>
+
+using namespace fln::object;
+
+TEST(BitReal, aliases) {
+    EXPECT_TRUE((std::is_same_v<BitFloat, BitReal<fln::f32>>));
+    EXPECT_TRUE((std::is_same_v<BitDouble, BitReal<fln::f64>>));
+    EXPECT_TRUE((std::is_same_v<decltype(BitFloat{}.exponentRaw()), fln::u8>));
+    EXPECT_TRUE((std::is_same_v<decltype(BitDouble{}.exponent()), fln::s16>));
+}
+
+TEST(BitReal, layout) {
+    using l32= RealTraits<fln::f32>;
+    using l64= RealTraits<fln::f64>;
+    EXPECT_EQ(l32::expoBias, 127U);
+    EXPECT_EQ(l64::expoBias, 1023U);
+    EXPECT_EQ(l32::fullExpo, 0xFFU);
+    EXPECT_EQ(l64::fullExpo, 0x7FFU);
+    EXPECT_EQ(std::bit_cast<fln::u32>(1.0f), l32::oneAsInt);
+    EXPECT_EQ(std::bit_cast<fln::u64>(1.0), l64::oneAsInt);
+    EXPECT_EQ(l32::scaleUp * l32::scaleDown, 1.0f);
+    EXPECT_EQ(l64::scaleUp * l64::scaleDown, 1.0);
+}
+
+TEST(BitReal, generic_functions) {
+    const BitFloat f(-8.0f);
+    const BitDouble d(-8.0);
+    EXPECT_EQ(abs(f).fl(), 8.0f);
+    EXPECT_EQ(abs(d).fl(), 8.0);
+    // exact on powers of two
+    EXPECT_EQ(log2(abs(f)), 3.0f);
+    EXPECT_EQ(log2(abs(d)), 3.0);
+    EXPECT_EQ(log2a(f), 3.0f);
+    EXPECT_EQ(log2a(d), 3.0);
+    EXPECT_EQ(exp2(BitFloat(-3.0f)), 0.125f);
+    EXPECT_EQ(exp2(BitDouble(-3.0)), 0.125);
+    EXPECT_NEAR(exp2<fln::Precision::High>(BitDouble(10.5)), std::exp2(10.5), 1e-3);
+    EXPECT_NEAR(log2<fln::Precision::High>(BitFloat(10.5f)), std::log2(10.5f), 1e-3f);
+}
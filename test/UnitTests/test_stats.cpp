@@ -1,7 +1,11 @@
 #include <gtest/gtest.h>
+#include <cstring>
 
 #define IDEBUG
+#include "bithack_SimdFunctions.h"
+#include "rngZiggurat.h"
 #include "stdComputeStats.h"
+#include "stdQuantileSketch.h"
 
 TEST(stdStats, oneElement){
     std::vector<fln::f32> a{-666.0f};
@@ -34,6 +38,304 @@ TEST(stdStats, setElements_u32){
     std::vector<fln::f32> a{2300,253,723,823,123,2355,283,4523};
     auto res=fln::stats::getStats<fln::f32>(a);
     EXPECT_NEAR(res.mean,1422.875,0.001);
-    EXPECT_NEAR(res.squareSum,32652838.0,0.001);
+    // exact value 32652839, rounded to float
+    EXPECT_NEAR(res.squareSum,32652840.0,0.001);
     EXPECT_NEAR(res.stdDeviation,1434.2355957,0.001);
 }
+
+TEST(stdStats, overflow_u32){
+    // 70000^2 does not fit in 32 bits
+    std::vector<fln::u32> a{70000, 70000, 70000, 70002};
+    auto res=fln::stats::getStats<fln::u32>(a);
+    EXPECT_EQ(res.sum, 280002U);
+    EXPECT_EQ(res.squareSum, 19600280004ULL);
+    EXPECT_EQ(res.mean, 70000U);
+    EXPECT_EQ(res.min, 70000U);
+    EXPECT_EQ(res.max, 70002U);
+}
+
+TEST(stdStats, squares_32bits){
+    using namespace fln::bithack::simd;
+    for(auto isa: {Isa::Scalar, bestIsa()}) {
+        setActiveIsa(isa);
+        EXPECT_EQ(fln::stats::getStats(std::vector<fln::u32>{4000000000U}).squareSum, 16000000000000000000ULL);
+        // above 2^53: exact, not through the moments in double
+        EXPECT_EQ(fln::stats::getStats(std::vector<fln::u32>(17, 1000000001U)).squareSum, 17000000034000000017ULL);
+        EXPECT_EQ(fln::stats::getStats(std::vector<fln::s32>{-2147483647 - 1, 2147483647}).squareSum, 9223372032559808513LL);
+        std::vector<fln::s32> mixed(20, -2147483647 - 1);
+        mixed[3]= 1;
+        EXPECT_EQ(fln::stats::getStats(mixed).squareSum, std::numeric_limits<fln::s64>::max());
+        // saturated to the largest sum
+        EXPECT_EQ(fln::stats::getStats(std::vector<fln::u32>(20, 3000000000U)).squareSum, std::numeric_limits<fln::u64>::max());
+        fln::stats::StreamingStats<fln::u32> acc;
+        acc.push(4000000000U);
+        acc.push(4000000000U);
+        EXPECT_EQ(acc.result().squareSum, std::numeric_limits<fln::u64>::max());
+    }
+    setActiveIsa(bestIsa());
+}
+
+TEST(stdStats, stability){
+    // large offset: the difference of squares loses everything in single precision
+    std::vector<fln::f32> a;
+    for(int i= 0; i < 100000; ++i) a.push_back(10000.0f + static_cast<fln::f32>(i % 3));
+    auto res=fln::stats::getStats<fln::f32>(a);
+    EXPECT_NEAR(res.mean, 10001.0, 1e-3);
+    EXPECT_NEAR(res.stdDeviation, std::sqrt(2.0 / 3.0), 1e-4);
+    EXPECT_EQ(res.min, 10000.0f);
+    EXPECT_EQ(res.max, 10002.0f);
+}
+
+template<class T>
+void checkMinMax(size_t n) {
+    // the values are surrounded by smaller and larger ones, that must not be read
+    std::vector<T> buffer(n + 32, static_cast<T>(-100));
+    for(size_t i= n + 16; i < buffer.size(); ++i) buffer[i]= static_cast<T>(500);
+    for(size_t i= 0; i < n; ++i) buffer[16 + i]= static_cast<T>(1 + (i * 7) % 13);
+    const std::span<const T> data(buffer.data() + 16, n);
+    const T mi= *std::min_element(data.begin(), data.end());
+    const T ma= *std::max_element(data.begin(), data.end());
+    fln::stats::StreamingStats<T> acc;
+    acc.pushBatch(data);
+    EXPECT_EQ(acc.min(), mi) << n;
+    EXPECT_EQ(acc.max(), ma) << n;
+    const auto res= fln::stats::getStats(std::vector<T>(data.begin(), data.end()));
+    EXPECT_EQ(res.min, mi) << n;
+    EXPECT_EQ(res.max, ma) << n;
+}
+
+TEST(stdStats, shortBlocks){
+    using namespace fln::bithack::simd;
+    for(auto isa: {Isa::Scalar, bestIsa()}) {
+        setActiveIsa(isa);
+        std::vector<size_t> sizes;
+        for(size_t n= 1; n <= 17; ++n) sizes.push_back(n);
+        for(size_t k= 1; k <= 2; ++k) {
+            for(size_t r: {1U, 3U, 7U, 15U}) sizes.push_back(1024 * k + r);
+        }
+        for(size_t n: sizes) {
+            checkMinMax<fln::f32>(n);
+            checkMinMax<fln::f64>(n);
+            checkMinMax<fln::s32>(n);
+            checkMinMax<fln::u32>(n);
+        }
+        EXPECT_EQ(fln::stats::getStats(std::vector<fln::f32>(1025, 1.0f)).min, 1.0f);
+        // one NaN gives NaN extrema, wherever it is and whatever the instruction set
+        for(size_t pos: {0U, 1U, 5U, 20U, 1030U}) {
+            std::vector<fln::f32> a(1040, 2.0f);
+            a[pos]= std::numeric_limits<fln::f32>::quiet_NaN();
+            const auto res= fln::stats::getStats(a);
+            EXPECT_TRUE(std::isnan(res.min)) << pos;
+            EXPECT_TRUE(std::isnan(res.max)) << pos;
+            fln::stats::StreamingStats<fln::f32> one;
+            for(fln::f32 x: a) one.push(x);
+            EXPECT_TRUE(std::isnan(one.min())) << pos;
+            EXPECT_TRUE(std::isnan(one.max())) << pos;
+        }
+    }
+    setActiveIsa(bestIsa());
+}
+
+TEST(streamingStats, pushAndMerge){
+    std::vector<fln::f64> a;
+    for(int i= 0; i < 5000; ++i) a.push_back(std::sin(i * 0.37) * 100.0 + 1e6);
+    fln::stats::StreamingStats<fln::f64> one, batch, left, right;
+    EXPECT_EQ(one.count(), 0U);
+    EXPECT_EQ(one.result().stdDeviation, 0.0);
+    EXPECT_EQ(one.result().min, 0.0);
+    for(fln::f64 x: a) one.push(x);
+    batch.pushBatch(a);
+    left.pushBatch(std::span<const fln::f64>(a).first(1234));
+    for(size_t i= 1234; i < a.size(); ++i) right.push(a[i]);
+    left.merge(right);
+    fln::f64 mean= 0;
+    for(fln::f64 x: a) mean+= x;
+    mean/= static_cast<fln::f64>(a.size());
+    fln::f64 m2= 0;
+    for(fln::f64 x: a) m2+= (x - mean) * (x - mean);
+    for(const auto* s: {&one, &batch, &left}) {
+        EXPECT_EQ(s->count(), a.size());
+        EXPECT_NEAR(s->mean(), mean, 1e-8);
+        EXPECT_NEAR(s->variance(), m2 / static_cast<fln::f64>(a.size()), 1e-8);
+        EXPECT_NEAR(s->sampleVariance(), m2 / static_cast<fln::f64>(a.size() - 1), 1e-8);
+        EXPECT_EQ(s->min(), *std::min_element(a.begin(), a.end()));
+        EXPECT_EQ(s->max(), *std::max_element(a.begin(), a.end()));
+        EXPECT_NEAR(s->result().sum, mean * static_cast<fln::f64>(a.size()), 1e-3);
+    }
+    fln::stats::StreamingStats<fln::s16> ints;
+    ints.pushBatch(std::vector<fln::s16>{-30000, 30000, -5, 5});
+    EXPECT_EQ(ints.result().sum, 0);
+    EXPECT_EQ(ints.result().squareSum, 1800000050);
+    EXPECT_EQ(ints.min(), -30000);
+    EXPECT_EQ(ints.max(), 30000);
+}
+
+TEST(streamingStats, parallel){
+    using namespace fln::bithack::simd;
+    std::vector<fln::f32> a(1000003);
+    std::vector<fln::s32> b(a.size());
+    for(size_t i= 0; i < a.size(); ++i) {
+        a[i]= static_cast<fln::f32>(std::cos(static_cast<fln::f64>(i) * 0.001) * 50.0 + 7.0);
+        b[i]= static_cast<fln::s32>(i % 2001) - 1000;
+    }
+    for(auto isa: {Isa::Scalar, bestIsa()}) {
+        setActiveIsa(isa);
+        auto ref= fln::stats::StreamingStats<fln::f32>{};
+        for(fln::f32 x: a) ref.push(x);
+        const auto one= fln::stats::parallelSummarize<fln::f32>(a, 1);
+        EXPECT_EQ(one.count(), a.size());
+        EXPECT_NEAR(one.mean(), ref.mean(), 1e-9);
+        EXPECT_NEAR(one.variance(), ref.variance(), 1e-7);
+        EXPECT_EQ(one.min(), ref.min());
+        EXPECT_EQ(one.max(), ref.max());
+        // same chunks, same merge tree: the result does not depend on the threads
+        for(fln::u32 threads: {2U, 3U, 8U, 0U}) {
+            const auto many= fln::stats::parallelSummarize<fln::f32>(a, threads);
+            EXPECT_EQ(many.mean(), one.mean());
+            EXPECT_EQ(many.variance(), one.variance());
+        }
+        const auto res= fln::stats::getParallelStats(b, 4);
+        EXPECT_EQ(res.sum, -373744L);
+        EXPECT_EQ(res.min, -1000);
+        EXPECT_EQ(res.max, 1000);
+        EXPECT_EQ(res.sum, fln::stats::getStats(b).sum);
+    }
+    setActiveIsa(bestIsa());
+    const auto empty= fln::stats::getParallelStats(std::vector<fln::f64>{});
+    EXPECT_EQ(empty.mean, 0.0);
+    EXPECT_EQ(empty.sum, 0.0);
+}
+
+TEST(stdStats, summation){
+    using namespace fln::bithack::simd;
+    using fln::stats::Summation;
+    // 10^7 values in [0.1, 1.1): the running sum in float loses about 4 digits
+    std::vector<fln::f32> a(10000000);
+    std::vector<fln::f64> b(a.size());
+    long double exact= 0;
+    fln::u64 state   = 1;
+    for(size_t i= 0; i < a.size(); ++i) {
+        state= state * 6364136223846793005ULL + 1442695040888963407ULL;
+        a[i] = static_cast<fln::f32>(static_cast<fln::f64>(state >> 40U) * 0x1p-24) + 0.1f;
+        b[i] = static_cast<fln::f64>(a[i]) * (1.0 + 0x1p-30);
+        exact+= a[i];
+    }
+    const auto relative= [&](fln::f64 s) { return std::abs(static_cast<fln::f64>((s - exact) / exact)); };
+    for(auto isa: {Isa::Scalar, bestIsa()}) {
+        setActiveIsa(isa);
+        const fln::f64 naive= relative(fln::stats::sum<Summation::Naive>(a));
+        EXPECT_LT(naive, 1e-5);
+        EXPECT_GT(naive, 1e-7);
+        EXPECT_LT(relative(fln::stats::sum<Summation::Kahan>(a)), 1e-7);
+        EXPECT_LT(relative(fln::stats::sum<Summation::Neumaier>(a)), 1e-7);
+        EXPECT_LT(relative(fln::stats::sum<Summation::Pairwise>(a)), 5e-7);
+        EXPECT_LT(relative(fln::stats::sum<Summation::Wide>(a)), 1e-7);
+        const auto res= fln::stats::getStats<fln::f32, Summation::Kahan>(a);
+        EXPECT_NEAR(res.mean, static_cast<fln::f64>(exact) / static_cast<fln::f64>(a.size()), 1e-6);
+        EXPECT_EQ(res.sum, fln::stats::sum<Summation::Kahan>(a));
+        // doubles: all the compensated ones agree to the last bits
+        const fln::f64 ref= fln::stats::sum<Summation::Neumaier>(b);
+        EXPECT_NEAR(fln::stats::sum<Summation::Kahan>(b), ref, std::abs(ref) * 1e-15);
+        EXPECT_NEAR(fln::stats::sum<Summation::Pairwise>(b), ref, std::abs(ref) * 1e-14);
+        // a value larger than the sum in the same partial sum: only Neumaier keeps the small ones
+        std::vector<fln::f64> c(67, 0.0);
+        c[0] = 1;
+        c[32]= 1e100;
+        c[64]= -1e100;
+        c[66]= 1;
+        EXPECT_EQ(fln::stats::sum<Summation::Naive>(c), 1.0);
+        EXPECT_EQ(fln::stats::sum<Summation::Neumaier>(c), 2.0);
+        EXPECT_EQ(fln::stats::sum<Summation::Naive>(std::span<const fln::f64>{}), 0.0);
+    }
+    setActiveIsa(bestIsa());
+    std::vector<fln::s32> ints{2000000000, 2000000000, -5};
+    EXPECT_EQ(fln::stats::sum<Summation::Naive>(ints), 3999999995L);
+}
+
+TEST(quantileSketch, accuracy){
+    fln::rand::Xoshiro256ss rng(42);
+    std::vector<fln::f64> a(1000000);
+    for(auto& x: a) x= fln::rand::exponential(rng);
+    std::vector<fln::f64> sorted= a;
+    std::sort(sorted.begin(), sorted.end());
+    const auto rankOf= [&](fln::f64 x) {
+        return static_cast<fln::f64>(std::lower_bound(sorted.begin(), sorted.end(), x) - sorted.begin()) / static_cast<fln::f64>(sorted.size());
+    };
+    fln::stats::QuantileSketch sketch;
+    sketch.pushBatch(a);
+    EXPECT_EQ(sketch.count(), a.size());
+    EXPECT_LE(sketch.centroids().size(), static_cast<size_t>(sketch.compression()));
+    EXPECT_EQ(sketch.min(), sorted.front());
+    EXPECT_EQ(sketch.max(), sorted.back());
+    EXPECT_EQ(sketch.quantile(0), sorted.front());
+    EXPECT_EQ(sketch.quantile(1), sorted.back());
+    // the error shrinks with sqrt(q(1-q)): the tails are the most accurate
+    for(fln::f64 q: {0.01, 0.5, 0.9}) EXPECT_NEAR(rankOf(sketch.quantile(q)), q, 1e-3);
+    for(fln::f64 q: {0.99, 0.999, 0.9999}) EXPECT_NEAR(rankOf(sketch.quantile(q)), q, 1e-4);
+    for(fln::f64 q: {0.01, 0.5, 0.99, 0.999}) EXPECT_NEAR(sketch.cdf(sorted[static_cast<size_t>(q * 1e6)]), q, 1e-3);
+    EXPECT_EQ(sketch.cdf(-1.0), 0.0);
+    EXPECT_EQ(sketch.cdf(sorted.back()), 1.0);
+    // the per thread sketches merged give the same accuracy
+    std::vector<fln::stats::QuantileSketch> parts(7);
+    for(size_t i= 0; i < a.size(); ++i) parts[i % parts.size()].push(a[i]);
+    fln::stats::QuantileSketch merged;
+    for(const auto& part: parts) merged.merge(part);
+    EXPECT_EQ(merged.count(), a.size());
+    EXPECT_EQ(merged.min(), sorted.front());
+    EXPECT_EQ(merged.max(), sorted.back());
+    for(fln::f64 q: {0.5, 0.99, 0.999}) EXPECT_NEAR(rankOf(merged.quantile(q)), q, 1e-3);
+}
+
+TEST(quantileSketch, smallAndSerialized){
+    // few values: no merging, the quantiles are interpolated between the values
+    fln::stats::QuantileSketch empty;
+    EXPECT_EQ(empty.quantile(0.5), 0.0);
+    EXPECT_EQ(empty.cdf(1.0), 0.0);
+    std::vector<fln::s32> a{5, 1, 4, 2, 3};
+    fln::stats::QuantileSketch sketch(50);
+    sketch.pushBatch(a);
+    sketch.push(std::nan(""));
+    // infinities are ignored too: no inf - inf in the centroids
+    sketch.push(std::numeric_limits<fln::f64>::infinity());
+    sketch.pushBatch(std::vector<fln::f64>{-std::numeric_limits<fln::f64>::infinity()});
+    EXPECT_EQ(sketch.count(), 5U);
+    EXPECT_EQ(sketch.centroids().size(), 5U);
+    EXPECT_DOUBLE_EQ(sketch.quantile(0.5), 3.0);
+    EXPECT_DOUBLE_EQ(sketch.quantile(0.3), 2.0);
+    EXPECT_DOUBLE_EQ(sketch.quantile(0.4), 2.5);
+    EXPECT_DOUBLE_EQ(sketch.cdf(2.5), 0.4);
+    const auto q= fln::stats::getQuantiles(a, {0.1, 0.5, 0.9});
+    EXPECT_EQ(q, (std::vector<fln::f64>{1.0, 3.0, 5.0}));
+    // round trip
+    for(int i= 0; i < 10000; ++i) sketch.push(std::sin(i * 0.1));
+    const std::vector<fln::u8> bytes= sketch.serialize();
+    const auto copy= fln::stats::QuantileSketch::deserialize(bytes);
+    EXPECT_EQ(copy.count(), sketch.count());
+    EXPECT_EQ(copy.compression(), sketch.compression());
+    EXPECT_EQ(copy.min(), sketch.min());
+    EXPECT_EQ(copy.max(), sketch.max());
+    for(fln::f64 p: {0.0, 0.25, 0.5, 0.999}) EXPECT_EQ(copy.quantile(p), sketch.quantile(p));
+    EXPECT_EQ(copy.serialize(), bytes);
+    EXPECT_THROW((void)fln::stats::QuantileSketch::deserialize(std::span<const fln::u8>(bytes).first(bytes.size() - 1)), std::invalid_argument);
+    std::vector<fln::u8> wrong= bytes;
+    wrong[0]                  = 0;
+    EXPECT_THROW((void)fln::stats::QuantileSketch::deserialize(wrong), std::invalid_argument);
+    // corrupted fields: compression at offset 8, count at 16, size at 40, first weight at 56
+    const auto corrupt= [&](size_t offset, auto value) {
+        std::vector<fln::u8> image= bytes;
+        std::memcpy(image.data() + offset, &value, sizeof(value));
+        return image;
+    };
+    for(fln::f64 c: {std::nan(""), 1e300, 5.0, -1.0}) EXPECT_THROW((void)fln::stats::QuantileSketch::deserialize(corrupt(8, c)), std::invalid_argument);
+    EXPECT_THROW((void)fln::stats::QuantileSketch::deserialize(corrupt(16, copy.count() + 1)), std::invalid_argument);
+    // size * 16 wraps to the real size of the centroids
+    EXPECT_THROW((void)fln::stats::QuantileSketch::deserialize(corrupt(40, copy.centroids().size() + (fln::u64{1} << 60U))), std::invalid_argument);
+    EXPECT_THROW((void)fln::stats::QuantileSketch::deserialize(corrupt(56, -1.0)), std::invalid_argument);
+    // non finite min, max (offsets 24 and 32) or first mean (48)
+    for(size_t offset: {24U, 32U, 48U}) {
+        for(fln::f64 v: {std::nan(""), std::numeric_limits<fln::f64>::infinity(), -std::numeric_limits<fln::f64>::infinity()})
+            EXPECT_THROW((void)fln::stats::QuantileSketch::deserialize(corrupt(offset, v)), std::invalid_argument) << offset << " " << v;
+    }
+    EXPECT_EQ(fln::stats::QuantileSketch(std::nan("")).compression(), 10.0);
+    EXPECT_EQ(fln::stats::QuantileSketch(1e300).compression(), 100000.0);
+}
@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+
+#define IDEBUG
+#include "Timing.h"
+
+TEST(timing, cycle_frequency) {
+    const fln::f64 frequency= fln::time::cycleFrequency();
+    EXPECT_GT(frequency, 0.0);
+    EXPECT_EQ(frequency, fln::time::cycleFrequency());// calibrated once
+    if(fln::time::hasCycleCounter()) {
+        // between 1MHz and 10GHz
+        EXPECT_GT(frequency, 1e-3);
+        EXPECT_LT(frequency, 10.0);
+    }
+    const fln::u64 a= fln::time::cycleStart();
+    const fln::u64 b= fln::time::cycleStop();
+    EXPECT_GE(b, a);
+#ifdef FLN_VERBOSE_TEST
+    std::cout << "cycle counter frequency: " << frequency << " GHz" << std::endl;
+#endif
+}
+
+TEST(timing, cycle_timer) {
+    // conversion of the ticks with the calibrated frequency
+    const fln::f64 frequency= fln::time::cycleFrequency();
+    fln::time::CycleTimer fixed;
+    fixed.m_cycles= 123456789;
+    EXPECT_NEAR(fixed.currentTimeTakenInMilliSeconds(), 123456789.0 / frequency / 1e6, 1e-12 * fixed.currentTimeTakenInMilliSeconds());
+    EXPECT_NEAR(static_cast<fln::f64>(fixed.currentTimeTakenInNanoSeconds().count()), 123456789.0 / frequency, 1.0);
+    // same measure as the reference timer, with a margin for the calibration on loaded hosts
+    fln::time::CycleTimer timer;
+    fln::time::Timer reference;
+    reference.startTimer();
+    timer.startTimer();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    timer.stopTimer();
+    reference.stopTimer();
+    const fln::f64 ratio= timer.currentTimeTakenInMilliSeconds() / reference.currentTimeTakenInMilliSeconds();
+    EXPECT_GT(ratio, 0.5);
+    EXPECT_LT(ratio, 2.0);
+    // stopped: the value does not change
+    const fln::u64 cycles= timer.currentCycles();
+    EXPECT_GT(cycles, 0U);
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    EXPECT_EQ(timer.currentCycles(), cycles);
+    // no timeout set
+    timer.startTimer();
+    for(int i= 0; i < 1000; ++i) timer.timeCheck();
+    EXPECT_FALSE(timer.timedOut());
+}
+
+TEST(timing, cycle_timer_timeout) {
+    fln::time::CycleTimer timer;
+    timer.startTimer(2.0, 16);
+    fln::u64 calls= 0;
+    EXPECT_THROW(
+            {
+                while(true) {
+                    ++calls;
+                    timer.timeCheck();
+                }
+            },
+            fln::time::TimeoutException);
+    EXPECT_FALSE(timer.m_started);
+    EXPECT_EQ(calls % 16, 0U);
+    EXPECT_GE(timer.currentTimeTakenInMilliSeconds(), 2.0);
+}
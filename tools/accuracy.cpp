@@ -0,0 +1,197 @@
+/**
+ * \file accuracy.cpp
+ *
+ * \date 17/10/2026
+ * \author Silmaen
+ */
+#include "accuracy.h"
+#include "baseDefines.h"
+#include <atomic>
+#include <bit>
+#include <mutex>
+#include <thread>
+
+namespace fln::accuracy {
+
+namespace {
+
+/// number of inputs evaluated by one call to a kernel
+constexpr size_t blockSize= 4096;
+/// number of patterns given to a thread at once
+constexpr u64 chunkSize= u64{1} << 20U;
+
+/**
+ * @brief Check if a value can be used as reference (finite and normal as a float).
+ * @param exact The value.
+ * @return True if usable.
+ */
+bool isValidReference(long double exact) {
+    if(!std::isfinite(exact)) return false;
+    const long double a= std::fabs(exact);
+    return a >= static_cast<long double>(std::numeric_limits<f32>::min()) && a <= static_cast<long double>(std::numeric_limits<f32>::max());
+}
+
+/**
+ * @brief Check if an input is in the domain of a function.
+ * @param x The input.
+ * @param domain The domain.
+ * @return True if the input should be tested.
+ */
+bool inDomain(f32 x, Domain domain) {
+    if(!std::isfinite(x)) return false;
+    switch(domain) {
+    case Domain::Finite:
+        return true;
+    case Domain::Positive:
+        return x > 0;
+    }
+    return false;
+}
+
+}// namespace
+
+long double ulpSize(f32 value) noexcept {
+    const s32 exponent= static_cast<s32>((std::bit_cast<u32>(value) >> 23U) & 0xFFU);
+    // denormals and zero share the spacing of the smallest exponent
+    return std::ldexp(1.0L, std::max(exponent, 1) - 127 - 23);
+}
+
+long double ulpError(f32 result, long double exact) noexcept {
+    return std::fabs(static_cast<long double>(result) - exact) / ulpSize(static_cast<f32>(exact));
+}
+
+size_t histogramBin(long double ulp) noexcept {
+    if(ulp <= 0.5L) return 0;
+    if(ulp <= 1.0L) return 1;
+    int exponent= 0;
+    // ulp in (2^(k-2), 2^(k-1)] -> bin k
+    const long double mantissa= std::frexp(ulp, &exponent);
+    if(mantissa == 0.5L) --exponent;
+    return std::min<size_t>(static_cast<size_t>(exponent) + 1, histogramBins - 1);
+}
+
+long double histogramBound(size_t bin) noexcept {
+    if(bin == 0) return 0.5L;
+    return std::ldexp(1.0L, static_cast<int>(bin) - 1);
+}
+
+void ErrorStats::add(u32 input, f32 result, long double exact, size_t keep) {
+    if(!std::isfinite(result)) {
+        ++failures;
+        ++tested;
+        ++histogram[histogramBins - 1];
+        maxUlp= std::numeric_limits<long double>::infinity();
+        maxRel= std::numeric_limits<long double>::infinity();
+        if(keep > 0) {
+            worst.insert(worst.begin(), {input, result, exact, maxUlp});
+            if(worst.size() > keep) worst.pop_back();
+        }
+        return;
+    }
+    const long double ulp= ulpError(result, exact);
+    const long double rel= std::fabs(static_cast<long double>(result) - exact) / std::fabs(exact);
+    ++tested;
+    sumUlp+= ulp;
+    sumRel+= rel;
+    maxUlp= std::max(maxUlp, ulp);
+    maxRel= std::max(maxRel, rel);
+    ++histogram[histogramBin(ulp)];
+    if(keep == 0 || (worst.size() >= keep && ulp <= worst.back().ulp)) return;
+    const auto pos= std::find_if(worst.begin(), worst.end(), [&](const Sample& s) { return s.ulp < ulp; });
+    worst.insert(pos, {input, result, exact, ulp});
+    if(worst.size() > keep) worst.pop_back();
+}
+
+void ErrorStats::merge(const ErrorStats& other, size_t keep) {
+    tested+= other.tested;
+    skipped+= other.skipped;
+    failures+= other.failures;
+    maxUlp= std::max(maxUlp, other.maxUlp);
+    maxRel= std::max(maxRel, other.maxRel);
+    sumUlp+= other.sumUlp;
+    sumRel+= other.sumRel;
+    for(size_t i= 0; i < histogramBins; ++i) histogram[i]+= other.histogram[i];
+    worst.insert(worst.end(), other.worst.begin(), other.worst.end());
+    std::stable_sort(worst.begin(), worst.end(), [](const Sample& a, const Sample& b) { return a.ulp > b.ulp; });
+    if(worst.size() > keep) worst.resize(keep);
+}
+
+ErrorStats sweep(const Function& function, const SweepOptions& options) {
+    const u64 stride    = std::max<u64>(options.stride, 1);
+    const u64 count     = options.last >= options.first ? (options.last - options.first) / stride + 1 : 0;
+    const u64 chunks    = (count + chunkSize - 1) / chunkSize;
+    const u32 threads   = options.threads > 0 ? options.threads : std::max(1U, std::thread::hardware_concurrency());
+    std::atomic<u64> next= 0;
+    std::mutex mutex;
+    ErrorStats total;
+    const auto worker= [&]() {
+        ErrorStats local;
+        std::vector<f32> in(blockSize), out(blockSize);
+        std::vector<long double> exact(blockSize);
+        std::vector<u32> bits(blockSize);
+        for(u64 chunk= next++; chunk < chunks; chunk= next++) {
+            const u64 begin= chunk * chunkSize;
+            const u64 end  = std::min(count, begin + chunkSize);
+            for(u64 block= begin; block < end; block+= blockSize) {
+                // gather the valid inputs of the block
+                size_t n= 0;
+                for(u64 i= block; i < std::min(end, block + blockSize); ++i) {
+                    const auto pattern= static_cast<u32>(options.first + i * stride);
+                    const f32 x       = std::bit_cast<f32>(pattern);
+                    if(!inDomain(x, function.domain)) {
+                        ++local.skipped;
+                        continue;
+                    }
+                    const long double e= function.reference(static_cast<long double>(x));
+                    if(!isValidReference(e)) {
+                        ++local.skipped;
+                        continue;
+                    }
+                    bits[n] = pattern;
+                    in[n]   = x;
+                    exact[n]= e;
+                    ++n;
+                }
+                function.kernel(in.data(), out.data(), n);
+                for(size_t i= 0; i < n; ++i) local.add(bits[i], out[i], exact[i], options.worst);
+            }
+        }
+        const std::lock_guard lock(mutex);
+        total.merge(local, options.worst);
+    };
+    std::vector<std::thread> pool;
+    for(u32 t= 1; t < threads; ++t) pool.emplace_back(worker);
+    worker();
+    for(auto& thread: pool) thread.join();
+    return total;
+}
+
+void printReport(std::ostream& os, const std::string& name, const ErrorStats& stats, bool histogram) {
+    const auto flags= os.flags();
+    os << name << std::endl
+       << "  tested " << stats.tested << ", skipped " << stats.skipped << ", non finite results " << stats.failures << std::endl
+       << std::setprecision(4)
+       << "  ulp error: max " << static_cast<f64>(stats.maxUlp) << ", mean " << static_cast<f64>(stats.meanUlp()) << std::endl
+       << "  relative error: max " << static_cast<f64>(stats.maxRel) << ", mean " << static_cast<f64>(stats.meanRel()) << std::endl;
+    if(histogram && stats.tested > 0) {
+        os << "  histogram (ulp <= bound: count, fraction):" << std::endl;
+        for(size_t i= 0; i < histogramBins; ++i) {
+            if(stats.histogram[i] == 0) continue;
+            os << "    ";
+            if(i == histogramBins - 1) os << std::setw(12) << "above";
+            else os << std::setw(12) << static_cast<f64>(histogramBound(i));
+            os << ": " << std::setw(11) << stats.histogram[i] << "  " << std::fixed << std::setprecision(6)
+               << static_cast<f64>(stats.histogram[i]) / static_cast<f64>(stats.tested) << std::defaultfloat << std::setprecision(4) << std::endl;
+        }
+    }
+    if(!stats.worst.empty()) {
+        os << "  worst inputs:" << std::endl;
+        for(const auto& sample: stats.worst) {
+            os << "    x= " << std::setprecision(9) << std::bit_cast<f32>(sample.input) << " (0x" << std::hex << std::setw(8) << std::setfill('0') << sample.input << std::dec << std::setfill(' ')
+               << ") result= " << sample.result << " exact= " << static_cast<f64>(sample.exact) << std::setprecision(4) << " ulp= " << static_cast<f64>(sample.ulp) << std::endl;
+        }
+    }
+    os.flags(flags);
+}
+
+}// namespace fln::accuracy
@@ -0,0 +1,171 @@
+/**
+ * \file accuracy.h
+ *
+ * \date 17/10/2026
+ * \author Silmaen
+ */
+#pragma once
+#include "baseType.h"
+#include <array>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+/**
+ * @namespace fln::accuracy
+ * @brief exhaustive accuracy analysis of the f32 approximations
+ *
+ * Every 32 bits pattern (or one every stride) is given to the approximation and compared
+ * with a reference computed in long double and rounded to the nearest float. The errors
+ * are measured in ULP of the reference (the distance to the exact value divided by the
+ * spacing of floats around it) and in relative error.
+ */
+namespace fln::accuracy {
+
+/**
+ * @brief Signature of a kernel under test: computes n results
+ */
+using Kernel= void (*)(const f32* in, f32* out, size_t n);
+/**
+ * @brief Signature of a reference function
+ */
+using Reference= long double (*)(long double x);
+
+/**
+ * @brief Input domain of a function
+ */
+enum struct Domain {
+    Finite,  ///< any finite input
+    Positive ///< strictly positive finite inputs
+};
+
+/**
+ * @brief A function to analyze
+ */
+struct Function {
+    std::string name;        ///< name of the approximation
+    Kernel kernel;           ///< the approximation
+    Reference reference;     ///< the exact function
+    Domain domain= Domain::Finite;///< the inputs to test
+};
+
+/**
+ * @brief Get all the approximations of the library that can be analyzed.
+ * @return The list of functions.
+ */
+[[nodiscard]] const std::vector<Function>& functions();
+
+/**
+ * @brief Get the spacing of the floats around a value (the unit in the last place).
+ * @param value A finite float.
+ * @return The ULP size (the smallest denormal for 0 and denormals).
+ */
+[[nodiscard]] long double ulpSize(f32 value) noexcept;
+
+/**
+ * @brief Get the error in ULP between a result and the exact value.
+ * @param result The approximation.
+ * @param exact The exact value.
+ * @return The absolute error divided by the ULP size of the exact value rounded to float.
+ */
+[[nodiscard]] long double ulpError(f32 result, long double exact) noexcept;
+
+/// number of bins of the error histogram
+constexpr size_t histogramBins= 36;
+
+/**
+ * @brief Get the histogram bin of an ULP error.
+ *
+ * Bin 0 holds errors up to 0.5 ULP (correctly rounded), bin 1 up to 1 ULP and bin k
+ * errors in (2^(k-2), 2^(k-1)] ULP.
+ *
+ * @param ulp The ULP error.
+ * @return The bin index.
+ */
+[[nodiscard]] size_t histogramBin(long double ulp) noexcept;
+
+/**
+ * @brief Get the upper bound of a histogram bin in ULP.
+ * @param bin The bin index.
+ * @return The upper bound.
+ */
+[[nodiscard]] long double histogramBound(size_t bin) noexcept;
+
+/**
+ * @brief One of the worst inputs of a function
+ */
+struct Sample {
+    u32 input        = 0;///< bits of the input
+    f32 result       = 0;///< result of the approximation
+    long double exact= 0;///< exact value
+    long double ulp  = 0;///< error in ULP
+};
+
+/**
+ * @brief Accumulated errors of a function
+ */
+struct ErrorStats {
+    u64 tested         = 0;        ///< number of compared results
+    u64 skipped        = 0;        ///< inputs out of the domain or with a non normal reference
+    u64 failures       = 0;        ///< results which are NaN or infinite while the reference is finite
+    long double maxUlp = 0;        ///< maximal ULP error
+    long double sumUlp = 0;        ///< sum of the ULP errors
+    long double maxRel = 0;        ///< maximal relative error
+    long double sumRel = 0;        ///< sum of the relative errors
+    std::array<u64, histogramBins> histogram{};///< number of results per ULP error bin
+    std::vector<Sample> worst;     ///< the worst inputs, sorted by decreasing error
+    /**
+     * @brief Add a comparison.
+     * @param input Bits of the input.
+     * @param result The approximation.
+     * @param exact The exact value.
+     * @param keep Number of worst inputs to keep.
+     */
+    void add(u32 input, f32 result, long double exact, size_t keep);
+    /**
+     * @brief Merge the errors of another part of the range.
+     * @param other The other errors.
+     * @param keep Number of worst inputs to keep.
+     */
+    void merge(const ErrorStats& other, size_t keep);
+    /**
+     * @brief Mean of the ULP errors.
+     * @return The mean.
+     */
+    [[nodiscard]] long double meanUlp() const noexcept { return tested > 0 ? sumUlp / static_cast<long double>(tested) : 0; }
+    /**
+     * @brief Mean of the relative errors.
+     * @return The mean.
+     */
+    [[nodiscard]] long double meanRel() const noexcept { return tested > 0 ? sumRel / static_cast<long double>(tested) : 0; }
+};
+
+/**
+ * @brief Options of a sweep
+ */
+struct SweepOptions {
+    u64 first  = 0;          ///< first bit pattern
+    u64 last   = 0xFFFFFFFFU;///< last bit pattern (included)
+    u64 stride = 1;          ///< test one pattern every stride
+    u32 threads= 0;          ///< number of threads (0: all the cores)
+    size_t worst= 10;        ///< number of worst inputs to keep
+};
+
+/**
+ * @brief Run a function over the range of inputs.
+ * @param function The function to analyze.
+ * @param options The sweep options.
+ * @return The errors.
+ */
+[[nodiscard]] ErrorStats sweep(const Function& function, const SweepOptions& options);
+
+/**
+ * @brief Print the report of a function.
+ * @param os The output stream.
+ * @param name The name of the function.
+ * @param stats The errors.
+ * @param histogram Print also the histogram.
+ */
+void printReport(std::ostream& os, const std::string& name, const ErrorStats& stats, bool histogram);
+
+}// namespace fln::accuracy
@@ -0,0 +1,93 @@
+/**
+ * \file accuracy_functions.cpp
+ *
+ * \date 17/10/2026
+ * \author Silmaen
+ */
+#include "FloatFunctions.h"
+#include "accuracy.h"
+#include "bithack_Functions.h"
+#include "bithack_SimdFunctions.h"
+#include "union_Functions.h"
+
+/**
+ * @brief Build a kernel from a scalar expression of x.
+ */
+#define FLN_SCALAR_KERNEL(EXPR)                       \
+    [](const f32* in, f32* out, size_t n) {           \
+        for(size_t i= 0; i < n; ++i) {                \
+            [[maybe_unused]] const f32 x= in[i];      \
+            out[i]                      = (EXPR);     \
+        }                                             \
+    }
+
+namespace fln::accuracy {
+
+namespace {
+
+long double refAbs(long double x) { return std::fabs(x); }
+long double refLog2(long double x) { return std::log2(x); }
+long double refExp2(long double x) { return std::exp2(x); }
+long double refPow(long double x) { return std::pow(x, 1.25L); }
+long double refSqrt(long double x) { return std::sqrt(x); }
+long double refRsqrt(long double x) { return 1.0L / std::sqrt(x); }
+
+/// exponent used to analyze the pow functions
+constexpr f32 powExponent= 1.25f;
+
+}// namespace
+
+const std::vector<Function>& functions() {
+    using object::BitFloat;
+    static const std::vector<Function> list{
+            // abs
+            {"bithack::abs", FLN_SCALAR_KERNEL(bithack::abs(x)), refAbs},
+            {"_union::abs", FLN_SCALAR_KERNEL(_union::abs(x)), refAbs},
+            {"object::abs", FLN_SCALAR_KERNEL(object::abs(BitFloat(x)).getFloat()), refAbs},
+            // log2
+            {"bithack::log2", FLN_SCALAR_KERNEL(bithack::log2(x)), refLog2, Domain::Positive},
+            {"bithack::log2<Fast>", FLN_SCALAR_KERNEL(bithack::log2<Precision::Fast>(x)), refLog2, Domain::Positive},
+            {"bithack::log2<Medium>", FLN_SCALAR_KERNEL(bithack::log2<Precision::Medium>(x)), refLog2, Domain::Positive},
+            {"bithack::log2<High>", FLN_SCALAR_KERNEL(bithack::log2<Precision::High>(x)), refLog2, Domain::Positive},
+            {"bithack::simd::log2", bithack::simd::log2, refLog2, Domain::Positive},
+            {"_union::log2", FLN_SCALAR_KERNEL(_union::log2(x)), refLog2, Domain::Positive},
+            {"object::log2", FLN_SCALAR_KERNEL(object::log2(BitFloat(x))), refLog2, Domain::Positive},
+            {"object::log2a", FLN_SCALAR_KERNEL(object::log2a(BitFloat(x))), refLog2, Domain::Positive},
+            {"object::log2<High>", FLN_SCALAR_KERNEL(object::log2<Precision::High>(BitFloat(x))), refLog2, Domain::Positive},
+            // exp2
+            {"bithack::exp2", FLN_SCALAR_KERNEL(bithack::exp2(x)), refExp2},
+            {"bithack::exp2<Fast>", FLN_SCALAR_KERNEL(bithack::exp2<Precision::Fast>(x)), refExp2},
+            {"bithack::exp2<Medium>", FLN_SCALAR_KERNEL(bithack::exp2<Precision::Medium>(x)), refExp2},
+            {"bithack::exp2<High>", FLN_SCALAR_KERNEL(bithack::exp2<Precision::High>(x)), refExp2},
+            {"bithack::simd::exp2", bithack::simd::exp2, refExp2},
+            {"_union::exp2", FLN_SCALAR_KERNEL(_union::exp2(x)), refExp2},
+            {"object::exp2", FLN_SCALAR_KERNEL(object::exp2(BitFloat(x))), refExp2},
+            {"object::exp2<High>", FLN_SCALAR_KERNEL(object::exp2<Precision::High>(BitFloat(x))), refExp2},
+            // pow
+            {"bithack::pow(x,1.25)", FLN_SCALAR_KERNEL(bithack::pow(x, powExponent)), refPow, Domain::Positive},
+            {"bithack::simd::pow(x,1.25)", [](const f32* in, f32* out, size_t n) { bithack::simd::pow(in, out, n, powExponent); }, refPow, Domain::Positive},
+            {"_union::pow(x,1.25)", FLN_SCALAR_KERNEL(_union::pow(x, powExponent)), refPow, Domain::Positive},
+            {"object::pow(x,1.25)", FLN_SCALAR_KERNEL(object::pow(BitFloat(x), BitFloat(powExponent))), refPow, Domain::Positive},
+            // sqrt
+            {"bithack::sqrt", FLN_SCALAR_KERNEL(bithack::sqrt(x)), refSqrt, Domain::Positive},
+            {"bithack::sqrt_pow", FLN_SCALAR_KERNEL(bithack::sqrt_pow(x)), refSqrt, Domain::Positive},
+            {"bithack::sqrt_b", FLN_SCALAR_KERNEL(bithack::sqrt_b(x)), refSqrt, Domain::Positive},
+            {"bithack::sqrt<1>", FLN_SCALAR_KERNEL(bithack::sqrt<1>(x)), refSqrt, Domain::Positive},
+            {"bithack::sqrt<2>", FLN_SCALAR_KERNEL(bithack::sqrt<2>(x)), refSqrt, Domain::Positive},
+            {"bithack::sqrt<3>", FLN_SCALAR_KERNEL(bithack::sqrt<3>(x)), refSqrt, Domain::Positive},
+            {"bithack::simd::sqrt", bithack::simd::sqrt, refSqrt, Domain::Positive},
+            {"_union::sqrt", FLN_SCALAR_KERNEL(_union::sqrt(x)), refSqrt, Domain::Positive},
+            {"_union::sqrt_pow", FLN_SCALAR_KERNEL(_union::sqrt_pow(x)), refSqrt, Domain::Positive},
+            {"_union::sqrt_b", FLN_SCALAR_KERNEL(_union::sqrt_b(x)), refSqrt, Domain::Positive},
+            // inverse sqrt
+            {"bithack::rsqrt<0>", FLN_SCALAR_KERNEL(bithack::rsqrt<0>(x)), refRsqrt, Domain::Positive},
+            {"bithack::rsqrt_quake", FLN_SCALAR_KERNEL(bithack::rsqrt_quake(x)), refRsqrt, Domain::Positive},
+            {"bithack::rsqrt<2>", FLN_SCALAR_KERNEL(bithack::rsqrt<2>(x)), refRsqrt, Domain::Positive},
+            {"bithack::rsqrt<3>", FLN_SCALAR_KERNEL(bithack::rsqrt<3>(x)), refRsqrt, Domain::Positive},
+            {"bithack::simd::rsqrt", bithack::simd::rsqrt, refRsqrt, Domain::Positive},
+            {"_union::rsqrt_quake", FLN_SCALAR_KERNEL(_union::rsqrt_quake(x)), refRsqrt, Domain::Positive},
+    };
+    return list;
+}
+
+}// namespace fln::accuracy
@@ -0,0 +1,75 @@
+/**
+ * \file accuracy_main.cpp
+ *
+ * \date 17/10/2026
+ * \author Silmaen
+ */
+#include "Timing.h"
+#include "accuracy.h"
+
+namespace {
+
+void usage(const char* program) {
+    std::cout << "usage: " << program << " [options]" << std::endl
+              << "  exhaustive accuracy analysis of the f32 approximations" << std::endl
+              << "  --filter <text>    analyze only the functions whose name contains <text>" << std::endl
+              << "  --stride <n>       test one input bit pattern every n (default 1: all 2^32 patterns)" << std::endl
+              << "  --first <bits>     first input bit pattern (default 0)" << std::endl
+              << "  --last <bits>      last input bit pattern (default 0xFFFFFFFF)" << std::endl
+              << "  --threads <n>      number of threads (default: all the cores)" << std::endl
+              << "  --worst <n>        number of worst inputs to report (default 10)" << std::endl
+              << "  --histogram        print the ulp error histograms" << std::endl
+              << "  --list             list the functions" << std::endl;
+}
+
+}// namespace
+
+int main(int argc, char* argv[]) {
+    fln::accuracy::SweepOptions options;
+    std::string filter;
+    bool histogram= false;
+    int i= 1;
+    try {
+        for(; i < argc; ++i) {
+            const std::string arg(argv[i]);
+            const bool hasValue= i + 1 < argc;
+            if(arg == "--filter" && hasValue) {
+                filter= argv[++i];
+            } else if(arg == "--stride" && hasValue) {
+                options.stride= std::stoull(argv[++i], nullptr, 0);
+            } else if(arg == "--first" && hasValue) {
+                options.first= std::stoull(argv[++i], nullptr, 0);
+            } else if(arg == "--last" && hasValue) {
+                options.last= std::stoull(argv[++i], nullptr, 0);
+            } else if(arg == "--threads" && hasValue) {
+                options.threads= static_cast<fln::u32>(std::stoul(argv[++i]));
+            } else if(arg == "--worst" && hasValue) {
+                options.worst= std::stoull(argv[++i]);
+            } else if(arg == "--histogram") {
+                histogram= true;
+            } else if(arg == "--list") {
+                for(const auto& function: fln::accuracy::functions()) std::cout << function.name << std::endl;
+                return 0;
+            } else {
+                usage(argv[0]);
+                return arg == "--help" ? 0 : 1;
+            }
+        }
+    } catch(const std::logic_error&) {
+        // std::invalid_argument or std::out_of_range of the number conversions
+        std::cerr << "invalid value for " << argv[i - 1] << ": " << argv[i] << std::endl;
+        usage(argv[0]);
+        return 1;
+    }
+    options.last= std::min<fln::u64>(options.last, 0xFFFFFFFFU);
+    for(const auto& function: fln::accuracy::functions()) {
+        if(!filter.empty() && function.name.find(filter) == std::string::npos) continue;
+        fln::time::Timer timer;
+        timer.startTimer();
+        const auto stats= fln::accuracy::sweep(function, options);
+        timer.stopTimer();
+        fln::accuracy::printReport(std::cout, function.name, stats, histogram);
+        std::cout << "  " << timer << std::endl;
+    }
+    return 0;
+}